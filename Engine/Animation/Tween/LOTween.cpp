@@ -18,7 +18,17 @@ void LOTween::Update(float dt)
 	for (std::vector<TweenSequence*>::reverse_iterator it = sequences.rbegin(); it != sequences.rend(); ++it)
 	{
 		TweenSequence* sequence = (*it);
-		sequence->Update(dt);
+		sequence->Update(dt, completed_callbacks);
+	}
+}
+
+void LOTween::RunCompletedCallbacks()
+{
+	std::vector<std::function<void(void)>> callbacks;
+	callbacks.swap(completed_callbacks);
+	for (const auto& callback : callbacks)
+	{
+		callback();
 	}
 }
 
@@ -14,9 +14,12 @@ public:
 	void Update(float);
 	void Reset();
 	void CleanSequences();
+	// Sequences are updated away from the main thread, what they run once completed is run here instead
+	void RunCompletedCallbacks();
 
 private:
 	std::vector<TweenSequence*> sequences;
+	std::vector<std::function<void(void)>> completed_callbacks;
 	const float MAX_TIME_ALLOWED = 1000.f;
 };
 #endif _LOTWEEN_H_
@@ -79,7 +79,7 @@ TweenSequence* TweenSequence::OnCompleted(std::function<void(void)> callback)
 	return this;
 }
 
-void TweenSequence::Update(float dt)
+void TweenSequence::Update(float dt, std::vector<std::function<void(void)>>& completed_callbacks)
 {
 	if (state != TweenSequenceState::PLAYING) return;
 
@@ -123,7 +123,7 @@ void TweenSequence::Update(float dt)
 	{
 		if (on_completed_callback != nullptr)
 		{
-			on_completed_callback();
+			completed_callbacks.push_back(on_completed_callback);
 		}
 
 		Stop();
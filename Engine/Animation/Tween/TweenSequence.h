@@ -30,7 +30,7 @@ public:
 
 
 private:
-	void Update(float);
+	void Update(float, std::vector<std::function<void(void)>>& completed_callbacks);
 
 	float current_time = 0.0f;
 	TweenSequenceState state = TweenSequenceState::DISABLED;
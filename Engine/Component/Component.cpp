@@ -1,5 +1,8 @@
 #include "Component.h"
 
+#include "Main/Application.h"
+#include "Module/ModuleScene.h"
+
 void Component::Save(Config& config) const
 {
 	config.AddUInt(UUID, "UUID");
@@ -15,6 +18,7 @@ void Component::Load(const Config &config)
 	active = config.GetBool("Active", true);
 
 	SpecializedLoad(config);
+	App->scene->IndexComponent(this);
 }
 
 void Component::CloneBase(Component* component) const
@@ -84,11 +84,6 @@ public:
 	virtual void SpecializedSave(Config& config) const = 0;
 	virtual void SpecializedLoad(const Config &config) = 0;
 
-	virtual void LoadResource(uint32_t uuid, ResourceType resource) {}
-	virtual void LoadResource(uint32_t uuid, ResourceType resource, unsigned type) {}
-	virtual void InitResource(uint32_t uuid, ResourceType resource) {}
-	virtual void InitResource(uint32_t uuid, ResourceType resource, unsigned type) {}
-
 	virtual void ReassignResource() {}
 
 	virtual ComponentType GetType() const { return type; };
@@ -112,6 +107,8 @@ public:
 
 	bool modified_by_user = false; //This is only for prefab and UI
 	bool added_by_user = false; //This is only for prefab and UI
+
+	uint32_t pool_index = UINT32_MAX; // Slot in its module ComponentPool, components created with new are never found there
 };
 
 #endif //_COMPONENT_H_
@@ -30,6 +30,13 @@ void ComponentAABB::SpecializedLoad(const Config& config)
 }
 
 void ComponentAABB::GenerateBoundingBox()
+{
+	GenerateLocalBoundingBox();
+	GenerateGlobalBoundingBox();
+	PropagateGlobalBoundingBox();
+}
+
+void ComponentAABB::GenerateLocalBoundingBox()
 {
 	BROFILER_CATEGORY("GenerateBoundingBox", Profiler::Color::Lavender);
 	bool has_mesh = false;
@@ -39,7 +46,8 @@ void ComponentAABB::GenerateBoundingBox()
 
 	if (has_mesh)
 	{
-		GenerateBoundingBoxFromVertices(owner_mesh_renderer->mesh_to_render->vertices);
+		original_box = owner_mesh_renderer->mesh_to_render->bounding_box;
+		bounding_box = original_box;
 	}
 	else if(owner_particle_system)
 	{ 
@@ -55,24 +63,49 @@ void ComponentAABB::GenerateBoundingBox()
 	float2 min_point2D = float2(bounding_box.MinX(), bounding_box.MinZ());
 	float2 max_point2D = float2(bounding_box.MaxX(), bounding_box.MaxZ());
 	bounding_box2D = AABB2D(min_point2D, max_point2D);
-	GenerateGlobalBoundingBox();
-	if (owner->parent != nullptr)
+	dirty = false;
+}
+
+void ComponentAABB::PropagateGlobalBoundingBox() const
+{
+	// Ancestors whose global box does not change stop the propagation, nothing above them depends on this one
+	GameObject* ancestor = owner->parent;
+	while (ancestor != nullptr)
 	{
-		owner->parent->aabb.GenerateGlobalBoundingBox();
+		AABB previous_global_bounding_box = ancestor->aabb.global_bounding_box;
+		ancestor->aabb.GenerateGlobalBoundingBox();
+		if (
+			previous_global_bounding_box.minPoint.Equals(ancestor->aabb.global_bounding_box.minPoint, 0.f)
+			&& previous_global_bounding_box.maxPoint.Equals(ancestor->aabb.global_bounding_box.maxPoint, 0.f)
+		)
+		{
+			return;
+		}
+		ancestor = ancestor->parent;
 	}
 }
 
-void ComponentAABB::GenerateBoundingBoxFromVertices(const std::vector<Mesh::Vertex>& vertices)
+void ComponentAABB::InvalidateGlobalBoundingBox(std::vector<ComponentAABB*>& invalidated_bounding_boxes)
 {
-	bounding_box.SetNegativeInfinity();
-	original_box.SetNegativeInfinity();
-	for (unsigned int i = 0; i < vertices.size(); ++i)
+	ComponentAABB* current = this;
+	while (current != nullptr && !current->global_dirty)
 	{
-		bounding_box.Enclose(vertices[i].position);
-		original_box.Enclose(vertices[i].position);
+		current->global_dirty = true;
+		invalidated_bounding_boxes.push_back(current);
+		current = current->owner->parent != nullptr ? &current->owner->parent->aabb : nullptr;
 	}
 }
 
+void ComponentAABB::Invalidate()
+{
+	dirty = true;
+}
+
+bool ComponentAABB::IsDirty() const
+{
+	return dirty;
+}
+
 void ComponentAABB::GenerateBoundingBoxFromParticleSystem(const ComponentParticleSystem& particle_system)
 {
 	bounding_box.SetNegativeInfinity();
@@ -117,6 +150,7 @@ void ComponentAABB::GenerateBoundingBoxFromParticleSystem(const ComponentParticl
 
 void ComponentAABB::GenerateGlobalBoundingBox()
 {
+	global_dirty = false;
 	global_bounding_box = bounding_box;
 	for (auto& child : owner->children)
 	{
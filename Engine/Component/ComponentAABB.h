@@ -32,6 +32,12 @@ public:
 
 	void Delete() override {};
 	void GenerateBoundingBox();
+	void GenerateLocalBoundingBox();
+	void GenerateGlobalBoundingBox();
+	void InvalidateGlobalBoundingBox(std::vector<ComponentAABB*>& invalidated_bounding_boxes);
+
+	void Invalidate();
+	bool IsDirty() const;
 
 	void SpecializedSave(Config& config) const override;
 	void SpecializedLoad(const Config& config) override;
@@ -39,9 +45,8 @@ public:
 	bool IsEmpty() const;
 
 private:
-	void GenerateBoundingBoxFromVertices(const std::vector<Mesh::Vertex>& vertices);
 	void GenerateBoundingBoxFromParticleSystem(const ComponentParticleSystem& particle_system);
-	void GenerateGlobalBoundingBox();
+	void PropagateGlobalBoundingBox() const;
 	Component* Clone(GameObject* owner, bool original_prefab) override;
 public:
 	AABB bounding_box;
@@ -49,6 +54,9 @@ public:
 	AABB original_box;
 	AABB2D bounding_box2D;
 
+private:
+	bool dirty = false; // Owner transform changed, bounding boxes are regenerated once per frame by ModuleScene::UpdateBoundingBoxes
+	bool global_dirty = false; // This box or one below it changed, global box waits for its children
 };
 
 #endif //_COMPONENTAABB_H_
@@ -139,7 +139,7 @@ Component* ComponentAudioSource::Clone(GameObject* owner, bool original_prefab)
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 };
 
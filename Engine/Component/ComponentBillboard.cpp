@@ -161,7 +161,7 @@ Component* ComponentBillboard::Clone(GameObject* owner, bool original_prefab)
 	}
 	*created_component = *this;
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 }
 
@@ -175,6 +175,7 @@ void ComponentBillboard::CopyTo(Component* component_to_copy) const
 void ComponentBillboard::Delete()
 {
 	App->effects->RemoveComponentBillboard(this);
+	App->resources->CancelAsyncLoads(this);
 }
 
 void ComponentBillboard::SpecializedSave(Config& config) const
@@ -245,47 +246,27 @@ void ComponentBillboard::ChangeTexture(uint32_t texture_uuid)
 {
 	if (texture_uuid != 0)
 	{
-		//Prepare multithreading loading
-		App->resources->loading_thread_communication.current_component_loading = this;
-		App->resources->loading_thread_communication.current_type = ResourceType::TEXTURE;
 		this->texture_uuid = texture_uuid;
-		billboard_texture = App->resources->Load<Texture>(texture_uuid);
-
-		//Set to default loading component
-		App->resources->loading_thread_communication.current_component_loading = nullptr;
-	}
-}
-
-
-void ComponentBillboard::LoadResource(uint32_t uuid, ResourceType resource)
-{
-	billboard_texture = std::static_pointer_cast<Texture>(App->resources->RetrieveFromCacheIfExist(uuid));
-
-	if (billboard_texture)
-	{
-		return;
-	}
-
-	FileData file_data;
-	bool succes = App->resources->RetrieveFileDataByUUID(uuid, file_data);
-	if (succes)
-	{
-		//THINK WHAT TO DO IF IS IN CACHE
-		billboard_texture = ResourceManagement::Load<Texture>(uuid, file_data, true);
-		//Delete file data buffer
-		delete[] file_data.buffer;
-		App->resources->AddResourceToCache(std::static_pointer_cast<Resource>(billboard_texture));
+		if (App->resources->LoadsAsynchronously())
+		{
+			billboard_texture = nullptr;
+			// Billboards can be created without owner
+			float priority = owner != nullptr ? App->resources->GetStreamingPriority(owner->transform.GetGlobalTranslation(), width > height ? width : height) : 0.f;
+			App->resources->LoadAsync<Texture>(texture_uuid, priority).Then(this, [this](const std::shared_ptr<Texture>& texture)
+			{
+				if (texture->GetUUID() == this->texture_uuid)
+				{
+					billboard_texture = texture;
+				}
+			});
+		}
+		else
+		{
+			billboard_texture = App->resources->Load<Texture>(texture_uuid);
+		}
 	}
-
 }
 
-void ComponentBillboard::InitResource(uint32_t uuid, ResourceType resource)
-{
-	if (billboard_texture && !billboard_texture.get()->initialized)
-	{
-		billboard_texture.get()->LoadInMemory();
-	}
-}
 
 void ComponentBillboard::ReassignResource()
 {
@@ -294,14 +275,11 @@ void ComponentBillboard::ReassignResource()
 
 void ComponentBillboard::ChangeTextureEmissive(uint32_t texture_uuid)
 {
-	App->resources->loading_thread_communication.normal_loading_flag = true;
-
 	if (texture_uuid != 0)
 	{
 		this->texture_emissive_uuid = texture_uuid;
 		billboard_texture_emissive = App->resources->Load<Texture>(texture_uuid);
 	}
-	App->resources->loading_thread_communication.normal_loading_flag = false;
 }
 
 
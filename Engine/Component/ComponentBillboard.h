@@ -54,8 +54,6 @@ public:
 	void CommonUniforms(const GLuint &shader_program);
 
 	void ChangeTexture(uint32_t texture_uuid);
-	void LoadResource(uint32_t uuid, ResourceType resource) override;
-	void InitResource(uint32_t uuid, ResourceType resource) override;
 
 	void ReassignResource() override;
 
@@ -34,7 +34,7 @@ Component* ComponentButton::Clone(GameObject* owner, bool original_prefab)
 	*created_component = *this;
 	CloneBase(static_cast<Component*>(created_component));
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 };
 
@@ -60,7 +60,7 @@ Component* ComponentCamera::Clone(GameObject* owner, bool original_prefab)
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 }
 
@@ -614,7 +614,7 @@ void ComponentCamera::GetRay(const float2 &mouse_position, LineSegment &return_v
 		float2 window_mouse_position = mouse_position - window_center_pos;
 		normalized_position = float2(window_mouse_position.x * 2 / App->editor->game_panel->game_window_content_area_width, -window_mouse_position.y * 2 / App->editor->game_panel->game_window_content_area_height);
 	}
-	else
+	else if (App->editor->scene_panel != nullptr)
 	{
 		float2 window_center_pos = App->editor->scene_panel->scene_window_content_area_pos + float2(App->editor->scene_panel->scene_window_content_area_width, App->editor->scene_panel->scene_window_content_area_height) / 2;
 
@@ -41,7 +41,7 @@ Component* ComponentCanvasRenderer::Clone(GameObject* owner, bool original_prefa
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 };
 
@@ -30,7 +30,7 @@ Component* ComponentCapsuleCollider::Clone(GameObject* owner, bool original_pref
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 }
 
@@ -168,6 +168,16 @@ btRigidBody* ComponentCollider::AddBody()
 }
 
 
+void ComponentCollider::ResetMotion()
+{
+	if (body)
+	{
+		body->setLinearVelocity(btVector3(0.F, 0.F, 0.F));
+		body->setAngularVelocity(btVector3(0.F, 0.F, 0.F));
+		body->clearForces();
+	}
+}
+
 void ComponentCollider::MoveBody()
 {
 	btTransform trans = body->getWorldTransform();
@@ -72,6 +72,7 @@ public:
 	btRigidBody* AddBody();
 
 	void MoveBody();
+	void ResetMotion(); // Stops the body, the shape and the world keep it
 	void SetMass(float new_mass);
 	void SetVisualization();
 
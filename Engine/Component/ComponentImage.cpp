@@ -89,7 +89,7 @@ Component* ComponentImage::Clone(GameObject* owner, bool original_prefab)
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 
 	created_component->ReassignResource();
 
@@ -106,6 +106,7 @@ void ComponentImage::CopyTo(Component* component_to_copy) const
 void ComponentImage::Delete()
 {
 	App->ui->RemoveComponentUI(this);
+	App->resources->CancelAsyncLoads(this);
 }
 
 void ComponentImage::SpecializedSave(Config& config) const
@@ -126,38 +127,6 @@ void ComponentImage::SpecializedLoad(const Config& config)
 	}
 }
 
-void ComponentImage::LoadResource(uint32_t uuid, ResourceType resource)
-{
-
-	texture_to_render = std::static_pointer_cast<Texture>(App->resources->RetrieveFromCacheIfExist(uuid));
-
-	if(texture_to_render)
-	{
-		return;
-	}
-
-	FileData file_data;
-	bool succes = App->resources->RetrieveFileDataByUUID(uuid, file_data);
-	if(succes)
-	{
-		//THINK WHAT TO DO IF IS IN CACHE
-		texture_to_render = ResourceManagement::Load<Texture>(uuid, file_data, true);
-		//Delete file data buffer
-		delete[] file_data.buffer;
-		App->resources->AddResourceToCache(std::static_pointer_cast<Resource>(texture_to_render));
-		texture_aspect_ratio = (float)texture_to_render->width / texture_to_render->height;
-	}
-
-}
-
-void ComponentImage::InitResource(uint32_t uuid, ResourceType resource)
-{
-	if(texture_to_render && !texture_to_render.get()->initialized)
-	{
-		texture_to_render.get()->LoadInMemory();
-	}
-}
-
 void ComponentImage::ReassignResource()
 {
 	if(texture_uuid != 0)
@@ -168,27 +137,35 @@ void ComponentImage::ReassignResource()
 
 void ComponentImage::SetTextureToRender(uint32_t texture_uuid)
 {
-	//Prepare multithreading loading
-	App->resources->loading_thread_communication.current_component_loading = this;
-	App->resources->loading_thread_communication.current_type = ResourceType::TEXTURE;
 	this->texture_uuid = texture_uuid;
+	if (App->resources->LoadsAsynchronously())
+	{
+		texture_to_render = nullptr;
+		// The UI is always on screen
+		App->resources->LoadAsync<Texture>(texture_uuid, App->resources->streaming_priority_scale).Then(this, [this](const std::shared_ptr<Texture>& texture)
+		{
+			if (texture->GetUUID() == this->texture_uuid)
+			{
+				texture_to_render = texture;
+				texture_aspect_ratio = (float)texture_to_render->width / texture_to_render->height;
+			}
+		});
+		return;
+	}
+
 	texture_to_render = App->resources->Load<Texture>(texture_uuid);
 	if (texture_to_render)
 	{
 		texture_aspect_ratio = (float)texture_to_render->width / texture_to_render->height;
 
 	}
-	//Set to default loading component
-	App->resources->loading_thread_communication.current_component_loading = nullptr;
 }
 
 void ComponentImage::SetTextureToRenderFromInspector(uint32_t texture_uuid)
 {
 	this->texture_uuid = texture_uuid;
 
-	App->resources->loading_thread_communication.normal_loading_flag = true;
 	texture_to_render = App->resources->Load<Texture>(texture_uuid);
-	App->resources->loading_thread_communication.normal_loading_flag = false;
 }
 
 void ComponentImage::SetColor(float4 color)
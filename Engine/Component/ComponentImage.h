@@ -22,8 +22,6 @@ public:
 	void SpecializedSave(Config& config) const override;
 	void SpecializedLoad(const Config& config) override;
 
-	void LoadResource(uint32_t uuid, ResourceType resource) override;
-	void InitResource(uint32_t uuid, ResourceType resource) override;
 
 	void ReassignResource() override;
 
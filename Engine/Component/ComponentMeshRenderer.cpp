@@ -9,6 +9,7 @@
 #include "Module/ModuleProgram.h"
 #include "Module/ModuleRender.h"
 #include "Module/ModuleResourceManager.h"
+#include "Module/ModuleScene.h"
 #include "Module/ModuleTexture.h"
 
 #include "ResourceManagement/ResourcesDB/CoreResources.h"
@@ -30,6 +31,7 @@ ComponentMeshRenderer::ComponentMeshRenderer() : Component(nullptr, ComponentTyp
 void ComponentMeshRenderer::Delete()
 {
 	App->renderer->RemoveComponentMesh(this);
+	App->resources->CancelAsyncLoads(this);
 }
 
 void ComponentMeshRenderer::SpecializedSave(Config& config) const
@@ -43,72 +45,32 @@ void ComponentMeshRenderer::SpecializedSave(Config& config) const
 void ComponentMeshRenderer::SpecializedLoad(const Config& config)
 {
 	mesh_uuid = config.GetUInt32("Mesh", 0);
-	SetMesh(mesh_uuid);
-
 	material_uuid = config.GetUInt32("Material", 0);
-	SetMaterial(material_uuid);
-
 	skeleton_uuid =	config.GetUInt32("Skeleton", 0);
-	SetSkeleton(skeleton_uuid);
-
 	properties = config.GetInt("Properties", MeshProperties::RAYCASTABLE);
+	LoadResources();
 }
 
-void ComponentMeshRenderer::LoadResource(uint32_t uuid, ResourceType resource, unsigned texture_type)
+// Binary scenes keep mesh renderers in fixed records, they are loaded without building a Config
+void ComponentMeshRenderer::Load(uint64_t UUID, bool active, const SceneBinary::MeshRendererRecord& mesh_renderer_record)
 {
-	APP_LOG_INFO("GO Loading Resource: %s", std::to_string(owner->UUID).c_str());
-
-	if(resource == ResourceType::TEXTURE)
-	{
-		material_to_render->LoadResource(uuid, texture_type);
-		APP_LOG_INFO("INITIALAZING TEXTURE: %s on component %s", std::to_string(uuid).c_str(), std::to_string(this->UUID).c_str());
-	}
-	else if(resource == ResourceType::MESH)
-	{
-		mesh_to_render = std::static_pointer_cast<Mesh>(App->resources->RetrieveFromCacheIfExist(uuid));
-		APP_LOG_INFO("INITIALAZING MESH: %s on component %s", std::to_string(uuid).c_str(), std::to_string(this->UUID).c_str());
-		if (mesh_to_render)
-		{
-			if(mesh_collider)
-			{
-				mesh_collider->InitMeshCollider();
-			}
+	this->UUID = UUID;
+	this->active = active;
 
-			return;
-		}
+	mesh_uuid = mesh_renderer_record.mesh_uuid;
+	material_uuid = mesh_renderer_record.material_uuid;
+	skeleton_uuid = mesh_renderer_record.skeleton_uuid;
+	properties = mesh_renderer_record.properties;
+	LoadResources();
 
-		FileData file_data;
-		bool succes = App->resources->RetrieveFileDataByUUID(uuid, file_data);
-		if (succes)
-		{
-			//THINK WHAT TO DO IF IS IN CACHE
-			mesh_to_render = ResourceManagement::Load<Mesh>(uuid, file_data, true);
-			//Delete file data buffer
-			delete[] file_data.buffer;
-			App->resources->AddResourceToCache(std::static_pointer_cast<Resource>(mesh_to_render));
-		
-			if (mesh_collider)
-			{
-				mesh_collider->InitMeshCollider();
-			}
-		}
-	}
+	App->scene->IndexComponent(this);
 }
 
-void ComponentMeshRenderer::InitResource(uint32_t uuid, ResourceType resource, unsigned texture_type)
+void ComponentMeshRenderer::LoadResources()
 {
-	if (resource == ResourceType::TEXTURE)
-	{
-		material_to_render->InitResource(uuid, texture_type);
-	}
-	else if (resource == ResourceType::MESH)
-	{
-		if (mesh_to_render && !mesh_to_render.get()->initialized)
-		{
-			mesh_to_render.get()->LoadInMemory();
-			owner->aabb.GenerateBoundingBox();
-		}
-	}
+	SetMesh(mesh_uuid);
+	SetMaterial(material_uuid);
+	SetSkeleton(skeleton_uuid);
 }
 
 void ComponentMeshRenderer::ReassignResource()
@@ -357,7 +319,7 @@ Component* ComponentMeshRenderer::Clone(GameObject* owner, bool original_prefab)
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 
 	if(created_component)
 	{
@@ -375,24 +337,40 @@ void ComponentMeshRenderer::CopyTo(Component* component_to_copy) const
 
 void ComponentMeshRenderer::SetMesh(uint32_t mesh_uuid)
 {
-	//Prepare multithreading loading
-	App->resources->loading_thread_communication.current_component_loading = this;
 	this->mesh_uuid = mesh_uuid;
 	if (mesh_uuid != 0)
 	{
-		App->resources->loading_thread_communication.current_type = ResourceType::MESH;
-		this->mesh_to_render = App->resources->Load<Mesh>(mesh_uuid);
+		if (App->resources->LoadsAsynchronously())
+		{
+			mesh_to_render = nullptr;
+			float3 scale = owner->transform.GetGlobalScale();
+			float priority = App->resources->GetStreamingPriority(owner->transform.GetGlobalTranslation(), scale.MaxElement());
+			App->resources->LoadAsync<Mesh>(mesh_uuid, priority).Then(this, [this](const std::shared_ptr<Mesh>& mesh)
+			{
+				// The mesh could have been changed while it was loading
+				if (mesh->GetUUID() != this->mesh_uuid)
+				{
+					return;
+				}
+
+				mesh_to_render = mesh;
+				if (mesh_collider)
+				{
+					mesh_collider->InitMeshCollider();
+				}
+				owner->aabb.GenerateBoundingBox();
+			});
+		}
+		else
+		{
+			mesh_to_render = App->resources->Load<Mesh>(mesh_uuid);
+		}
 		owner->aabb.GenerateBoundingBox();
 	}
-	
-	App->resources->loading_thread_communication.current_component_loading = nullptr;
 }
 
 void ComponentMeshRenderer::SetMaterial(uint32_t material_uuid)
 {
-	//Prepare multithreading loading
-	App->resources->loading_thread_communication.current_component_loading = this;
-
 	this->material_uuid = material_uuid;
 	if (material_uuid != 0)
 	{
@@ -402,9 +380,6 @@ void ComponentMeshRenderer::SetMaterial(uint32_t material_uuid)
 	{
 		material_to_render = App->resources->Load<Material>((uint32_t)CoreResource::DEFAULT_MATERIAL);
 	}
-
-	//Set to default loading component
-	App->resources->loading_thread_communication.current_component_loading = nullptr;
 }
 
 void ComponentMeshRenderer::SetSkeleton(uint32_t skeleton_uuid)
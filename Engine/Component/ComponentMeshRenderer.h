@@ -10,6 +10,7 @@
 #include "ResourceManagement/Resources/Material.h"
 #include "ResourceManagement/Resources/Skeleton.h"
 #include "EditorUI/Panel/InspectorSubpanel/PanelComponent.h"
+#include "ResourceManagement/Manager/SceneBinary.h"
 
 class ComponentMeshRenderer : public Component
 {
@@ -36,9 +37,8 @@ public:
 
 	void SpecializedSave(Config& config) const override;
 	void SpecializedLoad(const Config& config) override;
+	void Load(uint64_t UUID, bool active, const SceneBinary::MeshRendererRecord& mesh_renderer_record);
 
-	void LoadResource(uint32_t uuid, ResourceType resource, unsigned texture_type) override;
-	void InitResource(uint32_t uuid, ResourceType resource, unsigned texture_type) override;
 	void ReassignResource() override;
 
 	void Delete() override;
@@ -62,6 +62,8 @@ public:
 	bool CheckFilters(int filters) const;
 
 private:
+	void LoadResources();
+
 	void AddDiffuseUniforms(unsigned int shader_program) const;
 	void AddEmissiveUniforms(unsigned int shader_program) const;
 	void AddSpecularUniforms(unsigned int shader_program) const;
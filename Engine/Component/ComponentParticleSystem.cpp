@@ -505,7 +505,7 @@ Component* ComponentParticleSystem::Clone(GameObject* owner, bool original_prefa
 	*created_component = *this;
 	created_component->Init();
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	assert(billboard->emissive_intensity>-1);
 	this->billboard->CopyTo(created_component->billboard);
 	created_component->billboard->owner = owner;
@@ -40,7 +40,7 @@ Component* ComponentScript::Clone(GameObject* owner, bool original_prefab)
 	*created_component = *this;
 	CloneBase(static_cast<Component*>(created_component));
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	if(this->script) //We must have a script if copied has a script
 	{
 		created_component->script->owner = owner;
@@ -72,6 +72,10 @@ void ComponentScript::LoadName(const std::string& script_name)
 {
 	this->name = script_name;
 	script = App->scripts->CreateResourceScript(script_name, owner);
+	if (owner != nullptr)
+	{
+		owner->UpdateComponentSlots();
+	}
 }
 
 void ComponentScript::Update()
@@ -259,7 +259,7 @@ Component* ComponentText::Clone(GameObject* owner, bool original_prefab)
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 
 	created_component->ReassignResource();
 
@@ -309,15 +309,6 @@ void ComponentText::SpecializedLoad(const Config& config)
 	horizontal_alignment = static_cast<HorizontalAlignment>(horizontal_alignment_uint32);
 }
 
-void ComponentText::InitResource(uint32_t uuid, ResourceType resource)
-{
-	this->font_uuid = font_uuid;
-	App->resources->loading_thread_communication.normal_loading_flag = true;
-	font = App->resources->Load<Font>(uuid);
-	App->resources->loading_thread_communication.normal_loading_flag = false;
-	ComputeTextLines();
-}
-
 void ComponentText::ReassignResource()
 {
 	if (font_uuid != 0)
@@ -340,9 +331,7 @@ void ComponentText::SetHorizontalAlignment(HorizontalAlignment horizontal_alignm
 void ComponentText::SetFont(uint32_t font_uuid)
 {
 	this->font_uuid = font_uuid;
-	App->resources->loading_thread_communication.current_component_loading = this;
 	font = App->resources->Load<Font>(font_uuid);
-	App->resources->loading_thread_communication.current_component_loading = nullptr;
 	ComputeTextLines();
 }
 
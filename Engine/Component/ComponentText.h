@@ -34,7 +34,6 @@ public:
 	void SpecializedSave(Config& config) const override;
 	void SpecializedLoad(const Config& config) override;
 
-	void InitResource(uint32_t uuid, ResourceType resource) override;
 
 	void ReassignResource() override;
 
@@ -297,13 +297,11 @@ void ComponentTrail::SetTrailTexture(uint32_t texture_uuid)
 
 void ComponentTrail::ChangeTexture(uint32_t texture_uuid)
 {
-	App->resources->loading_thread_communication.normal_loading_flag = true;
 	if (texture_uuid != 0)
 	{
 		this->texture_uuid = texture_uuid;
 		trail_texture = App->resources->Load<Texture>(texture_uuid);
 	}
-	App->resources->loading_thread_communication.normal_loading_flag = false;
 }
 
 Component* ComponentTrail::Clone(GameObject* owner, bool original_prefab)
@@ -322,7 +320,7 @@ Component* ComponentTrail::Clone(GameObject* owner, bool original_prefab)
 	CloneBase(static_cast<Component*>(created_component));
 
 	created_component->owner = owner;
-	created_component->owner->components.push_back(created_component);
+	created_component->owner->AddComponent(created_component);
 	return created_component;
 };
 
@@ -6,6 +6,7 @@
 #include "Main/GameObject.h"
 #include "Module/ModuleEditor.h"
 #include "Helper/Utils.h"
+#include "Main/TransformHierarchy.h"
 #include <Brofiler/Brofiler.h>
 
 ComponentTransform::ComponentTransform(ComponentType transform_type) : Component(transform_type)
@@ -67,7 +68,7 @@ void ComponentTransform::SpecializedLoad(const Config& config)
 
 float3 ComponentTransform::GetGlobalTranslation() const
 {
-	return global_model_matrix.TranslatePart();
+	return GetGlobalModelMatrix().TranslatePart();
 }
 
 float3 ComponentTransform::GetTranslation() const
@@ -90,13 +91,14 @@ void ComponentTransform::Translate(const float3& translation)
 
 void ComponentTransform::SetGlobalMatrixTranslation(const float3& translation)
 {
-	global_model_matrix.SetTranslatePart(translation);
- 	SetGlobalModelMatrix(global_model_matrix);
+	float4x4 new_global_matrix = GetGlobalModelMatrix();
+	new_global_matrix.SetTranslatePart(translation);
+	SetGlobalModelMatrix(new_global_matrix);
 }
 
 Quat ComponentTransform::GetGlobalRotation() const
 {
-	return global_model_matrix.RotatePart().ToQuat();
+	return GetGlobalModelMatrix().RotatePart().ToQuat();
 }
 
 Quat ComponentTransform::GetRotation() const
@@ -146,14 +148,16 @@ void ComponentTransform::SetRotation(const Quat& new_rotation)
 
 void ComponentTransform::SetGlobalMatrixRotation(const float3x3& rotation)
 {
-	global_model_matrix.SetRotatePart(rotation);
-	SetGlobalModelMatrix(global_model_matrix);
+	float4x4 new_global_matrix = GetGlobalModelMatrix();
+	new_global_matrix.SetRotatePart(rotation);
+	SetGlobalModelMatrix(new_global_matrix);
 }
 
 void ComponentTransform::SetGlobalMatrixRotation(const Quat& rotation)
 {
-	global_model_matrix.SetRotatePart(rotation);
-	SetGlobalModelMatrix(global_model_matrix);
+	float4x4 new_global_matrix = GetGlobalModelMatrix();
+	new_global_matrix.SetRotatePart(rotation);
+	SetGlobalModelMatrix(new_global_matrix);
 }
 
 void ComponentTransform::Rotate(const Quat& rotation)
@@ -195,13 +199,12 @@ void ComponentTransform::SetScale(const float3& scale)
 
  void ComponentTransform::SetGlobalMatrixScale(const float3& scale)
 {
-	 global_model_matrix = float4x4::FromTRS(GetGlobalTranslation(), GetGlobalRotation(), scale);
-	 SetGlobalModelMatrix(global_model_matrix);
+	 SetGlobalModelMatrix(float4x4::FromTRS(GetGlobalTranslation(), GetGlobalRotation(), scale));
 }
 
 float3 ComponentTransform::GetGlobalScale() const
 {
-	return global_model_matrix.GetScale();
+	return GetGlobalModelMatrix().GetScale();
 }
 
 float3 ComponentTransform::GetUpVector() const
@@ -222,12 +225,12 @@ float3 ComponentTransform::GetRightVector() const
 
 ENGINE_API float3 ComponentTransform::GetGlobalUpVector() const
 {
-	return global_model_matrix.RotatePart() * float3::unitY;
+	return GetGlobalModelMatrix().RotatePart() * float3::unitY;
 }
 
 ENGINE_API float3 ComponentTransform::GetGlobalFrontVector() const
 {
-	return global_model_matrix.RotatePart() * float3::unitZ;
+	return GetGlobalModelMatrix().RotatePart() * float3::unitZ;
 }
 
 ENGINE_API float3 ComponentTransform::GetGlobalRightVector() const
@@ -239,12 +242,26 @@ void ComponentTransform::OnTransformChange()
 {
 	BROFILER_CATEGORY("OnTransformChange", Profiler::Color::Lavender);
 	model_matrix = float4x4::FromTRS(translation, rotation, scale);
-	GenerateGlobalModelMatrix();
+	if (hierarchy != nullptr)
+	{
+		hierarchy->OnLocalTransformChange(*this);
+	}
+	InvalidateGlobalModelMatrix();
+}
+
+void ComponentTransform::InvalidateGlobalModelMatrix()
+{
+	if (global_model_matrix_dirty)
+	{
+		return;
+	}
+
+	global_model_matrix_dirty = true;
+	owner->aabb.Invalidate();
 	for (const auto& child : owner->children)
 	{
-		child->transform.OnTransformChange();
+		child->transform.InvalidateGlobalModelMatrix();
 	}
-	owner->aabb.GenerateBoundingBox();
 }
 
 float4x4 ComponentTransform::GetModelMatrix() const
@@ -261,13 +278,33 @@ void ComponentTransform::GenerateGlobalModelMatrix()
 	}
 	else
 	{
+		owner->parent->transform.UpdateGlobalModelMatrix();
 		global_model_matrix = owner->parent->transform.global_model_matrix * model_matrix;
 	}
+	global_model_matrix_dirty = false;
+}
+
+void ComponentTransform::UpdateGlobalModelMatrix()
+{
+	if (global_model_matrix_dirty)
+	{
+		GenerateGlobalModelMatrix();
+	}
 }
 
+// Can be called from any thread, a dirty matrix is computed without being stored
 float4x4 ComponentTransform::GetGlobalModelMatrix() const
 {
-	return global_model_matrix;
+	if (!global_model_matrix_dirty)
+	{
+		return global_model_matrix;
+	}
+	return owner->parent == nullptr ? model_matrix : owner->parent->transform.GetGlobalModelMatrix() * model_matrix;
+}
+
+bool ComponentTransform::IsGlobalModelMatrixDirty() const
+{
+	return global_model_matrix_dirty;
 }
 
 void ComponentTransform::SetGlobalModelMatrix(const float4x4& new_global_matrix)
@@ -278,22 +315,22 @@ void ComponentTransform::SetGlobalModelMatrix(const float4x4& new_global_matrix)
 	}
 	else
 	{
-		model_matrix = owner->parent->transform.global_model_matrix.Inverted() * new_global_matrix;
+		model_matrix = owner->parent->transform.GetGlobalModelMatrix().Inverted() * new_global_matrix;
 	}
 
-	float3 translation, scale;
-	float3x3 rotation;
+	float3x3 new_rotation;
+	model_matrix.Decompose(translation, new_rotation, scale);
 
-	model_matrix.Decompose(translation, rotation, scale);
+	rotation = new_rotation.ToQuat();
+	rotation_radians = new_rotation.ToEulerXYZ();
+	rotation_degrees = Utils::Float3RadToDeg(rotation_radians);
 
-	SetTranslation(translation);
-	SetRotation(rotation);
-	SetScale(scale);
+	OnTransformChange();
 }
 
 void ComponentTransform::ChangeLocalSpace(const float4x4& new_local_space)
 {
-	model_matrix = new_local_space.Inverted() * global_model_matrix;
+	model_matrix = new_local_space.Inverted() * GetGlobalModelMatrix();
 	model_matrix.Decompose(translation, rotation, scale);
 	OnTransformChange();
 }
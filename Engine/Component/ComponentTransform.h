@@ -11,6 +11,7 @@
 #include <GL/glew.h>
 
 class PanelTransform;
+class TransformHierarchy;
 
 class ComponentTransform : public Component
 {
@@ -74,11 +75,15 @@ public:
 	float4x4 GetModelMatrix() const;
 
 	void GenerateGlobalModelMatrix();
+	void UpdateGlobalModelMatrix();
 	ENGINE_API float4x4 GetGlobalModelMatrix() const;
 	virtual void SetGlobalModelMatrix(const float4x4& new_global_matrix);
 
+	bool IsGlobalModelMatrixDirty() const;
+
 protected:
 	virtual void OnTransformChange();
+	void InvalidateGlobalModelMatrix();
 
 public:
 	bool has_changed = false; //used for physics
@@ -91,9 +96,18 @@ protected:
 	float3 scale = float3::one;
 
 	float4x4 model_matrix = float4x4::identity;
+
+	// Global matrix is only written on the main thread, before parallel updates and once per frame
+	// A dirty transform always has all its descendants dirty too
 	float4x4 global_model_matrix = float4x4::identity;
+	bool global_model_matrix_dirty = false;
+
+	TransformHierarchy* hierarchy = nullptr; // Batched world matrix update, only for transforms in the scene
+	size_t hierarchy_index = 0;
 
+	friend class GameObject;
 	friend class PanelTransform;
+	friend class TransformHierarchy;
 };
 
 #endif //_COMPONENTTRANSFORM_H_
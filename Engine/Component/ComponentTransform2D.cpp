@@ -134,6 +134,7 @@ void ComponentTransform2D::GenerateGlobalModelMatrix()
 	{
 		global_model_matrix = owner->parent->transform_2d.global_model_matrix * model_matrix;
 	}
+	global_model_matrix_dirty = false;
 }
 
 float4x4 ComponentTransform2D::GetSizedGlobalModelMatrix() const
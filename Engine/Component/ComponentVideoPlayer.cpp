@@ -122,15 +122,6 @@ void ComponentVideoPlayer::CopyTo(Component* component_to_copy) const
 	*static_cast<ComponentVideoPlayer*>(component_to_copy) = *this;
 }
 
-void ComponentVideoPlayer::InitResource(uint32_t uuid, ResourceType resource)
-{
-	if (video_to_render && !video_to_render.get()->initialized)
-	{
-		video_to_render.get()->LoadInMemory();
-	}
-}
-
-
 void ComponentVideoPlayer::Delete()
 {
 	App->ui->RemoveComponentUI(this);
@@ -166,29 +157,6 @@ void ComponentVideoPlayer::SpecializedLoad(const Config& config)
 	}
 }
 
-void ComponentVideoPlayer::LoadResource(uint32_t uuid, ResourceType resource)
-{
-
-	video_to_render = std::static_pointer_cast<Video>(App->resources->RetrieveFromCacheIfExist(uuid));
-
-	if (video_to_render)
-	{
-		return;
-	}
-
-	FileData file_data;
-	bool success = App->resources->RetrieveFileDataByUUID(uuid, file_data);
-	if (success)
-	{
-		//THINK WHAT TO DO IF IS IN CACHE
-		video_to_render = ResourceManagement::Load<Video>(uuid, file_data, true);
-		//Delete file data buffer
-		delete[] file_data.buffer;
-		App->resources->AddResourceToCache(std::static_pointer_cast<Resource>(video_to_render));
-	}
-
-}
-
 void ComponentVideoPlayer::ReassignResource()
 {
 	if (video_uuid != 0)
@@ -199,22 +167,14 @@ void ComponentVideoPlayer::ReassignResource()
 
 void ComponentVideoPlayer::SetVideoToRender(uint32_t video_uuid)
 {
-	//Prepare multithreading loading
-	App->resources->loading_thread_communication.current_component_loading = this;
-	App->resources->loading_thread_communication.current_type = ResourceType::VIDEO;
 	this->video_uuid = video_uuid;
 	video_to_render = App->resources->Load<Video>(video_uuid);
-
-	//Set to default loading component
-	App->resources->loading_thread_communication.current_component_loading = nullptr;
 }
 
 void ComponentVideoPlayer::SetVideoToRenderFromInspector(uint32_t video_uuid)
 {
 	this->video_uuid = video_uuid;
-	App->resources->loading_thread_communication.normal_loading_flag = true;
 	video_to_render = App->resources->Load<Video>(video_uuid);
-	App->resources->loading_thread_communication.normal_loading_flag = false;
 }
 
 void ComponentVideoPlayer::SetSoundBank(uint32_t uuid)
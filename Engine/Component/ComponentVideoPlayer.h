@@ -18,14 +18,10 @@ public:
 	Component* Clone(GameObject* owner, bool original_prefab) override;
 	void CopyTo(Component* component_to_copy) const override;
 
-	void InitResource(uint32_t uuid, ResourceType resource);
-
 	void Delete() override;
 	void SpecializedSave(Config& config) const override;
 	void SpecializedLoad(const Config& config) override;
 
-	void LoadResource(uint32_t uuid, ResourceType resource) override;
-
 	void ReassignResource() override;
 
 	void SetVideoToRender(uint32_t video_uuid);
@@ -74,6 +74,7 @@ void PanelGameObject::Render(GameObject* game_object)
 	ImGui::SameLine();
 	if (ImGui::InputText("###GameObject name Input", &game_object->name))
 	{
+		App->scene->ReindexGameObject(game_object);
 		App->actions->active_macros = false;
 		game_object->modified_by_user = true;
 	}
@@ -93,7 +94,7 @@ void PanelGameObject::Render(GameObject* game_object)
 		{
 			if (ImGui::Selectable(tag_name.c_str()))
 			{
-				game_object->tag = tag_name;
+				game_object->SetTag(tag_name);
 				game_object->modified_by_user = true;
 			}
 		}
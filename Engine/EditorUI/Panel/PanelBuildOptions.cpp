@@ -10,6 +10,7 @@
 #include "Module/ModuleTime.h"
 #include "Module/ModuleResourceManager.h"
 
+#include "ResourceManagement/Manager/SceneManager.h"
 #include "ResourceManagement/Resources/Scene.h"
 #include "ResourceManagement/Metafile/Metafile.h"
 
@@ -71,6 +72,17 @@ void PanelBuildOptions::Render()
 		}
 
 		ImGui::Separator();
+
+		if (ImGui::Button("Convert build scenes to binary"))
+		{
+			for (const auto& option : App->scene->build_options.get()->build_scenes)
+			{
+				if (!SceneManager::ConvertToBinary(option.exported_library_path))
+				{
+					APP_LOG_ERROR("Error converting %s to binary.", option.name.c_str());
+				}
+			}
+		}
 	}
 	ImGui::End();
 
@@ -1,5 +1,6 @@
 #include "Component/ComponentCamera.h"
 
+#include "Helper/JobSystem.h"
 #include "Main/Application.h"
 #include "Module/ModuleCamera.h"
 #include "Module/ModuleDebug.h"
@@ -15,6 +16,8 @@
 #include "PanelConfiguration.h"
 #include "Module/ModulePhysics.h"
 #include "Rendering/Viewport.h"
+#include "ResourceManagement/Resources/Prefab.h"
+#include "ResourceManagement/Resources/Scene.h"
 
 #include <FontAwesome5/IconsFontAwesome5.h>
 #include <GL/glew.h>
@@ -48,6 +51,33 @@ void PanelConfiguration::Render()
 		ImGui::Spacing();
 		ShowTimeOptions();
 
+		ImGui::Spacing();
+		ShowJobSystemOptions();
+
+		ImGui::Spacing();
+		ShowTransformBenchmarkOptions();
+
+		ImGui::Spacing();
+		ShowSceneLookupOptions();
+
+		ImGui::Spacing();
+		ShowComponentPoolOptions();
+
+		ImGui::Spacing();
+		ShowSceneFormatOptions();
+
+		ImGui::Spacing();
+		ShowSceneLoadingOptions();
+
+		ImGui::Spacing();
+		ShowPrefabOptions();
+
+		ImGui::Spacing();
+		ShowResourceCacheOptions();
+
+		ImGui::Spacing();
+		ShowResourceLoadingOptions();
+
 		ImGui::Spacing();
 		ShowInputOptions();
 
@@ -402,6 +432,372 @@ void PanelConfiguration::ShowTimeOptions()
 
 }
 
+void PanelConfiguration::ShowJobSystemOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_MICROCHIP " Job System"))
+	{
+		int num_threads = static_cast<int>(App->job_system->GetNumThreads());
+		if (ImGui::SliderInt("Threads", &num_threads, 1, static_cast<int>(App->job_system->GetMaxThreads())))
+		{
+			App->job_system->SetNumThreads(num_threads);
+		}
+
+		ImGui::Separator();
+
+		ImGui::DragInt("Benchmark objects", &App->debug->job_system_benchmark_objects, 1000.f, 1000, 1000000);
+		ImGui::DragInt("Benchmark frames", &App->debug->job_system_benchmark_frames, 1.f, 1, 1000);
+		if (ImGui::Button("Run benchmark"))
+		{
+			App->debug->RunJobSystemBenchmark();
+		}
+
+		const std::vector<float>& frame_times = App->debug->job_system_benchmark_frame_times;
+		if (!frame_times.empty())
+		{
+			ImGui::PlotHistogram("Frame time (ms)", &frame_times[0], frame_times.size(), 0, nullptr, 0.f, frame_times.front(), ImVec2(0, 80));
+
+			char benchmark_info[256];
+			for (size_t i = 0; i < frame_times.size(); ++i)
+			{
+				sprintf_s(benchmark_info, "%u threads: %.3f ms (%.2fx)", static_cast<unsigned int>(i + 1), frame_times[i], frame_times.front() / max(frame_times[i], 0.001f));
+				ImGui::Text(benchmark_info);
+			}
+		}
+	}
+}
+
+void PanelConfiguration::ShowTransformBenchmarkOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_ARROWS_ALT " Transform Propagation"))
+	{
+		ImGui::DragInt("Deep hierarchy depth", &App->debug->transform_benchmark_depth, 10.f, 1, 10000);
+		ImGui::DragInt("Wide hierarchy width", &App->debug->transform_benchmark_width, 10.f, 1, 10000);
+		ImGui::DragInt("Frames", &App->debug->transform_benchmark_frames, 1.f, 1, 1000);
+		if (ImGui::Button("Run transform benchmark"))
+		{
+			App->debug->RunTransformPropagationBenchmark();
+		}
+
+		ImGui::Text("Deep: eager %.3f ms, lazy %.3f ms", App->debug->transform_benchmark_deep_times[0], App->debug->transform_benchmark_deep_times[1]);
+		ImGui::Text("Wide: eager %.3f ms, lazy %.3f ms", App->debug->transform_benchmark_wide_times[0], App->debug->transform_benchmark_wide_times[1]);
+
+		ImGui::Separator();
+
+		ImGui::Checkbox("Parallel scene transform update", &App->scene->transform_hierarchy.parallel);
+		ImGui::DragInt("Hierarchy nodes", &App->debug->transform_hierarchy_benchmark_nodes, 1000.f, 1000, 1000000);
+		ImGui::DragInt("Hierarchy branching", &App->debug->transform_hierarchy_benchmark_branching, 1.f, 1, 64);
+		if (ImGui::Button("Run hierarchy benchmark"))
+		{
+			App->debug->RunTransformHierarchyBenchmark();
+		}
+
+		ImGui::Text("Batched update: one thread %.3f ms, job system %.3f ms", App->debug->transform_hierarchy_benchmark_times[0], App->debug->transform_hierarchy_benchmark_times[1]);
+	}
+}
+
+void PanelConfiguration::ShowSceneLookupOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_SEARCH " Scene Lookup"))
+	{
+		ImGui::DragInt("Lookup objects", &App->debug->scene_lookup_benchmark_objects, 1000.f, 1000, 1000000);
+		ImGui::DragInt("Lookups", &App->debug->scene_lookup_benchmark_lookups, 10.f, 1, 100000);
+		if (ImGui::Button("Run lookup benchmark"))
+		{
+			App->debug->RunSceneLookupBenchmark();
+		}
+
+		const char* lookup_names[3] = { "UUID", "Name", "Tag" };
+		for (size_t i = 0; i < 3; ++i)
+		{
+			ImGui::Text("%s: linear %.3f us, index %.3f us", lookup_names[i], App->debug->scene_lookup_benchmark_times[i][0], App->debug->scene_lookup_benchmark_times[i][1]);
+		}
+	}
+}
+
+void PanelConfiguration::ShowComponentPoolOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_CUBES " Component Pools"))
+	{
+		ImGui::DragInt("Pooled components", &App->debug->component_pool_benchmark_components, 1000.f, 100, 1000000);
+		ImGui::DragInt("Pool frames", &App->debug->component_pool_benchmark_frames, 1.f, 1, 1000);
+		if (ImGui::Button("Run component pool benchmark"))
+		{
+			App->debug->RunComponentPoolBenchmark();
+		}
+
+		ImGui::Text("Allocations: new %zu, pool %zu", App->debug->component_pool_benchmark_allocations[0], App->debug->component_pool_benchmark_allocations[1]);
+		const char* operation_names[3] = { "Create", "Iterate", "Remove 1%" };
+		for (size_t i = 0; i < 3; ++i)
+		{
+			ImGui::Text("%s: new %.3f ms, pool %.3f ms", operation_names[i], App->debug->component_pool_benchmark_times[i][0], App->debug->component_pool_benchmark_times[i][1]);
+		}
+	}
+}
+
+void PanelConfiguration::ShowSceneFormatOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_FILE " Scene Format"))
+	{
+		ImGui::DragInt("Scene game objects", &App->debug->scene_format_benchmark_objects, 1000.f, 1, 1000000);
+		if (ImGui::Button("Run scene format benchmark"))
+		{
+			App->debug->RunSceneFormatBenchmark();
+		}
+
+		ImGui::Text("Size: JSON %zu bytes, binary %zu bytes", App->debug->scene_format_benchmark_sizes[0], App->debug->scene_format_benchmark_sizes[1]);
+		ImGui::Text("Load: JSON %.3f ms, binary %.3f ms", App->debug->scene_format_benchmark_times[0], App->debug->scene_format_benchmark_times[1]);
+
+		ImGui::Separator();
+		ImGui::DragInt("Config game objects", &App->debug->config_benchmark_objects, 1000.f, 1, 1000000);
+		if (ImGui::Button("Run config benchmark"))
+		{
+			App->debug->RunConfigBenchmark();
+		}
+
+		ImGui::Text("Documents: copies %zu, views %zu", App->debug->config_benchmark_documents[0], App->debug->config_benchmark_documents[1]);
+		ImGui::Text("Allocated: copies %zu KB, views %zu KB", App->debug->config_benchmark_bytes[0] / 1024, App->debug->config_benchmark_bytes[1] / 1024);
+		ImGui::Text("Load: copies %.3f ms, views %.3f ms", App->debug->config_benchmark_times[0], App->debug->config_benchmark_times[1]);
+
+		ImGui::Separator();
+		ImGui::DragInt("Deserialized game objects", &App->debug->scene_deserialization_benchmark_objects, 1000.f, 1, 1000000);
+		if (ImGui::Button("Run deserialization benchmark"))
+		{
+			App->debug->RunSceneDeserializationBenchmark();
+		}
+
+		ImGui::Text("Threads: %zu", App->debug->scene_deserialization_benchmark_threads);
+		const char* format_names[2] = { "JSON", "Binary" };
+		for (size_t i = 0; i < 2; ++i)
+		{
+			float speedup = App->debug->scene_deserialization_benchmark_times[i][1] > 0.f ? App->debug->scene_deserialization_benchmark_times[i][0] / App->debug->scene_deserialization_benchmark_times[i][1] : 0.f;
+			ImGui::Text("%s parse: one thread %.3f ms, job system %.3f ms (x%.2f)", format_names[i], App->debug->scene_deserialization_benchmark_times[i][0], App->debug->scene_deserialization_benchmark_times[i][1], speedup);
+		}
+
+		ImGui::Separator();
+		ImGui::DragInt("Saved game objects", &App->debug->scene_save_benchmark_objects, 1000.f, 1, 1000000);
+		if (ImGui::Button("Run save benchmark"))
+		{
+			App->debug->RunSceneSaveBenchmark();
+		}
+		ImGui::SameLine();
+		HelpMarker("Peak working set growth is process wide and only shows what a save needs beyond the previous peak. Use enough game objects to go past it.");
+
+		ImGui::Text("Streamed output identical: %s", App->debug->scene_save_benchmark_identical ? "yes" : "no");
+		ImGui::Text("Save: document %.3f ms, streamed JSON %.3f ms, streamed binary %.3f ms", App->debug->scene_save_benchmark_times[0], App->debug->scene_save_benchmark_times[1], App->debug->scene_save_benchmark_times[2]);
+		ImGui::Text("Peak growth: document %zu KB, streamed JSON %zu KB, streamed binary %zu KB", App->debug->scene_save_benchmark_peak_growth[0] / 1024, App->debug->scene_save_benchmark_peak_growth[1] / 1024, App->debug->scene_save_benchmark_peak_growth[2] / 1024);
+	}
+}
+
+void PanelConfiguration::ShowSceneLoadingOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_SPINNER " Scene Loading"))
+	{
+		ImGui::DragFloat("Budget per frame (ms)", &App->scene->scene_loading_budget_ms, 0.1f, 0.1f, 100.f);
+		ImGui::SameLine();
+		HelpMarker("Time spent instantiating the scene being loaded every frame. Scripts and physics wait until the whole scene is loaded.");
+		ImGui::ProgressBar(App->scene->IsLoadingScene() ? App->scene->GetSceneLoadingProgress() : 1.f);
+
+		if (App->scene->current_scene != nullptr && !App->scene->IsLoadingScene())
+		{
+			const Scene::PrefetchStats& prefetch_stats = App->scene->current_scene->GetPrefetchStats();
+			ImGui::Separator();
+			ImGui::Text("Last load: %.3f ms", prefetch_stats.load_time_ms);
+			ImGui::Text("Prefetched %zu resources from the %s", prefetch_stats.resources, prefetch_stats.from_manifest ? "manifest" : "components");
+			ImGui::SameLine();
+			HelpMarker("Scenes saved with a dependency manifest start reading every resource before their game objects are parsed.");
+			ImGui::Text("File reads: %.3f ms off the main thread, %.3f ms waited", prefetch_stats.off_critical_path_ms, prefetch_stats.wait_time_ms);
+		}
+
+		WorldPartition& world_partition = App->scene->world_partition;
+		ImGui::Separator();
+		ImGui::Checkbox("World partition", &world_partition.enabled);
+		ImGui::SameLine();
+		HelpMarker("Top level static game objects are saved to streaming cells. While playing, cells load around the main camera or the streaming focus points.");
+		ImGui::DragFloat("Cell size", &world_partition.cell_size, 1.f, 1.f, 10000.f);
+		ImGui::DragFloat("Load radius", &world_partition.load_radius, 1.f, 0.f, 100000.f);
+		ImGui::DragFloat("Unload radius", &world_partition.unload_radius, 1.f, world_partition.load_radius, 100000.f);
+		ImGui::DragFloat("Cell budget per frame (ms)", &world_partition.budget_ms, 0.1f, 0.1f, 100.f);
+		ImGui::Text("Cells: %zu loaded, %zu loading, %zu total", world_partition.GetNumCells(WorldPartition::CellState::LOADED), world_partition.GetNumCells(WorldPartition::CellState::READING) + world_partition.GetNumCells(WorldPartition::CellState::INSTANTIATING), world_partition.GetNumCells());
+		ImGui::Text("Last update: %.3f ms, %zu cells loaded or unloaded", world_partition.last_update_ms, world_partition.last_update_cells);
+	}
+}
+
+void PanelConfiguration::ShowPrefabOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_CUBES " Prefabs"))
+	{
+		ImGui::DragInt("Spawned instances", &App->debug->prefab_spawn_benchmark_instances, 10.f, 1, 100000);
+		if (ImGui::Button("Run spawn benchmark"))
+		{
+			App->debug->RunPrefabSpawnBenchmark();
+		}
+		ImGui::SameLine();
+		HelpMarker("Spawns instances of the prefab selected in the hierarchy and removes them after each run.");
+
+		ImGui::Text("Scripts in the scene: %zu", App->debug->prefab_spawn_benchmark_scripts);
+		ImGui::Text("Spawn: relinking the scene %.3f ms, one by one %.3f ms, batch %.3f ms", App->debug->prefab_spawn_benchmark_times[0], App->debug->prefab_spawn_benchmark_times[1], App->debug->prefab_spawn_benchmark_times[2]);
+
+		ImGui::Separator();
+		ImGui::DragInt("Churned instances", &App->debug->prefab_pool_benchmark_instances, 10.f, 1, 100000);
+		ImGui::DragInt("Churn frames", &App->debug->prefab_pool_benchmark_frames, 1.f, 1, 1000);
+		ImGui::DragInt("Warmed up instances", &App->debug->prefab_pool_benchmark_warmup, 10.f, 0, 100000);
+		if (ImGui::Button("Run pool benchmark"))
+		{
+			App->debug->RunPrefabPoolBenchmark();
+		}
+		ImGui::SameLine();
+		HelpMarker("Every frame spawns every instance and despawns them all, first instantiating and destroying them and then through a pool.");
+
+		ImGui::Text("Hit rate: %.1f%%", 100.f * App->debug->prefab_pool_benchmark_hit_rate);
+		ImGui::Text("Frame: instantiate and destroy %.3f ms, pool %.3f ms", App->debug->prefab_pool_benchmark_times[0], App->debug->prefab_pool_benchmark_times[1]);
+
+		if (!App->scene->prefab_pools.empty())
+		{
+			ImGui::Separator();
+			for (const auto& prefab_pool : App->scene->prefab_pools)
+			{
+				const PrefabPool& pool = *prefab_pool.second;
+				ImGui::Text("%s: %zu spawned, %zu parked (warmup %zu), hit rate %.1f%%", pool.GetPrefab()->GetRootGameObject()->name.c_str(), pool.GetNumSpawned(), pool.GetNumParked(), pool.warmup_count, 100.f * pool.GetHitRate());
+			}
+		}
+	}
+}
+
+void PanelConfiguration::ShowResourceCacheOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_DATABASE " Resource Cache"))
+	{
+		ResourceCache& resource_cache = App->resources->resource_cache;
+		int budget_mb = static_cast<int>(resource_cache.GetBudget() / (1024 * 1024));
+		if (ImGui::DragInt("Budget (MB)", &budget_mb, 16.f, 16, 65536))
+		{
+			resource_cache.SetBudget(static_cast<size_t>(budget_mb) * 1024 * 1024);
+		}
+		ImGui::SameLine();
+		HelpMarker("Over the budget, the least recently used resources that nothing else holds are evicted.");
+
+		ResourceCache::Stats stats = resource_cache.GetStats();
+		size_t lookups = stats.hits + stats.misses;
+		ImGui::Text("%zu resources, %.1f MB", stats.resources, stats.memory / (1024.f * 1024.f));
+		ImGui::Text("Hits: %zu Misses: %zu Hit rate: %.1f%%", stats.hits, stats.misses, lookups > 0 ? 100.f * stats.hits / lookups : 0.f);
+		ImGui::Text("Evictions: %zu, %.1f MB", stats.evictions, stats.evicted_memory / (1024.f * 1024.f));
+		if (ImGui::Button("Reset counters"))
+		{
+			resource_cache.ResetCounters();
+		}
+
+		ImGui::Separator();
+		for (const auto& type_stats : stats.types)
+		{
+			if (type_stats.second.resources > 0)
+			{
+				ImGui::Text("%s: %zu resources, %.1f MB", Resource::GetResourceTypeName(type_stats.first).c_str(), type_stats.second.resources, type_stats.second.memory / (1024.f * 1024.f));
+			}
+		}
+
+		ImGui::Separator();
+		ImGui::DragInt("Cached resources", &App->debug->resource_cache_benchmark_resources, 100.f, 1, 1000000);
+		ImGui::DragInt("Lookups", &App->debug->resource_cache_benchmark_lookups, 1000.f, 1, 10000000);
+		ImGui::DragInt("Budget (%)", &App->debug->resource_cache_benchmark_budget, 1.f, 1, 100);
+		if (ImGui::Button("Run resource cache benchmark"))
+		{
+			App->debug->RunResourceCacheBenchmark();
+		}
+		ImGui::SameLine();
+		HelpMarker("Looks up standalone resources by UUID scanning a vector and through the hash cache, then looks them up again with a budget that only fits part of them.");
+
+		ImGui::Text("Lookup: linear %.3f us, hash %.3f us", App->debug->resource_cache_benchmark_times[0], App->debug->resource_cache_benchmark_times[1]);
+		ImGui::Text("Under budget: hit rate %.1f%%, %zu evictions", 100.f * App->debug->resource_cache_benchmark_hit_rate, App->debug->resource_cache_benchmark_evictions);
+	}
+}
+
+void PanelConfiguration::ShowResourceLoadingOptions()
+{
+	if (ImGui::CollapsingHeader(ICON_FA_TRUCK_LOADING " Resource Loading"))
+	{
+		ResourceLoader& resource_loader = App->resources->resource_loader;
+		int num_threads = static_cast<int>(resource_loader.GetNumThreads());
+		if (ImGui::SliderInt("Loader threads", &num_threads, 1, 8))
+		{
+			App->resources->num_loader_threads = static_cast<size_t>(num_threads);
+			resource_loader.SetNumThreads(App->resources->num_loader_threads);
+		}
+		ImGui::SameLine();
+		HelpMarker("Textures and meshes requested while a scene loads in game are decoded by these threads, which sleep while there is nothing to load. The main thread uploads them.");
+
+		float aging = resource_loader.GetAging();
+		if (ImGui::DragFloat("Priority aging per second", &aging, 0.1f, 0.f, 100.f))
+		{
+			resource_loader.SetAging(aging);
+		}
+		ImGui::SameLine();
+		HelpMarker("Queued loads are decoded by priority, a load gains this much priority for every second it waits so low priorities never starve.");
+		ImGui::DragFloat("Streaming priority scale", &App->resources->streaming_priority_scale, 0.1f, 0.f, 100.f);
+		ImGui::SameLine();
+		HelpMarker("Priority of what fills the screen. Meshes and billboards get it scaled by their screen size as seen from the main camera, the UI gets all of it.");
+
+		ImGui::Text("Loads: %zu in flight, %zu queued, %zu decoded, %zu cancelled", App->resources->GetNumAsyncLoads(), resource_loader.GetNumQueued(), resource_loader.GetNumDecoded(), App->resources->cancelled_async_loads);
+		ImGui::Text("Scene resources: %d of %d loaded", static_cast<int>(App->resources->loading_thread_communication.current_number_of_resources_loaded), static_cast<int>(App->resources->loading_thread_communication.total_number_of_resources_to_load));
+
+		ImGui::Separator();
+		ImGui::DragFloat("Finish budget per frame (ms)", &App->resources->finish_budget_ms, 0.1f, 0.1f, 33.f);
+		ImGui::SameLine();
+		HelpMarker("Main thread time spent uploading decoded resources each frame. Uploads that do not fit are split across frames, at least one step is made every frame.");
+
+		const ModuleResourceManager::FinishStats& finish_stats = App->resources->finish_stats;
+		ImGui::Text("Backlog: %zu decoded loads", finish_stats.backlog);
+		ImGui::Text("Last frame: %zu loads, %.1f KB, %.3f ms (max %.3f ms)", finish_stats.loads, finish_stats.uploaded_bytes / 1024.f, finish_stats.time_ms, finish_stats.max_time_ms);
+		ImGui::Text("Finished: %zu loads, %zu split across frames", finish_stats.total_loads, finish_stats.split_loads);
+		if (ImGui::Button("Reset max time"))
+		{
+			App->resources->finish_stats.max_time_ms = 0.f;
+		}
+
+		if (ImGui::TreeNode("Estimated costs"))
+		{
+			for (const auto& finish_cost : App->resources->finish_costs)
+			{
+				ImGui::Text("%s: %.3f ms per MB, %.3f ms per load", Resource::GetResourceTypeName(finish_cost.first).c_str(), finish_cost.second.ms_per_megabyte, finish_cost.second.ms_per_load);
+			}
+			ImGui::TreePop();
+		}
+
+		ImGui::Separator();
+		const ResourceLoadGraph::Stats& load_graph_stats = App->resources->load_graph_stats;
+		ImGui::Text("Last load graph: %zu resources, %zu decoded in parallel, %.3f ms", load_graph_stats.resources, load_graph_stats.decoded_in_parallel, load_graph_stats.time_ms);
+		ImGui::SameLine();
+		HelpMarker("Materials and prefabs loaded outside of async scene loading decode their dependencies at the same time on the loader threads, and complete once those are complete.");
+		ImGui::Text("Dependencies: %zu, %zu shared, %zu cycles", load_graph_stats.dependencies, load_graph_stats.shared_dependencies, load_graph_stats.cycles);
+
+		ImGui::Separator();
+		if (ImGui::Button("Run texture upload check"))
+		{
+			App->debug->RunTextureUploadCheck();
+		}
+		ImGui::SameLine();
+		HelpMarker("Uploads an RGB texture with rows that are not a multiple of 4 bytes one row per step and compares what the GPU holds with its pixels.");
+		if (App->debug->texture_upload_check_result >= 0)
+		{
+			ImGui::Text("Split upload: %s", App->debug->texture_upload_check_result == 1 ? "identical" : "different");
+		}
+
+		ImGui::Separator();
+		ImGui::DragInt("Simulated loads", &App->debug->resource_priority_benchmark_loads, 100.f, 1, 100000);
+		ImGui::SliderInt("Simulated loader threads", &App->debug->resource_priority_benchmark_threads, 1, 8);
+		ImGui::DragFloat("Simulated decode (ms)", &App->debug->resource_priority_benchmark_decode_ms, 0.01f, 0.01f, 10.f);
+		ImGui::DragFloat("Simulated aging per second", &App->debug->resource_priority_benchmark_aging, 0.1f, 0.f, 100.f);
+		if (ImGui::Button("Run resource priority benchmark"))
+		{
+			App->debug->RunResourcePriorityBenchmark();
+		}
+		ImGui::SameLine();
+		HelpMarker("Queues loads of random priorities from 0 to 10 in bursts faster than a standalone loader decodes them, once all with the same priority and once with theirs. Checks every load that started while a higher priority one waited had aged enough to overtake it.");
+
+		ImGui::Text("Top priority wait: FIFO %.3f ms (max %.3f ms), priority %.3f ms (max %.3f ms)", App->debug->resource_priority_benchmark_waits[0][0], App->debug->resource_priority_benchmark_waits[0][1], App->debug->resource_priority_benchmark_waits[1][0], App->debug->resource_priority_benchmark_waits[1][1]);
+		ImGui::Text("Inversions: %zu, %zu unbounded, longest %.3f ms", App->debug->resource_priority_benchmark_inversions, App->debug->resource_priority_benchmark_unbounded_inversions, App->debug->resource_priority_benchmark_max_inversion_ms);
+	}
+}
+
 void PanelConfiguration::ShowInputOptions()
 {
 	if (ImGui::CollapsingHeader(ICON_FA_KEYBOARD " Input"))
@@ -22,6 +22,15 @@ private:
 	void ShowRenderOptions(); 
 	void ShowPostProcessingOptions() const;
 	void ShowTimeOptions();
+	void ShowJobSystemOptions();
+	void ShowTransformBenchmarkOptions();
+	void ShowSceneLookupOptions();
+	void ShowComponentPoolOptions();
+	void ShowSceneFormatOptions();
+	void ShowSceneLoadingOptions();
+	void ShowPrefabOptions();
+	void ShowResourceCacheOptions();
+	void ShowResourceLoadingOptions();
 	void ShowInputOptions();
 	void ShowPhysicsOptions();
 	void ShowSpacePartitioningOptions();
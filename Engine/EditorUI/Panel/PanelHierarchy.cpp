@@ -430,21 +430,21 @@ void PanelHierarchy::ShowComponentObjectCreationMenu(GameObject* game_object) co
 		if (ImGui::Selectable("Point Light"))
 		{
 			created_game_object = App->scene->CreateGameObject();
-			created_game_object->name = "Point Light";
+			created_game_object->SetName("Point Light");
 			ComponentLight* point_light_component = static_cast<ComponentLight*>(created_game_object->CreateComponent(Component::ComponentType::LIGHT));
 			point_light_component->light_type = ComponentLight::LightType::POINT_LIGHT;
 		}
 		if (ImGui::Selectable("Spot Light"))
 		{
 			created_game_object = App->scene->CreateGameObject();
-			created_game_object->name = "Spot Light";
+			created_game_object->SetName("Spot Light");
 			ComponentLight* spot_light_component = static_cast<ComponentLight*>(created_game_object->CreateComponent(Component::ComponentType::LIGHT));
 			spot_light_component->light_type = ComponentLight::LightType::SPOT_LIGHT;
 		}
 		if (ImGui::Selectable("Directional Light"))
 		{
 			created_game_object = App->scene->CreateGameObject();
-			created_game_object->name = "Directional Light";
+			created_game_object->SetName("Directional Light");
 			ComponentLight* directional_light_component = static_cast<ComponentLight*>(created_game_object->CreateComponent(Component::ComponentType::LIGHT));
 			directional_light_component->light_type = ComponentLight::LightType::DIRECTIONAL_LIGHT;
 		}
@@ -457,14 +457,14 @@ void PanelHierarchy::ShowComponentObjectCreationMenu(GameObject* game_object) co
 		if (ImGui::Selectable("Particle System"))
 		{
 			created_game_object = App->scene->CreateGameObject();
-			created_game_object->name = "Particle System";
+			created_game_object->SetName("Particle System");
 			ComponentParticleSystem* particle_system_component = static_cast<ComponentParticleSystem*>(created_game_object->CreateComponent(Component::ComponentType::PARTICLE_SYSTEM));
 		}
 
 		if (ImGui::Selectable("Trail"))
 		{
 			GameObject* created_game_object = App->scene->CreateGameObject();
-			created_game_object->name = "Trail";
+			created_game_object->SetName("Trail");
 			created_game_object->CreateComponent(Component::ComponentType::TRAIL);
 		}
 
@@ -474,7 +474,7 @@ void PanelHierarchy::ShowComponentObjectCreationMenu(GameObject* game_object) co
 	if (ImGui::Selectable("Camera"))
 	{
 		created_game_object = App->scene->CreateGameObject();
-		created_game_object->name = "Camera";
+		created_game_object->SetName("Camera");
 		created_game_object->CreateComponent(Component::ComponentType::CAMERA);
 	}
 
@@ -164,7 +164,7 @@ void PanelMenuBar::ShowGameObjectMenu()
 			if (ImGui::Selectable("Point Light"))
 			{
 				GameObject* created_game_object = App->scene->CreateGameObject();
-				created_game_object->name = "Point Light";
+				created_game_object->SetName("Point Light");
 				created_game_object->CreateComponent(Component::ComponentType::LIGHT);
 			}
 
@@ -176,14 +176,14 @@ void PanelMenuBar::ShowGameObjectMenu()
 			if (ImGui::Selectable("Particle System"))
 			{
 				GameObject* created_game_object = App->scene->CreateGameObject();
-				created_game_object->name = "Particle System";
+				created_game_object->SetName("Particle System");
 				created_game_object->CreateComponent(Component::ComponentType::PARTICLE_SYSTEM);
 			}
 
 			if (ImGui::Selectable("Trail"))
 			{
 				GameObject* created_game_object = App->scene->CreateGameObject();
-				created_game_object->name = "Trail";
+				created_game_object->SetName("Trail");
 				created_game_object->CreateComponent(Component::ComponentType::TRAIL);
 			}
 
@@ -193,7 +193,7 @@ void PanelMenuBar::ShowGameObjectMenu()
 		if (ImGui::Selectable("Camera"))
 		{
 			GameObject* created_game_object = App->scene->CreateGameObject();
-			created_game_object->name = "Camera";
+			created_game_object->SetName("Camera");
 			created_game_object->CreateComponent(Component::ComponentType::CAMERA);
 		}
 
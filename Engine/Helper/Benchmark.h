@@ -0,0 +1,64 @@
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+/*
+	Timing shared by the ModuleDebug benchmarks, so every benchmark only describes the work it compares.
+	Wall time through the high resolution clock, Timer only has millisecond ticks.
+*/
+class Benchmark
+{
+public:
+	using Clock = std::chrono::high_resolution_clock;
+
+	static float ElapsedMs(const Clock::time_point& start)
+	{
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+
+	template<typename Function>
+	static float TimeMs(Function&& function)
+	{
+		Clock::time_point start = Clock::now();
+		function();
+		return ElapsedMs(start);
+	}
+
+	// Average time in ms of calling function(run) num_runs times, for per frame timings
+	template<typename Function>
+	static float AverageMs(size_t num_runs, Function&& function)
+	{
+		Clock::time_point start = Clock::now();
+		for (size_t run = 0; run < num_runs; ++run)
+		{
+			function(run);
+		}
+		return num_runs > 0 ? ElapsedMs(start) / num_runs : 0.f;
+	}
+
+	// Average time in us of looking up every key, every lookup is expected to find something
+	template<typename Key, typename Lookup>
+	static float AverageLookupUs(const std::vector<Key>& keys, Lookup&& lookup)
+	{
+		size_t found = 0;
+		Clock::time_point start = Clock::now();
+		for (const auto& key : keys)
+		{
+			found += lookup(key) != nullptr ? 1 : 0;
+		}
+		float elapsed_us = std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+		assert(found == keys.size());
+		return keys.empty() ? 0.f : elapsed_us / keys.size();
+	}
+
+	static float Speedup(float before_ms, float after_ms)
+	{
+		return after_ms > 0.f ? before_ms / after_ms : 0.f;
+	}
+};
+
+#endif // _BENCHMARK_H_
@@ -0,0 +1,166 @@
+#ifndef _COMPONENTPOOL_H_
+#define _COMPONENTPOOL_H_
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/*
+	Handle to a pooled component. The generation changes every time its slot is freed,
+	so handles to destroyed components resolve to nullptr instead of to whatever reused the slot.
+*/
+struct ComponentHandle
+{
+	static const uint32_t INVALID_INDEX = UINT32_MAX;
+
+	uint32_t index = INVALID_INDEX;
+	uint32_t generation = 0;
+
+	bool operator==(const ComponentHandle& other) const { return index == other.index && generation == other.generation; }
+	bool operator!=(const ComponentHandle& other) const { return !(*this == other); }
+};
+
+/*
+	Storage for every component of one type.
+	Components are constructed in fixed size pages, so they never move and a page allocation is shared by PAGE_SIZE components.
+	A dense array of live components is kept for iteration, removal swaps the last element into the hole.
+	T must expose a uint32_t pool_index member, the pool writes the component slot there.
+*/
+template<typename T, size_t PAGE_SIZE = 256>
+class ComponentPool
+{
+public:
+	ComponentPool() = default;
+	~ComponentPool() { Clear(); }
+
+	ComponentPool(const ComponentPool& pool_to_copy) = delete;
+	ComponentPool& operator=(const ComponentPool& pool_to_copy) = delete;
+
+	template<typename... Args>
+	T* Create(Args&&... args)
+	{
+		uint32_t index;
+		if (free_slots.empty())
+		{
+			index = static_cast<uint32_t>(slot_count++);
+			if (index / PAGE_SIZE >= pages.size())
+			{
+				pages.emplace_back(new Slot[PAGE_SIZE]);
+				++num_allocations;
+			}
+		}
+		else
+		{
+			index = free_slots.back();
+			free_slots.pop_back();
+		}
+
+		Slot& slot = GetSlot(index);
+		T* component = new (slot.storage) T(std::forward<Args>(args)...);
+		component->pool_index = index;
+		slot.alive = true;
+		slot.dense_index = static_cast<uint32_t>(dense.size());
+		dense.push_back(component);
+		return component;
+	}
+
+	// Returns false when the component was not created by this pool, callers keep ownership in that case
+	bool Destroy(T* component)
+	{
+		if (!Contains(component))
+		{
+			return false;
+		}
+
+		const uint32_t index = component->pool_index;
+		Slot& slot = GetSlot(index);
+
+		T* last_component = dense.back();
+		dense[slot.dense_index] = last_component;
+		GetSlot(last_component->pool_index).dense_index = slot.dense_index;
+		dense.pop_back();
+
+		component->~T();
+		slot.alive = false;
+		++slot.generation;
+		free_slots.push_back(index);
+		return true;
+	}
+
+	void Clear()
+	{
+		while (!dense.empty())
+		{
+			Destroy(dense.back());
+		}
+	}
+
+	bool Contains(const T* component) const
+	{
+		if (component == nullptr || component->pool_index >= slot_count)
+		{
+			return false;
+		}
+		const Slot& slot = GetSlot(component->pool_index);
+		return slot.alive && reinterpret_cast<const T*>(slot.storage) == component;
+	}
+
+	ComponentHandle GetHandle(const T* component) const
+	{
+		if (!Contains(component))
+		{
+			return ComponentHandle();
+		}
+		return ComponentHandle{ component->pool_index, GetSlot(component->pool_index).generation };
+	}
+
+	T* Get(const ComponentHandle& handle) const
+	{
+		if (handle.index >= slot_count)
+		{
+			return nullptr;
+		}
+		const Slot& slot = GetSlot(handle.index);
+		if (!slot.alive || slot.generation != handle.generation)
+		{
+			return nullptr;
+		}
+		return reinterpret_cast<T*>(const_cast<unsigned char*>(slot.storage));
+	}
+
+	const std::vector<T*>& GetComponents() const { return dense; }
+
+	typename std::vector<T*>::const_iterator begin() const { return dense.begin(); }
+	typename std::vector<T*>::const_iterator end() const { return dense.end(); }
+	T* operator[](size_t i) const { return dense[i]; }
+	size_t size() const { return dense.size(); }
+	bool empty() const { return dense.empty(); }
+
+	size_t GetCapacity() const { return pages.size() * PAGE_SIZE; }
+	size_t GetNumAllocations() const { return num_allocations; }
+
+private:
+	struct Slot
+	{
+		alignas(T) unsigned char storage[sizeof(T)];
+		uint32_t generation = 0;
+		uint32_t dense_index = 0;
+		bool alive = false;
+	};
+
+	Slot& GetSlot(uint32_t index) { return pages[index / PAGE_SIZE][index % PAGE_SIZE]; }
+	const Slot& GetSlot(uint32_t index) const { return pages[index / PAGE_SIZE][index % PAGE_SIZE]; }
+
+private:
+	std::vector<std::unique_ptr<Slot[]>> pages;
+	std::vector<uint32_t> free_slots;
+	std::vector<T*> dense;
+
+	size_t slot_count = 0;
+	size_t num_allocations = 0;
+};
+
+#endif // _COMPONENTPOOL_H_
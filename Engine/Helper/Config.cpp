@@ -4,23 +4,46 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/prettywriter.h>
 
+#include <cstring>
+
 Config::Config()
 {
 	config_document.SetObject();
 	allocator = &config_document.GetAllocator();
 }
 
-Config::Config(FileData & data)
+Config::Config(FileData & data) : insitu_buffer(static_cast<char*>(const_cast<void*>(data.buffer)))
+{
+	// File::Load null terminates its buffers, the Config takes ownership of it and parses it in place
+	data.buffer = nullptr;
+	if (insitu_buffer)
+	{
+		config_document.ParseInsitu(insitu_buffer.get());
+	}
+	else
+	{
+		config_document.SetObject();
+	}
+	allocator = &config_document.GetAllocator();
+}
+
+Config::Config(const char* serialized_data, size_t size) : insitu_buffer(new char[size + 1])
 {
-	std::string serialized_string((char*)data.buffer, data.size);
-	delete[] data.buffer;
-	config_document.Parse(serialized_string.c_str());
+	memcpy(insitu_buffer.get(), serialized_data, size);
+	insitu_buffer[size] = '\0';
+	config_document.ParseInsitu(insitu_buffer.get());
 	allocator = &config_document.GetAllocator();
 }
 
 Config::Config(const rapidjson::Value& object_value)
 {
-	config_document.CopyFrom(object_value, config_document.GetAllocator());
+	config_document.CopyFrom(object_value, config_document.GetAllocator(), true);
+	allocator = &config_document.GetAllocator();
+}
+
+Config::Config(const rapidjson::Value& object_value, rapidjson::Document::AllocatorType& parent_allocator) : config_document(&parent_allocator, 0), view(&object_value)
+{
+	allocator = &parent_allocator;
 }
 
 Config::Config(const std::string& serialized_scene_string)
@@ -31,14 +54,32 @@ Config::Config(const std::string& serialized_scene_string)
 
 Config::Config(const Config& other)
 {
-	config_document.CopyFrom(other.config_document, config_document.GetAllocator());
+	config_document.CopyFrom(other.GetValue(), config_document.GetAllocator(), true);
 	allocator = &config_document.GetAllocator();
 }
 
+Config::Config(Config&& other) noexcept : config_document(std::move(other.config_document)), view(other.view), insitu_buffer(std::move(other.insitu_buffer))
+{
+	allocator = other.allocator;
+	other.view = nullptr;
+}
+
 Config& Config::operator=(const Config& other)
 {
-	config_document.CopyFrom(other.config_document, config_document.GetAllocator());
-	allocator = &config_document.GetAllocator();
+	if (this != &other)
+	{
+		*this = Config(other);
+	}
+	return *this;
+}
+
+Config& Config::operator=(Config&& other) noexcept
+{
+	config_document = std::move(other.config_document);
+	allocator = other.allocator;
+	view = other.view;
+	insitu_buffer = std::move(other.insitu_buffer);
+	other.view = nullptr;
 	return *this;
 }
 
@@ -47,132 +88,126 @@ rapidjson::Document::AllocatorType& Config::GetAllocator() const
 	return *allocator;
 }
 
-void Config::AddInt(int value_to_add, const std::string &name)
+const rapidjson::Value& Config::GetValue() const
 {
-	rapidjson::Value member_name(name.c_str(), *allocator);
-	config_document.AddMember(member_name, value_to_add, *allocator);
+	return view != nullptr ? *view : config_document;
 }
 
-int Config::GetInt(const std::string& name, int opt_value) const
+bool Config::IsView() const
 {
-	if (!config_document.HasMember(name.c_str()))
-	{
-		return opt_value;
-	}
-	else
+	return view != nullptr;
+}
+
+bool Config::HasMember(std::string_view name) const
+{
+	return FindMember(name) != nullptr;
+}
+
+const rapidjson::Value* Config::FindMember(std::string_view name) const
+{
+	const rapidjson::Value& value = GetValue();
+	if (!value.IsObject())
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
-		return current_value.GetInt();
+		return nullptr;
 	}
+
+	// Lookup key referencing the caller's characters, nothing is allocated per access
+	rapidjson::Value member_name(rapidjson::StringRef(name.data(), static_cast<rapidjson::SizeType>(name.size())));
+	auto member = value.FindMember(member_name);
+	return member == value.MemberEnd() ? nullptr : &member->value;
+}
+
+void Config::AddMember(rapidjson::Value& member_name, rapidjson::Value& member_value)
+{
+	assert(!IsView());
+	config_document.AddMember(member_name, member_value, *allocator);
+}
+
+void Config::AddInt(int value_to_add, const std::string &name)
+{
+	rapidjson::Value member_name(name.c_str(), *allocator);
+	AddMember(member_name, value_to_add);
+}
+
+int Config::GetInt(std::string_view name, int opt_value) const
+{
+	const rapidjson::Value* current_value = FindMember(name);
+	return current_value != nullptr ? current_value->GetInt() : opt_value;
 }
 
 void Config::AddUInt(uint64_t value_to_add, const std::string& name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
-	config_document.AddMember(member_name, value_to_add, *allocator);
+	AddMember(member_name, value_to_add);
 }
 
-uint64_t Config::GetUInt(const std::string& name, unsigned int opt_value) const
+uint64_t Config::GetUInt(std::string_view name, unsigned int opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
-	{
-		return opt_value;
-	}
-	else
-	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
-		return current_value.GetUint64();
-	}
+	const rapidjson::Value* current_value = FindMember(name);
+	return current_value != nullptr ? current_value->GetUint64() : opt_value;
 }
 ENGINE_API void Config::AddUInt32(uint32_t value_to_add, const std::string & name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
-	config_document.AddMember(member_name, value_to_add, *allocator);
+	AddMember(member_name, value_to_add);
 }
-ENGINE_API uint32_t Config::GetUInt32(const std::string & name, unsigned int opt_value) const
+ENGINE_API uint32_t Config::GetUInt32(std::string_view name, unsigned int opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
-	{
-		return opt_value;
-	}
-	else
-	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
-		return current_value.GetUint();
-	}
+	const rapidjson::Value* current_value = FindMember(name);
+	return current_value != nullptr ? current_value->GetUint() : opt_value;
 }
 void Config::AddInt64(int64_t value_to_add, const std::string& name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
-	config_document.AddMember(member_name, value_to_add, *allocator);
+	AddMember(member_name, value_to_add);
 }
 
-int64_t Config::GetInt64(const std::string& name, int64_t opt_value) const
+int64_t Config::GetInt64(std::string_view name, int64_t opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
-	{
-		return opt_value;
-	}
-	else
-	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
-		return current_value.GetInt64();
-	}
+	const rapidjson::Value* current_value = FindMember(name);
+	return current_value != nullptr ? current_value->GetInt64() : opt_value;
 }
 void Config::AddFloat(float value_to_add, const std::string& name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
-	config_document.AddMember(member_name, value_to_add, *allocator);
+	AddMember(member_name, value_to_add);
 }
 
-float Config::GetFloat(const std::string& name, float opt_value) const
+float Config::GetFloat(std::string_view name, float opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
-	{
-		return opt_value;
-	}
-	else
-	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
-		return current_value.GetFloat();
-	}
+	const rapidjson::Value* current_value = FindMember(name);
+	return current_value != nullptr ? current_value->GetFloat() : opt_value;
 }
 
 void Config::AddBool(bool value_to_add, const std::string& name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
-	config_document.AddMember(member_name, value_to_add, *allocator);
+	AddMember(member_name, value_to_add);
 }
 
-bool Config::GetBool(const std::string& name, bool opt_value) const
+bool Config::GetBool(std::string_view name, bool opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
-	{
-		return opt_value;
-	}
-	else
-	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
-		return current_value.GetBool();
-	}
+	const rapidjson::Value* current_value = FindMember(name);
+	return current_value != nullptr ? current_value->GetBool() : opt_value;
 }
 
 void Config::AddString(const std::string value_to_add, const std::string& name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
 	rapidjson::Value string_value(value_to_add.c_str(), value_to_add.size(), *allocator);
-	config_document.AddMember(member_name, string_value, *allocator);
+	AddMember(member_name, string_value);
 }
 
-void Config::GetString(const std::string& name, std::string& return_value, const std::string& opt_value) const
+void Config::GetString(std::string_view name, std::string& return_value, const std::string& opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* found_value = FindMember(name);
+	if (found_value == nullptr)
 	{
 		return_value = opt_value;
 	}
 	else
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
+		const rapidjson::Value& current_value = *found_value;
 		return_value = std::string(current_value.GetString(), current_value.GetStringLength());
 	}
 }
@@ -185,18 +220,19 @@ void Config::AddFloat3(const float3& value_to_add, const std::string& name)
 	array_value.PushBack(value_to_add.y, *allocator);
 	array_value.PushBack(value_to_add.z, *allocator);
 
-	config_document.AddMember(member_name, array_value, *allocator);
+	AddMember(member_name, array_value);
 }
 
-void Config::GetFloat3(const std::string& name, float3 &return_value, const float3 &opt_value) const
+void Config::GetFloat3(std::string_view name, float3 &return_value, const float3 &opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* found_value = FindMember(name);
+	if (found_value == nullptr)
 	{
 		return_value = opt_value;
 	}
 	else
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
+		const rapidjson::Value& current_value = *found_value;
 		return_value = float3(
 			current_value[0].GetFloat(),
 			current_value[1].GetFloat(),
@@ -212,18 +248,19 @@ void Config::AddFloat2(const float2& value_to_add, const std::string& name)
 	array_value.PushBack(value_to_add.x, *allocator);
 	array_value.PushBack(value_to_add.y, *allocator);
 
-	config_document.AddMember(member_name, array_value, *allocator);
+	AddMember(member_name, array_value);
 }
 
-void Config::GetFloat2(const std::string& name, float2 &return_value, const float2 &opt_value) const
+void Config::GetFloat2(std::string_view name, float2 &return_value, const float2 &opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* found_value = FindMember(name);
+	if (found_value == nullptr)
 	{
 		return_value = opt_value;
 	}
 	else
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
+		const rapidjson::Value& current_value = *found_value;
 		return_value = float2(
 			current_value[0].GetFloat(),
 			current_value[1].GetFloat()
@@ -240,18 +277,19 @@ void Config::AddRect(const SDL_Rect& value_to_add, const std::string& name)
 	array_value.PushBack(value_to_add.w, *allocator);
 	array_value.PushBack(value_to_add.h, *allocator);
 
-	config_document.AddMember(member_name, array_value, *allocator);
+	AddMember(member_name, array_value);
 }
 
-void Config::GetRect(const std::string &name, SDL_Rect &return_value, const SDL_Rect &opt_value) const
+void Config::GetRect(std::string_view name, SDL_Rect &return_value, const SDL_Rect &opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* found_value = FindMember(name);
+	if (found_value == nullptr)
 	{
 		return_value = opt_value;
 	}
 	else
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
+		const rapidjson::Value& current_value = *found_value;
 		return_value = SDL_Rect();
 		return_value.x = static_cast<int>(current_value[0].GetFloat());
 		return_value.y = static_cast<int>(current_value[1].GetFloat());
@@ -269,18 +307,19 @@ void Config::AddQuat(const Quat& value_to_add, const std::string& name)
 	quat_value.PushBack(value_to_add.z, *allocator);
 	quat_value.PushBack(value_to_add.w, *allocator);
 
-	config_document.AddMember(member_name, quat_value, *allocator);
+	AddMember(member_name, quat_value);
 }
 
-void Config::GetQuat(const std::string& name, Quat& return_value, const Quat& opt_value) const
+void Config::GetQuat(std::string_view name, Quat& return_value, const Quat& opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* found_value = FindMember(name);
+	if (found_value == nullptr)
 	{
 		return_value = opt_value;
 	}
 	else
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
+		const rapidjson::Value& current_value = *found_value;
 		return_value = Quat(
 			current_value[0].GetFloat(),
 			current_value[1].GetFloat(),
@@ -299,18 +338,19 @@ void Config::AddColor(const float4& value_to_add, const std::string& name)
 	color_value.PushBack(value_to_add.z, *allocator);
 	color_value.PushBack(value_to_add.w, *allocator);
 
-	config_document.AddMember(member_name, color_value, *allocator);
+	AddMember(member_name, color_value);
 }
 
-void Config::GetColor(const std::string& name, float4& return_value, const float4& opt_value) const
+void Config::GetColor(std::string_view name, float4& return_value, const float4& opt_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* found_value = FindMember(name);
+	if (found_value == nullptr)
 	{
 		return_value = opt_value;
 	}
 	else
 	{
-		const rapidjson::Value& current_value = config_document[name.c_str()];
+		const rapidjson::Value& current_value = *found_value;
 		return_value = float4(
 			current_value[0].GetFloat(),
 			current_value[1].GetFloat(),
@@ -324,16 +364,16 @@ void Config::AddChildConfig(Config& value_to_add, const std::string& name)
 {
 	rapidjson::Value member_name(name.c_str(), *allocator);
 	rapidjson::Value tmp_value(rapidjson::kObjectType);
-	tmp_value.CopyFrom(value_to_add.config_document, *allocator);
-	config_document.AddMember(member_name, tmp_value, *allocator);
+	tmp_value.CopyFrom(value_to_add.GetValue(), *allocator, true);
+	AddMember(member_name, tmp_value);
 }
 
-void Config::GetChildConfig(const std::string& name, Config& value_to_add) const
+void Config::GetChildConfig(std::string_view name, Config& value_to_add) const
 {
-	assert(config_document.HasMember(name.c_str()));
+	const rapidjson::Value* child_value = FindMember(name);
+	assert(child_value != nullptr);
 
-	const rapidjson::Value& tmp_value = config_document[name.c_str()];
-	value_to_add = Config(tmp_value);
+	value_to_add = child_value != nullptr ? Config(*child_value, *allocator) : Config();
 }
 
 void Config::AddChildrenConfig(std::vector<Config> &value_to_add, const std::string& name)
@@ -343,26 +383,25 @@ void Config::AddChildrenConfig(std::vector<Config> &value_to_add, const std::str
 	for (unsigned int i = 0; i < value_to_add.size(); ++i)
 	{
 		rapidjson::Value tmp_value(rapidjson::kObjectType);
-		tmp_value.CopyFrom(value_to_add[i].config_document.Move(), *allocator);
+		tmp_value.CopyFrom(value_to_add[i].GetValue(), *allocator, true);
 		children_configs_value.PushBack(tmp_value.Move(), *allocator);
 	}
-	config_document.AddMember(member_name, children_configs_value, *allocator);
+	AddMember(member_name, children_configs_value);
 }
 
-void Config::GetChildrenConfig(const std::string& name, std::vector<Config>& return_value) const
+void Config::GetChildrenConfig(std::string_view name, std::vector<Config>& return_value) const
 {
-	if (!config_document.HasMember(name.c_str()))
+	const rapidjson::Value* children_configs_value = FindMember(name);
+	if (children_configs_value == nullptr)
 	{
 		return;
 	}
 
-	const rapidjson::Value& children_configs_value = config_document[name.c_str()];
-	return_value = std::vector<Config>();
-	for (unsigned int i = 0; i < children_configs_value.Size(); ++i)
+	return_value.clear();
+	return_value.reserve(children_configs_value->Size());
+	for (const auto& child_value : children_configs_value->GetArray())
 	{
-		const rapidjson::Value& tmp_value = children_configs_value[i];
-		Config tmp_config(tmp_value);
-		return_value.push_back(tmp_config);
+		return_value.emplace_back(Config(child_value, *allocator));
 	}
 }
 
@@ -371,6 +410,6 @@ void Config::GetSerializedString(std::string& return_string)
 	rapidjson::StringBuffer buffer;
 	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
 
-	config_document.Accept(writer);
+	GetValue().Accept(writer);
 	return_string = buffer.GetString();
 }
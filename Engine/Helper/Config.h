@@ -10,63 +10,77 @@
 #include <SDL/SDL.h>
 
 #include <rapidjson/document.h>
+#include <memory>
+#include <string_view>
 
 struct FileData;
+
+/*
+	JSON object wrapper. GetChildConfig and GetChildrenConfig return read-only views into the parent document,
+	they share its allocator and are valid while the parent Config is alive. Copying a Config always deep copies.
+	Configs built from a file buffer are parsed in situ, strings point into the buffer the Config keeps.
+*/
 class Config
 {
 public:
 	Config();
 	Config(FileData & data);
+	Config(const char* serialized_data, size_t size);
 	Config(const rapidjson::Value& object_value);
 	Config(const std::string& serialized_scene_string);
 	~Config() = default;
 	
 	Config(const Config& other);
+	Config(Config&& other) noexcept;
 	Config& operator=(const Config& other);
+	Config& operator=(Config&& other) noexcept;
 
 	rapidjson::Document::AllocatorType& GetAllocator() const;
+	const rapidjson::Value& GetValue() const;
+	bool IsView() const;
+	ENGINE_API bool HasMember(std::string_view name) const;
 
 	ENGINE_API void AddInt(int value_to_add, const std::string &name);
-	ENGINE_API int GetInt(const std::string &name, int opt_value) const;
+	ENGINE_API int GetInt(std::string_view name, int opt_value) const;
 
 	ENGINE_API void AddUInt(uint64_t value_to_add, const std::string& name);
-	ENGINE_API uint64_t GetUInt(const std::string& name, unsigned int opt_value) const;
+	ENGINE_API uint64_t GetUInt(std::string_view name, unsigned int opt_value) const;
 
 	ENGINE_API void AddUInt32(uint32_t value_to_add, const std::string& name);
-	ENGINE_API uint32_t GetUInt32(const std::string& name, unsigned int opt_value) const;
+	ENGINE_API uint32_t GetUInt32(std::string_view name, unsigned int opt_value) const;
 
 	void AddInt64(int64_t value_to_add, const std::string &name);
-	int64_t GetInt64(const std::string& name, int64_t opt_value) const;
+	int64_t GetInt64(std::string_view name, int64_t opt_value) const;
 
 	ENGINE_API void AddFloat(float value_to_add, const std::string& name);
-	ENGINE_API float GetFloat(const std::string &name, float opt_value) const;
+	ENGINE_API float GetFloat(std::string_view name, float opt_value) const;
 
 	ENGINE_API void AddBool(bool value_to_add, const std::string& name);
-	ENGINE_API bool GetBool(const std::string& name, bool opt_value) const;
+	ENGINE_API bool GetBool(std::string_view name, bool opt_value) const;
 
 	ENGINE_API void AddString(const std::string value_to_add, const std::string& name);
-	ENGINE_API void GetString(const std::string& name, std::string& return_value, const std::string& opt_value) const;
+	ENGINE_API void GetString(std::string_view name, std::string& return_value, const std::string& opt_value) const;
 
 	ENGINE_API void AddFloat3(const float3 &value_to_addvalue_to_add, const std::string& name);
-	ENGINE_API void GetFloat3(const std::string &name, float3 &return_value, const float3 &opt_value) const;
+	ENGINE_API void GetFloat3(std::string_view name, float3 &return_value, const float3 &opt_value) const;
 
 	void AddFloat2(const float2 &value_to_addvalue_to_add, const std::string& name);
-	void GetFloat2(const std::string &name, float2 &return_value, const float2 &opt_value) const;
+	void GetFloat2(std::string_view name, float2 &return_value, const float2 &opt_value) const;
 	
 	void AddRect(const SDL_Rect &value_to_addvalue_to_add, const std::string& name);
-	void GetRect(const std::string &name, SDL_Rect &return_value, const SDL_Rect &opt_value) const;
+	void GetRect(std::string_view name, SDL_Rect &return_value, const SDL_Rect &opt_value) const;
 
 	void AddQuat(const Quat & value_to_add, const std::string& name);
-	void GetQuat(const std::string& name, Quat& return_value, const Quat& opt_value) const;
+	void GetQuat(std::string_view name, Quat& return_value, const Quat& opt_value) const;
 
 	ENGINE_API void AddColor(const float4& value_to_add, const std::string& name);
-	ENGINE_API void GetColor(const std::string& name, float4& return_value, const float4& opt_value) const;
+	ENGINE_API void GetColor(std::string_view name, float4& return_value, const float4& opt_value) const;
 
 	void AddChildConfig(Config& value_to_add, const std::string& name);
-	void GetChildConfig(const std::string& name, Config& value_to_add) const;
+	void GetChildConfig(std::string_view name, Config& value_to_add) const;
 
 	void AddChildrenConfig(std::vector<Config>& value_to_add, const std::string& name);
-	void GetChildrenConfig(const std::string& name, std::vector<Config>& return_value) const;
+	void GetChildrenConfig(std::string_view name, std::vector<Config>& return_value) const;
 
 	template<class T>
 	void AddVector(const std::vector<T>& value_to_add, const std::string& name)
@@ -78,7 +92,7 @@ public:
 			vector_value.PushBack(value_to_add[i], *allocator);
 		}
 
-		config_document.AddMember(member_name, vector_value, *allocator);
+		AddMember(member_name, vector_value);
 	};
 
 	template<>
@@ -92,7 +106,7 @@ public:
 			vector_value.PushBack(string_value, *allocator);
 		}
 
-		config_document.AddMember(member_name, vector_value, *allocator);
+		AddMember(member_name, vector_value);
 	};
 
 	template<>
@@ -110,18 +124,19 @@ public:
 			vector_value.PushBack(array_value, *allocator);
 		}
 
-		config_document.AddMember(member_name, vector_value, *allocator);
+		AddMember(member_name, vector_value);
 	};
 
-	template<class T> void GetVector(const std::string& name, std::vector<T>& return_value, const std::vector<T>& opt_value) const
+	template<class T> void GetVector(std::string_view name, std::vector<T>& return_value, const std::vector<T>& opt_value) const
 	{
-		if (!config_document.HasMember(name.c_str()))
+		const rapidjson::Value* found_value = FindMember(name);
+		if (found_value == nullptr)
 		{
 			return_value = opt_value;
 		}
 		else
 		{
-			const rapidjson::Value& current_value = config_document[name.c_str()];
+			const rapidjson::Value& current_value = *found_value;
 			return_value = std::vector<T>();
 			for (size_t i = 0; i < current_value.Capacity(); ++i)
 			{
@@ -131,15 +146,16 @@ public:
 	};
 
 	template<>
-	void GetVector(const std::string& name, std::vector<std::string>& return_value, const std::vector<std::string>& opt_value) const
+	void GetVector(std::string_view name, std::vector<std::string>& return_value, const std::vector<std::string>& opt_value) const
 	{
-		if (!config_document.HasMember(name.c_str()))
+		const rapidjson::Value* found_value = FindMember(name);
+		if (found_value == nullptr)
 		{
 			return_value = opt_value;
 		}
 		else
 		{
-			const rapidjson::Value& current_value = config_document[name.c_str()];
+			const rapidjson::Value& current_value = *found_value;
 			return_value = std::vector<std::string>();
 			for (size_t i = 0; i < current_value.Capacity(); ++i)
 			{
@@ -149,15 +165,16 @@ public:
 	};
 
 	template<>
-	void GetVector(const std::string& name, std::vector<float3>& return_value, const std::vector<float3>& opt_value) const
+	void GetVector(std::string_view name, std::vector<float3>& return_value, const std::vector<float3>& opt_value) const
 	{
-		if (!config_document.HasMember(name.c_str()))
+		const rapidjson::Value* found_value = FindMember(name);
+		if (found_value == nullptr)
 		{
 			return_value = opt_value;
 		}
 		else
 		{
-			const rapidjson::Value& current_value = config_document[name.c_str()];
+			const rapidjson::Value& current_value = *found_value;
 			return_value = std::vector<float3>();
 
 			for (size_t i = 0; i < current_value.Capacity(); ++i)
@@ -176,10 +193,25 @@ public:
 
 	void GetSerializedString(std::string& return_string);
 
+private:
+	Config(const rapidjson::Value& object_value, rapidjson::Document::AllocatorType& parent_allocator);
+
+	const rapidjson::Value* FindMember(std::string_view name) const;
+	void AddMember(rapidjson::Value& member_name, rapidjson::Value& member_value);
+	template<typename T>
+	void AddMember(rapidjson::Value& member_name, T member_value)
+	{
+		rapidjson::Value value(member_value);
+		AddMember(member_name, value);
+	}
+
 public:
 	rapidjson::Document config_document;
 	rapidjson::Document::AllocatorType* allocator;
 
+private:
+	const rapidjson::Value* view = nullptr; // Value inside another Config document, not owned
+	std::unique_ptr<char[]> insitu_buffer;
 };
 
 #endif //_CONFIG_H_
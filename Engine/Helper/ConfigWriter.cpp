@@ -0,0 +1,79 @@
+#include "ConfigWriter.h"
+
+#include "Helper/Config.h"
+
+#include <cassert>
+#include <cstring>
+
+ConfigWriter::ConfigWriter() : writer(output)
+{
+	writer.StartObject();
+}
+
+ConfigWriter::~ConfigWriter()
+{
+	delete[] output.buffer;
+}
+
+void ConfigWriter::StartArray(const std::string& name)
+{
+	writer.Key(name.c_str(), static_cast<rapidjson::SizeType>(name.size()));
+	writer.StartArray();
+}
+
+void ConfigWriter::Add(const Config& element)
+{
+	element.GetValue().Accept(writer);
+}
+
+void ConfigWriter::EndArray()
+{
+	writer.EndArray();
+}
+
+void ConfigWriter::AddMembers(const Config& config)
+{
+	for (const auto& member : config.GetValue().GetObject())
+	{
+		writer.Key(member.name.GetString(), member.name.GetStringLength());
+		member.value.Accept(writer);
+	}
+}
+
+void ConfigWriter::AddBool(bool value_to_add, const std::string& name)
+{
+	writer.Key(name.c_str(), static_cast<rapidjson::SizeType>(name.size()));
+	writer.Bool(value_to_add);
+}
+
+FileData ConfigWriter::Finish()
+{
+	writer.EndObject();
+	assert(writer.IsComplete());
+	output.Put('\0');
+
+	unsigned int size = static_cast<unsigned int>(output.size);
+	return FileData{ output.Release(), size };
+}
+
+void ConfigWriter::OutputBuffer::Grow()
+{
+	size_t new_capacity = capacity == 0 ? INITIAL_CAPACITY : capacity * 2;
+	char* new_buffer = new char[new_capacity];
+	if (buffer != nullptr)
+	{
+		memcpy(new_buffer, buffer, size);
+		delete[] buffer;
+	}
+	buffer = new_buffer;
+	capacity = new_capacity;
+}
+
+char* ConfigWriter::OutputBuffer::Release()
+{
+	char* released_buffer = buffer;
+	buffer = nullptr;
+	size = 0;
+	capacity = 0;
+	return released_buffer;
+}
@@ -0,0 +1,68 @@
+#ifndef _CONFIGWRITER_H_
+#define _CONFIGWRITER_H_
+
+#include "Filesystem/File.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <string>
+
+class Config;
+
+/*
+	Streams a JSON object out as it is written, instead of building the whole document first.
+	Every added Config is serialized straight into the output buffer, so only the record being written is kept as a document.
+	The output is the same Config::GetSerializedString gives for the equivalent document, null terminated like the files saved from it.
+*/
+class ConfigWriter
+{
+public:
+	ConfigWriter();
+	~ConfigWriter();
+
+	ConfigWriter(const ConfigWriter& writer_to_copy) = delete;
+	ConfigWriter& operator=(const ConfigWriter& writer_to_copy) = delete;
+
+	void StartArray(const std::string& name);
+	void Add(const Config& element);
+	void EndArray();
+
+	void AddMembers(const Config& config);
+	void AddBool(bool value_to_add, const std::string& name);
+
+	// The caller owns the returned buffer
+	FileData Finish();
+
+private:
+	// Output stream for the rapidjson writer, grows a buffer that is handed over without copying it
+	class OutputBuffer
+	{
+	public:
+		typedef char Ch;
+
+		void Put(char character)
+		{
+			if (size == capacity)
+			{
+				Grow();
+			}
+			buffer[size++] = character;
+		}
+		void Flush() {}
+
+		void Grow();
+		char* Release();
+
+	public:
+		static const size_t INITIAL_CAPACITY = 64 * 1024;
+
+		char* buffer = nullptr;
+		size_t size = 0;
+		size_t capacity = 0;
+	};
+
+	OutputBuffer output;
+	rapidjson::PrettyWriter<OutputBuffer> writer;
+};
+
+#endif // _CONFIGWRITER_H_
@@ -0,0 +1,179 @@
+#include "JobSystem.h"
+
+#include <Brofiler/Brofiler.h>
+
+#include <algorithm>
+#include <cassert>
+
+thread_local size_t JobSystem::current_queue_index = 0;
+
+JobSystem::~JobSystem()
+{
+	CleanUp();
+}
+
+void JobSystem::Init(size_t num_threads)
+{
+	if (num_threads == 0)
+	{
+		num_threads = GetMaxThreads();
+	}
+
+	queues.clear();
+	for (size_t i = 0; i < num_threads; ++i)
+	{
+		queues.emplace_back(std::make_unique<WorkerQueue>());
+	}
+
+	running = true;
+	for (size_t i = 1; i < num_threads; ++i)
+	{
+		workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+}
+
+void JobSystem::CleanUp()
+{
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+		running = false;
+	}
+	sleep_condition.notify_all();
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	workers.clear();
+}
+
+void JobSystem::SetNumThreads(size_t num_threads)
+{
+	assert(queued_jobs == 0);
+	CleanUp();
+	Init(num_threads);
+}
+
+size_t JobSystem::GetNumThreads() const
+{
+	return queues.size();
+}
+
+size_t JobSystem::GetMaxThreads() const
+{
+	return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+void JobSystem::Schedule(std::function<void()> function, JobCounter* counter)
+{
+	if (counter != nullptr)
+	{
+		++counter->pending_jobs;
+	}
+
+	WorkerQueue& queue = *queues[current_queue_index];
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.jobs.push_back(Job{ std::move(function), counter });
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleep_mutex);
+		++queued_jobs;
+	}
+	sleep_condition.notify_one();
+}
+
+void JobSystem::ParallelFor(size_t count, size_t batch_size, std::function<void(size_t, size_t)> function, JobCounter& counter)
+{
+	batch_size = std::max<size_t>(1, batch_size);
+	auto shared_function = std::make_shared<std::function<void(size_t, size_t)>>(std::move(function));
+	for (size_t begin = 0; begin < count; begin += batch_size)
+	{
+		size_t end = std::min(begin + batch_size, count);
+		Schedule([shared_function, begin, end]() { (*shared_function)(begin, end); }, &counter);
+	}
+}
+
+void JobSystem::ParallelFor(size_t count, size_t batch_size, std::function<void(size_t, size_t)> function)
+{
+	JobCounter counter;
+	ParallelFor(count, batch_size, std::move(function), counter);
+	Wait(counter);
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+	BROFILER_CATEGORY("Job System Wait", Profiler::Color::Gray);
+	while (!counter.IsDone())
+	{
+		if (!ExecuteNextJob(current_queue_index))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::WorkerLoop(size_t queue_index)
+{
+	BROFILER_THREAD("Job Worker");
+	current_queue_index = queue_index;
+
+	while (running)
+	{
+		if (!ExecuteNextJob(queue_index))
+		{
+			std::unique_lock<std::mutex> lock(sleep_mutex);
+			sleep_condition.wait(lock, [this]() { return queued_jobs > 0 || !running; });
+		}
+	}
+}
+
+bool JobSystem::ExecuteNextJob(size_t queue_index)
+{
+	Job job;
+	if (!PopJob(queue_index, job) && !StealJob(queue_index, job))
+	{
+		return false;
+	}
+
+	--queued_jobs;
+	job.function();
+	if (job.counter != nullptr)
+	{
+		--job.counter->pending_jobs;
+	}
+
+	return true;
+}
+
+bool JobSystem::PopJob(size_t queue_index, Job& job)
+{
+	WorkerQueue& queue = *queues[queue_index];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.jobs.empty())
+	{
+		return false;
+	}
+
+	job = std::move(queue.jobs.back());
+	queue.jobs.pop_back();
+	return true;
+}
+
+bool JobSystem::StealJob(size_t thief_index, Job& job)
+{
+	for (size_t i = 1; i < queues.size(); ++i)
+	{
+		WorkerQueue& victim = *queues[(thief_index + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.jobs.empty())
+		{
+			job = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
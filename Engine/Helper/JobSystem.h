@@ -0,0 +1,77 @@
+#ifndef _JOBSYSTEM_H_
+#define _JOBSYSTEM_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+	Counts the jobs that are still pending. Used as a fence: JobSystem::Wait returns when it reaches zero.
+*/
+struct JobCounter
+{
+	std::atomic<int> pending_jobs = 0;
+
+	bool IsDone() const { return pending_jobs == 0; }
+};
+
+/*
+	Work-stealing job system. Every thread (main thread included) owns a deque of jobs.
+	Owners push and pop from the back, idle threads steal from the front of the others.
+	The main thread takes part on the work while it waits for a counter.
+*/
+class JobSystem
+{
+public:
+	struct Job
+	{
+		std::function<void()> function;
+		JobCounter* counter = nullptr;
+	};
+
+	JobSystem() = default;
+	~JobSystem();
+
+	void Init(size_t num_threads = 0);
+	void CleanUp();
+
+	void SetNumThreads(size_t num_threads);
+	size_t GetNumThreads() const;
+	size_t GetMaxThreads() const;
+
+	void Schedule(std::function<void()> function, JobCounter* counter = nullptr);
+	void ParallelFor(size_t count, size_t batch_size, std::function<void(size_t, size_t)> function, JobCounter& counter);
+	void ParallelFor(size_t count, size_t batch_size, std::function<void(size_t, size_t)> function);
+	void Wait(JobCounter& counter);
+
+private:
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	void WorkerLoop(size_t queue_index);
+	bool ExecuteNextJob(size_t queue_index);
+	bool PopJob(size_t queue_index, Job& job);
+	bool StealJob(size_t thief_index, Job& job);
+
+private:
+	std::vector<std::unique_ptr<WorkerQueue>> queues; // Queue 0 belongs to the main thread
+	std::vector<std::thread> workers;
+
+	std::atomic<bool> running = false;
+	std::atomic<int> queued_jobs = 0;
+
+	std::mutex sleep_mutex;
+	std::condition_variable sleep_condition;
+
+	static thread_local size_t current_queue_index;
+};
+
+#endif // _JOBSYSTEM_H_
@@ -34,7 +34,7 @@ void TagManager::RemoveTag(const std::string& tag_to_remove)
 	std::vector<GameObject*> tagged_game_objects = App->scene->GetGameObjectsWithTag(tag_to_remove);
 	for (auto& tagged_game_object : tagged_game_objects)
 	{
-		tagged_game_object->tag = "";
+		tagged_game_object->SetTag("");
 	}
 	tags.erase(tag_position);
 
@@ -13,7 +13,7 @@
 GameObject* TemplatedGameObjectCreator::CreatePrimitive(CoreResource resource_type)
 {
 	GameObject* primitive_game_object = App->scene->CreateGameObject();
-	primitive_game_object->name = GetCoreResourceName(resource_type);
+	primitive_game_object->SetName(GetCoreResourceName(resource_type));
 
 	ComponentMeshRenderer* mesh_renderer_component = (ComponentMeshRenderer*)primitive_game_object->CreateComponent(Component::ComponentType::MESH_RENDERER);
 	mesh_renderer_component->SetMesh((uint32_t)resource_type);
@@ -40,7 +40,7 @@ GameObject* TemplatedGameObjectCreator::CreateUIImage()
 	}
 
 	GameObject* created_ui_element = App->scene->CreateGameObject();
-	created_ui_element->name = Component::GetComponentTypeName(Component::ComponentType::UI_IMAGE);
+	created_ui_element->SetName(Component::GetComponentTypeName(Component::ComponentType::UI_IMAGE));
 	created_ui_element->CreateComponent(Component::ComponentType::UI_IMAGE);
 
 	main_canvas_game_object->AddChild(created_ui_element);
@@ -62,14 +62,14 @@ GameObject* TemplatedGameObjectCreator::CreateUIButton()
 	}
 
 	GameObject* created_button = App->scene->CreateGameObject();
-	created_button->name = Component::GetComponentTypeName(Component::ComponentType::UI_BUTTON);
+	created_button->SetName(Component::GetComponentTypeName(Component::ComponentType::UI_BUTTON));
 	created_button->CreateComponent(Component::ComponentType::UI_IMAGE);
 	created_button->CreateComponent(Component::ComponentType::UI_BUTTON);
 	created_button->CreateComponent(Component::ComponentType::CANVAS_RENDERER);
 	created_button->transform_2d.SetSize(float2(160, 30));
 
 	GameObject* button_text = App->scene->CreateGameObject();
-	button_text->name = Component::GetComponentTypeName(Component::ComponentType::UI_TEXT);
+	button_text->SetName(Component::GetComponentTypeName(Component::ComponentType::UI_TEXT));
 	created_button->AddChild(button_text);
 
 	button_text->transform_2d.SetAnchorPreset(AnchorPreset::AnchorPresetType::STRETCH_HORIZONTAL_STRETCH_VERTICAL);
@@ -102,7 +102,7 @@ GameObject* TemplatedGameObjectCreator::CreateUIText()
 	}
 
 	GameObject* created_text = App->scene->CreateGameObject();
-	created_text->name = Component::GetComponentTypeName(Component::ComponentType::UI_TEXT);
+	created_text->SetName(Component::GetComponentTypeName(Component::ComponentType::UI_TEXT));
 	created_text->transform_2d.SetSize(float2(160, 30));
 	ComponentText* component_text = static_cast<ComponentText*>(created_text->CreateComponent(Component::ComponentType::UI_TEXT));
 	component_text->SetFont((uint32_t)CoreResource::DEFAULT_FONT);
@@ -120,7 +120,7 @@ GameObject* TemplatedGameObjectCreator::CreateUIText()
 GameObject* TemplatedGameObjectCreator::CreateMainCanvas()
 {
 	GameObject* main_canvas_game_object = App->scene->CreateGameObject();
-	main_canvas_game_object->name = "Canvas";
+	main_canvas_game_object->SetName("Canvas");
 	main_canvas_game_object->CreateComponent(Component::ComponentType::CANVAS);
 
 	return main_canvas_game_object;
@@ -129,7 +129,7 @@ GameObject* TemplatedGameObjectCreator::CreateMainCanvas()
 GameObject* TemplatedGameObjectCreator::CreateEventSystem()
 {
 	GameObject* event_system_game_object = App->scene->CreateGameObject();
-	event_system_game_object->name = "Event System";
+	event_system_game_object->SetName("Event System");
 	event_system_game_object->CreateComponent(Component::ComponentType::EVENT_SYSTEM);
 
 	return event_system_game_object;
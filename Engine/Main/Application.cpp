@@ -1,6 +1,7 @@
 #include "Application.h"
 #include "Log/EngineLog.h"
 #include "Event/EventManager.h"
+#include "Helper/JobSystem.h"
 #include "Module/ModuleActions.h"
 #include "Module/ModuleAI.h"
 #include "Module/ModuleAudio.h"
@@ -24,25 +25,28 @@
 #include "Module/ModuleTime.h"
 #include "Module/ModuleUI.h"
 #include "Module/ModuleWindow.h"
+#include "Module/Headless/ModuleDebugDrawHeadless.h"
+#include "Module/Headless/ModuleEditorHeadless.h"
+#include "Module/Headless/ModuleRenderHeadless.h"
+#include "Module/Headless/ModuleWindowHeadless.h"
 
 #include <Brofiler/Brofiler.h>
 
 
-Application::Application()
+Application::Application(bool headless) : headless(headless)
 {
 	modules.reserve(15);
 	// Order matters: they will Init/start/update in this order
-	modules.emplace_back(window = new ModuleWindow());
+	modules.emplace_back(window = headless ? new ModuleWindowHeadless() : new ModuleWindow());
 	modules.emplace_back(filesystem = new ModuleFileSystem());
 	modules.emplace_back(time = new ModuleTime());
 	modules.emplace_back(resources = new ModuleResourceManager());
 	modules.emplace_back(input = new ModuleInput());
-	modules.emplace_back(renderer = new ModuleRender());
+	modules.emplace_back(renderer = headless ? new ModuleRenderHeadless() : new ModuleRender());
 	modules.emplace_back(ui = new ModuleUI());
 	modules.emplace_back(texture = new ModuleTexture());
 	modules.emplace_back(effects = new ModuleEffects());
-	modules.emplace_back(animations = new ModuleAnimation());
-	modules.emplace_back(editor = new ModuleEditor());
+	modules.emplace_back(editor = headless ? new ModuleEditorHeadless() : new ModuleEditor());
 	modules.emplace_back(actions = new ModuleActions());
 	modules.emplace_back(program = new ModuleProgram());
 	modules.emplace_back(cameras = new ModuleCamera());
@@ -52,12 +56,14 @@ Application::Application()
 	modules.emplace_back(scene = new ModuleScene());
 	modules.emplace_back(space_partitioning = new ModuleSpacePartitioning());
 	modules.emplace_back(artificial_intelligence = new ModuleAI());
+	modules.emplace_back(animations = new ModuleAnimation()); // Next to the other modules that don't conflict, they are updated together
 	modules.emplace_back(physics = new ModulePhysics());
 	modules.emplace_back(scripts = new ModuleScriptManager());
-	modules.emplace_back(debug_draw = new ModuleDebugDraw());
+	modules.emplace_back(debug_draw = headless ? new ModuleDebugDrawHeadless() : new ModuleDebugDraw());
 		
 	engine_log = std::make_unique<EngineLog>();
 	event_manager = std::make_unique<EventManager>();
+	job_system = std::make_unique<JobSystem>();
 }
 
 Application::~Application()
@@ -72,6 +78,9 @@ bool Application::Init()
 {
 	bool result = true;
 
+	job_system->Init();
+	BuildUpdateWaves();
+
 	for (auto& module : modules) 
 	{
 		bool ret = module->Init();
@@ -90,43 +99,27 @@ update_status Application::Update()
 	if (App->scene->HasPendingSceneToLoad())
 	{
 		App->scene->OpenPendingScene();
-		App->physics->UpdateAllDimensions();
 	}
+	App->scene->UpdateSceneLoading();
+
+	result = UpdateModules(&Module::PreUpdate);
 
-	for (auto& module : modules) 
-	{
-		update_status ret = module->PreUpdate();
-		if (ret == update_status::UPDATE_ERROR || ret == update_status::UPDATE_STOP) 
-		{
-			result = ret;
-		}
-	}
 	if (result == update_status::UPDATE_CONTINUE) 
 	{
-		for (auto& module : modules) 
-		{
-			update_status ret = module->Update();
-			if (ret == update_status::UPDATE_ERROR || ret == update_status::UPDATE_STOP) 
-			{
-				result = ret;
-			}
-		}
+		result = UpdateModules(&Module::Update);
+		App->animations->RunTweenCallbacks();
 	}
 
 	if (result == update_status::UPDATE_CONTINUE) 
 	{
-		for (auto& module : modules) 
-		{
-			update_status ret = module->PostUpdate();
-			if (ret == update_status::UPDATE_ERROR || ret == update_status::UPDATE_STOP) 
-			{
-				result = ret;
-			}
-		}
+		result = UpdateModules(&Module::PostUpdate);
 	}
 
 	if (result == update_status::UPDATE_CONTINUE)
 	{
+		App->scene->DestroyPendingGameObjects();
+		App->scene->UpdateTransforms();
+		App->scene->UpdateBoundingBoxes();
 		App->renderer->Render();
 	}
 
@@ -142,5 +135,78 @@ bool Application::CleanUp()
 	for (std::vector<Module*>::reverse_iterator it = modules.rbegin(); it != modules.rend() && ret; ++it)
 		ret = (*it)->CleanUp();
 
+	job_system->CleanUp();
+
 	return ret;
 }
+
+bool Application::IsHeadless() const
+{
+	return headless;
+}
+
+void Application::BuildUpdateWaves()
+{
+	// Each module goes to the wave after the last one holding a module it conflicts with, so conflicting modules keep their order
+	std::vector<size_t> module_waves(modules.size(), 0);
+	update_waves.clear();
+
+	for (size_t i = 0; i < modules.size(); ++i)
+	{
+		ModuleDependencies dependencies = modules[i]->GetDependencies();
+		size_t wave = 0;
+		for (size_t j = 0; j < i; ++j)
+		{
+			if (dependencies.ConflictsWith(modules[j]->GetDependencies()))
+			{
+				wave = max(wave, module_waves[j] + 1);
+			}
+		}
+		module_waves[i] = wave;
+
+		if (wave == update_waves.size())
+		{
+			update_waves.emplace_back();
+		}
+		update_waves[wave].push_back(modules[i]);
+	}
+}
+
+update_status Application::UpdateModules(update_status (Module::*update_phase)())
+{
+	update_status result = update_status::UPDATE_CONTINUE;
+
+	std::vector<update_status> wave_results;
+	for (auto& wave : update_waves)
+	{
+		wave_results.assign(wave.size(), update_status::UPDATE_CONTINUE);
+		if (wave.size() == 1)
+		{
+			wave_results[0] = (wave[0]->*update_phase)();
+		}
+		else
+		{
+			// Modules in the wave read global matrices concurrently, the dirty ones are resolved here first
+			App->scene->UpdateTransforms();
+
+			JobCounter wave_counter;
+			for (size_t i = 0; i < wave.size(); ++i)
+			{
+				Module* module = wave[i];
+				update_status* module_result = &wave_results[i];
+				job_system->Schedule([module, module_result, update_phase]() { *module_result = (module->*update_phase)(); }, &wave_counter);
+			}
+			job_system->Wait(wave_counter);
+		}
+
+		for (auto ret : wave_results)
+		{
+			if (ret == update_status::UPDATE_ERROR || ret == update_status::UPDATE_STOP)
+			{
+				result = ret;
+			}
+		}
+	}
+
+	return result;
+}
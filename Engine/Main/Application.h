@@ -10,6 +10,7 @@
 class EngineLog;
 
 class EventManager;
+class JobSystem;
 
 class ModuleActions;
 class ModuleAI;
@@ -41,13 +42,19 @@ class Application
 {
 public:
 
-	Application();
+	Application(bool headless = false);
 	~Application();
 
 	bool Init();
 	update_status Update();
 	bool CleanUp();
 
+	bool IsHeadless() const;
+
+private:
+	void BuildUpdateWaves();
+	update_status UpdateModules(update_status (Module::*update_phase)());
+
 public:
 
 	ModuleActions* actions = nullptr;
@@ -76,9 +83,12 @@ public:
 
 	std::unique_ptr<EngineLog> engine_log = nullptr;
 	std::unique_ptr<EventManager> event_manager = nullptr;
+	std::unique_ptr<JobSystem> job_system = nullptr;
 
 private:
+	bool headless = false; // No window, GL context or editor. Window, render, editor and debug draw modules are null implementations
 	std::vector<Module*> modules;
+	std::vector<std::vector<Module*>> update_waves; // Modules in the same wave don't conflict and are updated concurrently
 };
 
 extern Application* App;
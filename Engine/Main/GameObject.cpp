@@ -4,6 +4,7 @@
 #include "EditorUI/Panel/PanelHierarchy.h"
 #include "Helper/Config.h"
 #include "Log/EngineLog.h"
+#include "TransformHierarchy.h"
 
 #include "Module/ModuleAnimation.h"
 #include "Module/ModuleAudio.h"
@@ -21,6 +22,7 @@
 #include "Module/ModuleTexture.h"
 #include "Module/ModuleUI.h"
 #include "Module/ModulePhysics.h"
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
 #include "ResourceManagement/Resources/Texture.h"
 #include "ResourceManagement/Resources/Prefab.h"
 
@@ -96,9 +98,11 @@ GameObject& GameObject::operator<<(const GameObject& gameobject_to_copy)
 	gameobject_to_copy.transform_2d.CopyTo(&transform_2d);
 	for (int i = (components.size() - 1); i >= 0; --i)
 	{
+		App->scene->UnindexComponent(components[i]);
 		components[i]->Delete();
 		components[i] = nullptr;
 	}
+	UpdateComponentSlots();
 	CopyComponents(gameobject_to_copy);
 	CopyParameters(gameobject_to_copy);
 	return *this;
@@ -114,37 +118,12 @@ void GameObject::CopyParameters(const GameObject & gameobject_to_copy)
 	this->hierarchy_branch = gameobject_to_copy.hierarchy_branch;
 	this->original_UUID = gameobject_to_copy.original_UUID;
 	this->tag = gameobject_to_copy.tag;
+	App->scene->ReindexGameObject(this);
 }
 
-void GameObject::Delete(std::vector<GameObject*>& children_to_remove)
+bool GameObject::IsMarkedForDestruction() const
 {
-	children_to_remove.push_back(this);
-	if (!is_static)
-	{
-		App->space_partitioning->RemoveAABBTree(this);
-	}
-
-	if (parent != nullptr)
-	{
-		parent->RemoveChild(this);
-	}
-
-	for (int i = (components.size() - 1); i >= 0; --i)
-	{
-		components[i]->Delete();
-		components[i] = nullptr;
-	}
-
-	for (int i = (children.size() - 1); i >= 0; --i)
-	{
-		children[i]->parent = nullptr;
-		children[i]->Delete(children_to_remove);
-	}
-
-	if (is_prefab_parent)
-	{
-		prefab_reference->RemoveInstance(this);
-	}
+	return marked_for_destruction;
 }
 
 void GameObject::Duplicate(const GameObject& gameobject_to_copy, GameObject* parent)
@@ -164,6 +143,22 @@ void GameObject::Duplicate(const GameObject& gameobject_to_copy, GameObject* par
 	return;
 }
 
+void GameObject::CopyFromPrefab(const GameObject& prefab_game_object)
+{
+	name = prefab_game_object.name;
+	tag = prefab_game_object.tag;
+	active = prefab_game_object.active;
+	is_static = prefab_game_object.is_static;
+	transform_2d_enabled = prefab_game_object.transform_2d_enabled;
+	hierarchy_depth = prefab_game_object.hierarchy_depth;
+	hierarchy_branch = prefab_game_object.hierarchy_branch;
+	original_UUID = prefab_game_object.original_UUID;
+
+	prefab_game_object.transform_2d.CopyTo(&transform_2d);
+	CopyComponents(prefab_game_object);
+	App->scene->ReindexGameObject(this);
+}
+
 void GameObject::SetTransform(GameObject* game_object)
 {
 	transform.SetTranslation(game_object->transform.GetTranslation());
@@ -171,6 +166,18 @@ void GameObject::SetTransform(GameObject* game_object)
 	transform.SetScale(game_object->transform.GetScale());
 }
 
+void GameObject::SetName(const std::string& name)
+{
+	this->name = name;
+	App->scene->ReindexGameObject(this);
+}
+
+void GameObject::SetTag(const std::string& tag)
+{
+	this->tag = tag;
+	App->scene->ReindexGameObject(this);
+}
+
 bool GameObject::IsEnabled() const
 {
 	return active;
@@ -369,6 +376,154 @@ void GameObject::Load(const Config& config)
 		}
 		created_component->Load(gameobject_components_config[i]);
 	}
+
+	App->scene->ReindexGameObject(this);
+}
+
+// The parent is resolved by the caller, descriptors are linked through their position in the scene instead of a scene lookup
+void GameObject::Load(const GameObjectDescriptor& descriptor, GameObject* game_object_parent)
+{
+	UUID = descriptor.UUID;
+	assert(UUID != 0);
+
+	name = descriptor.name;
+	tag = descriptor.tag;
+
+	if (game_object_parent != nullptr)
+	{
+		game_object_parent->AddChild(this);
+	}
+
+	is_static = descriptor.is_static;
+	active = descriptor.active;
+
+	transform.owner = this;
+	transform.UUID = descriptor.transform_UUID;
+	transform.active = descriptor.transform_active;
+	transform.SetTranslation(descriptor.translation);
+	transform.SetRotation(descriptor.rotation);
+	transform.SetScale(descriptor.scale);
+
+	transform_2d.owner = this;
+	transform_2d.Load(descriptor.transform_2d_config);
+	transform_2d_enabled = descriptor.transform_2d_enabled;
+
+	for (const auto& component_descriptor : descriptor.components)
+	{
+		LoadComponent(component_descriptor);
+	}
+
+	// Space partitioning trees are regenerated once by the scene after every game object is loaded, only the AABB tree is updated here
+	SetHierarchyStatic(is_static);
+	App->scene->ReindexGameObject(this);
+}
+
+// Brings back the saved state of a game object that outlived play mode. Components whose saved state did not change are kept,
+// the rest are recreated from the descriptor. Space partitioning trees are regenerated by the caller.
+void GameObject::Restore(const GameObjectDescriptor& descriptor, GameObject* game_object_parent)
+{
+	assert(UUID == descriptor.UUID);
+
+	name = descriptor.name;
+	tag = descriptor.tag;
+
+	if (game_object_parent != nullptr)
+	{
+		SetParent(game_object_parent);
+	}
+
+	if (is_static != descriptor.is_static)
+	{
+		is_static = descriptor.is_static;
+		(is_static) ? App->space_partitioning->RemoveAABBTree(this) : App->space_partitioning->InsertAABBTree(this);
+	}
+	active = descriptor.active;
+
+	transform.active = descriptor.transform_active;
+	transform.SetTranslation(descriptor.translation);
+	transform.SetRotation(descriptor.rotation);
+	transform.SetScale(descriptor.scale);
+
+	transform_2d.Load(descriptor.transform_2d_config);
+	transform_2d_enabled = descriptor.transform_2d_enabled;
+
+	std::vector<Component*> components_added_in_play_mode = components;
+	for (const auto& component_descriptor : descriptor.components)
+	{
+		Component* component = GetComponent(component_descriptor.UUID);
+		bool modified_by_user = false;
+		bool added_by_user = false;
+		if (component != nullptr)
+		{
+			components_added_in_play_mode.erase(std::find(components_added_in_play_mode.begin(), components_added_in_play_mode.end(), component));
+
+			Config component_config;
+			component->Save(component_config);
+			if (!HasPlayModeState(component->GetType()) && component_descriptor.Matches(component_config))
+			{
+				continue;
+			}
+
+			modified_by_user = component->modified_by_user;
+			added_by_user = component->added_by_user;
+			RemoveComponent(component);
+		}
+
+		Component* restored_component = LoadComponent(component_descriptor);
+		restored_component->modified_by_user = modified_by_user;
+		restored_component->added_by_user = added_by_user;
+	}
+
+	for (const auto& component : components_added_in_play_mode)
+	{
+		RemoveComponent(component);
+	}
+
+	App->scene->ReindexGameObject(this);
+}
+
+Component* GameObject::LoadComponent(const GameObjectDescriptor::ComponentDescriptor& component_descriptor)
+{
+	assert(static_cast<uint64_t>(component_descriptor.type) != 0);
+
+	Component* created_component = nullptr;
+	if (component_descriptor.type == Component::ComponentType::COLLIDER)
+	{
+		created_component = CreateComponent(static_cast<ComponentCollider::ColliderType>(component_descriptor.collider_type));
+	}
+	else
+	{
+		created_component = CreateComponent(component_descriptor.type);
+	}
+	if (component_descriptor.from_record)
+	{
+		static_cast<ComponentMeshRenderer*>(created_component)->Load(component_descriptor.UUID, component_descriptor.active, component_descriptor.mesh_renderer);
+	}
+	else
+	{
+		created_component->Load(component_descriptor.config);
+	}
+	return created_component;
+}
+
+// Playing, simulation or script state that is not saved, a component like this has to be recreated even when its saved state is unchanged
+bool GameObject::HasPlayModeState(Component::ComponentType type)
+{
+	switch (type)
+	{
+	case Component::ComponentType::ANIMATION:
+	case Component::ComponentType::AUDIO_SOURCE:
+	case Component::ComponentType::BILLBOARD:
+	case Component::ComponentType::COLLIDER:
+	case Component::ComponentType::PARTICLE_SYSTEM:
+	case Component::ComponentType::SCRIPT:
+	case Component::ComponentType::TRAIL:
+	case Component::ComponentType::VIDEO_PLAYER:
+		return true;
+
+	default:
+		return false;
+	}
 }
 
 void GameObject::SetParent(GameObject* new_parent)
@@ -394,6 +549,11 @@ void GameObject::AddChild(GameObject* child)
 		child->parent->RemoveChild(child);
 	}
 
+	child->transform.UpdateGlobalModelMatrix();
+	if (transform.hierarchy != nullptr)
+	{
+		transform.hierarchy->MarkTopologyDirty();
+	}
 	child->parent = this;
 	child->UpdateHierarchyDepth();
 	child->UpdateHierarchyBranch();
@@ -412,6 +572,11 @@ void GameObject::RemoveChild(GameObject* child)
 		return;
 	}
 	children.erase(found);
+	if (transform.hierarchy != nullptr)
+	{
+		transform.hierarchy->MarkTopologyDirty();
+	}
+	child->transform.UpdateGlobalModelMatrix();
 	child->parent = nullptr;
 	child->hierarchy_depth = 0;
 }
@@ -517,7 +682,7 @@ Component* GameObject::CreateComponent(const Component::ComponentType type)
 	}
 	created_component->owner = this;
 
-	components.push_back(created_component);
+	AddComponent(created_component);
 	created_component->Init();
 
 
@@ -533,17 +698,29 @@ Component* GameObject::CreateComponent(const Component::ComponentType type)
 Component* GameObject::CreateComponent(const ComponentCollider::ColliderType collider_type)
 {
 	Component* created_component = App->physics->CreateComponentCollider(collider_type, this);
-	components.push_back(created_component);
+	AddComponent(created_component);
 	return created_component;
 }
 
+void GameObject::AddComponent(Component* component)
+{
+	components.push_back(component);
+	UpdateComponentSlots();
+	if (!original_prefab)
+	{
+		App->scene->IndexComponent(component);
+	}
+}
+
 void GameObject::RemoveComponent(Component* component_to_remove)
 {
 	const auto it = std::find(components.begin(), components.end(), component_to_remove);
 	if (it != components.end())
 	{
+		App->scene->UnindexComponent(component_to_remove);
 		component_to_remove->Delete();
 		components.erase(it);
+		UpdateComponentSlots();
 	}
 }
 void GameObject::RemoveComponent(uint64_t UUID)
@@ -555,16 +732,42 @@ void GameObject::RemoveComponent(uint64_t UUID)
 	}
 }
 
-Component* GameObject::GetComponent(const Component::ComponentType type) const
+void GameObject::UpdateComponentSlots()
 {
- 	for (unsigned int i = 0; i < components.size(); ++i)
+	component_mask = 0;
+	component_slots.fill(nullptr);
+	scripts_by_name.clear();
+	for (const auto& component : components)
 	{
-		if (components[i]->GetType() == type)
+		if (component == nullptr)
 		{
-			return components[i];
+			continue;
+		}
+
+		size_t type_index = static_cast<size_t>(component->GetType());
+		assert(type_index < MAX_COMPONENT_TYPES);
+		if ((component_mask & (1u << type_index)) == 0)
+		{
+			component_mask |= 1u << type_index;
+			component_slots[type_index] = component;
+		}
+
+		if (component->GetType() == Component::ComponentType::SCRIPT)
+		{
+			ComponentScript* script = static_cast<ComponentScript*>(component);
+			scripts_by_name.emplace(script->name, script);
 		}
 	}
-	return nullptr;
+}
+
+bool GameObject::HasComponent(const Component::ComponentType type) const
+{
+	return (component_mask & (1u << static_cast<size_t>(type))) != 0;
+}
+
+Component* GameObject::GetComponent(const Component::ComponentType type) const
+{
+	return component_slots[static_cast<size_t>(type)];
 }
 
 Component* GameObject::GetComponent(uint64_t UUID) const
@@ -581,19 +784,8 @@ Component* GameObject::GetComponent(uint64_t UUID) const
 
 ComponentScript* GameObject::GetComponentScript(const char* name) const
 {
-	for (unsigned int i = 0; i < components.size(); ++i)
-	{
-		if (components[i]->type == Component::ComponentType::SCRIPT)
-		{
-			ComponentScript* script = (ComponentScript* )components[i];
-			if (script->name == name)
-			{
-				return script;
-			}
-		}
-	}
-
-	return nullptr;
+	const auto found = scripts_by_name.find(name);
+	return found != scripts_by_name.end() ? found->second : nullptr;
 }
 
 Component* GameObject::GetComponent(const ComponentCollider::ColliderType collider_type) const
@@ -775,6 +967,7 @@ void GameObject::Reassign()
 void GameObject::CopyComponents(const GameObject& gameobject_to_copy)
 {
 	this->components.clear();
+	UpdateComponentSlots();
 	this->components.reserve(gameobject_to_copy.components.size());
 	for (const auto& component : gameobject_to_copy.components)
 	{
@@ -12,8 +12,11 @@
 #include "Component/ComponentScript.h"
 #include "Component/ComponentTransform.h"
 #include "Component/ComponentTransform2D.h"
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
 
 #include <GL/glew.h>
+#include <array>
+#include <unordered_map>
 
 class Prefab;
 class ComponentCamera;
@@ -36,8 +39,14 @@ public:
 
 	void Duplicate(const GameObject& gameobject_to_copy, GameObject* parent);
 
+	// Copies a prefab game object without rebuilding the space partitioning trees, the caller rebuilds them once for every instance
+	void CopyFromPrefab(const GameObject& prefab_game_object);
+
 	void SetTransform(GameObject* game_object);
 
+	ENGINE_API void SetName(const std::string& name);
+	ENGINE_API void SetTag(const std::string& tag);
+
 	ENGINE_API bool IsEnabled() const;
 	ENGINE_API void SetEnabled(bool able);
 
@@ -50,7 +59,9 @@ public:
 
 	void Save(Config& config) const;
 	void Load(const Config& config);
-	void Delete(std::vector<GameObject*>& children_to_remove);
+	void Load(const GameObjectDescriptor& descriptor, GameObject* game_object_parent);
+	void Restore(const GameObjectDescriptor& descriptor, GameObject* game_object_parent);
+	ENGINE_API bool IsMarkedForDestruction() const;
 
 	void SetParent(GameObject* new_parent);
 	void AddChild(GameObject* child);
@@ -61,8 +72,11 @@ public:
 
 	ENGINE_API Component* CreateComponent(const Component::ComponentType type);
 	ENGINE_API Component* CreateComponent(const ComponentCollider::ColliderType collider_type);
+	void AddComponent(Component* component);
 	void RemoveComponent(Component* component);
 	void RemoveComponent(uint64_t UUID);
+	void UpdateComponentSlots();
+	ENGINE_API bool HasComponent(const Component::ComponentType type) const;
 	ENGINE_API Component* GetComponent(const Component::ComponentType type) const;
 	ENGINE_API Component * GetComponent(uint64_t UUID) const;
 	ENGINE_API ComponentScript* GetComponentScript(const char* name) const;
@@ -94,6 +108,9 @@ public:
 private:
 	void SetHierarchyStatic(bool is_static);
 
+	Component* LoadComponent(const GameObjectDescriptor::ComponentDescriptor& component_descriptor);
+	static bool HasPlayModeState(Component::ComponentType type);
+
 	void LoadTransforms(Config config);
 	void CreateTransforms();
 	void CopyComponents(const GameObject& gameobject_to_copy);
@@ -131,6 +148,15 @@ private:
 	int hierarchy_depth = 0;
 	int hierarchy_branch = 0;
 
+	bool marked_for_destruction = false; // Set by ModuleScene, the game object is destroyed at the end of the frame
+
+	// First component of each type and script by name, rebuilt by UpdateComponentSlots when components change
+	static const size_t MAX_COMPONENT_TYPES = 32;
+	uint32_t component_mask = 0;
+	std::array<Component*, MAX_COMPONENT_TYPES> component_slots{};
+	std::unordered_map<std::string, ComponentScript*> scripts_by_name;
+
+	friend class ModuleScene;
 	friend class PanelGameObject;
 };
 
@@ -0,0 +1,143 @@
+#include "HeadlessRunner.h"
+
+#include "Application.h"
+#include "Log/EngineLog.h"
+#include "Module/ModuleScene.h"
+#include "Module/ModuleTime.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+
+HeadlessRunner::HeadlessRunner(int argc, char** argv)
+{
+	ParseArguments(argc, argv);
+}
+
+bool HeadlessRunner::IsRequested(int argc, char** argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--headless") == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void HeadlessRunner::ParseArguments(int argc, char** argv)
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		bool has_value = i + 1 < argc;
+		if (strcmp(argv[i], "--scene") == 0 && has_value)
+		{
+			scene_path = argv[++i];
+		}
+		else if (strcmp(argv[i], "--frames") == 0 && has_value)
+		{
+			frames = std::max(1L, atol(argv[++i]));
+		}
+		else if (strcmp(argv[i], "--warmup") == 0 && has_value)
+		{
+			warmup_frames = std::max(0L, atol(argv[++i]));
+		}
+		else if (strcmp(argv[i], "--delta-time") == 0 && has_value)
+		{
+			delta_time = static_cast<float>(atof(argv[++i]));
+		}
+	}
+}
+
+int HeadlessRunner::Run()
+{
+	APP_LOG_SECTION("-------------- Headless Application Init --------------");
+	App = new Application(true);
+	if (!App->Init())
+	{
+		APP_LOG_ERROR("Headless Application Init exits with error -----");
+		App->CleanUp();
+		delete App;
+		App = nullptr;
+		return EXIT_FAILURE;
+	}
+
+	App->time->SetFixedDeltaTime(delta_time);
+	if (scene_path.empty())
+	{
+		App->scene->LoadScene(0);
+	}
+	else
+	{
+		App->scene->LoadScene(scene_path);
+	}
+
+	// The scene streams in over several frames, none of them is a warmup frame
+	update_status status = update_status::UPDATE_CONTINUE;
+	long loading_frames = 0;
+	while ((App->scene->HasPendingSceneToLoad() || App->scene->IsLoadingScene()) && status == update_status::UPDATE_CONTINUE)
+	{
+		status = App->Update();
+		++loading_frames;
+	}
+	APP_LOG_INFO("Headless scene loaded in %ld frames", loading_frames);
+
+	// Warmup frames let the scripts run their first updates
+	for (long i = 0; i < warmup_frames && status == update_status::UPDATE_CONTINUE; ++i)
+	{
+		status = App->Update();
+	}
+
+	APP_LOG_SECTION("-------------- Headless Application Update --------------");
+	frame_times.clear();
+	frame_times.reserve(frames);
+	for (long i = 0; i < frames && status == update_status::UPDATE_CONTINUE; ++i)
+	{
+		auto frame_start = std::chrono::high_resolution_clock::now();
+		status = App->Update();
+		auto frame_end = std::chrono::high_resolution_clock::now();
+		frame_times.push_back(std::chrono::duration<double, std::milli>(frame_end - frame_start).count());
+	}
+
+	if (status == update_status::UPDATE_ERROR)
+	{
+		APP_LOG_ERROR("Headless Application Update exits with error -----");
+	}
+	ReportFrameTimes();
+
+	APP_LOG_SECTION("-------------- Headless Application CleanUp --------------");
+	bool cleaned_up = App->CleanUp();
+	delete App;
+	App = nullptr;
+
+	return cleaned_up && status != update_status::UPDATE_ERROR ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+void HeadlessRunner::ReportFrameTimes() const
+{
+	if (frame_times.empty())
+	{
+		return;
+	}
+
+	std::vector<double> sorted_frame_times(frame_times);
+	std::sort(sorted_frame_times.begin(), sorted_frame_times.end());
+
+	double total_time = std::accumulate(frame_times.begin(), frame_times.end(), 0.0);
+	double average_time = total_time / frame_times.size();
+	double percentile_99_time = sorted_frame_times[std::min(sorted_frame_times.size() - 1, sorted_frame_times.size() * 99 / 100)];
+	double frames_per_second = total_time > 0.0 ? frame_times.size() * 1000.0 / total_time : 0.0;
+
+	char report[512];
+	snprintf(report, sizeof(report),
+		"Headless run: %zu frames in %.2f ms. %.2f frames/s. Frame time avg %.3f ms, min %.3f ms, p99 %.3f ms, max %.3f ms",
+		frame_times.size(), total_time, frames_per_second, average_time, sorted_frame_times.front(), percentile_99_time, sorted_frame_times.back()
+	);
+
+	APP_LOG_INFO("%s", report);
+	printf("%s\n", report);
+}
@@ -0,0 +1,36 @@
+#ifndef _HEADLESSRUNNER_H_
+#define _HEADLESSRUNNER_H_
+
+#include <string>
+#include <vector>
+
+/*
+	Command line entry point for the headless runtime:
+		LittleOrionEngine.exe --headless [--scene <scene path>] [--frames <count>] [--warmup <count>] [--delta-time <ms>]
+	Runs the application with no window, GL context or editor, ticks the scene without vsync nor frame cap
+	and reports the throughput in frames per second.
+*/
+class HeadlessRunner
+{
+public:
+	HeadlessRunner(int argc, char** argv);
+	~HeadlessRunner() = default;
+
+	static bool IsRequested(int argc, char** argv);
+
+	int Run();
+
+private:
+	void ParseArguments(int argc, char** argv);
+	void ReportFrameTimes() const;
+
+private:
+	std::string scene_path;
+	long frames = 1000;
+	long warmup_frames = 10;
+	float delta_time = 1000.f / 60.f;
+
+	std::vector<double> frame_times;
+};
+
+#endif // _HEADLESSRUNNER_H_
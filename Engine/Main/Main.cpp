@@ -4,6 +4,7 @@
 #include "Application.h"
 #include "Log/EngineLog.h"
 #include "Globals.h"
+#include "HeadlessRunner.h"
 #include "Helper/TimerUs.h"
 
 #include <SDL/SDL.h>
@@ -35,6 +36,12 @@ int main(int argc, char ** argv)
 		return main_return;
 	}
 
+	if (HeadlessRunner::IsRequested(argc, argv))
+	{
+		HeadlessRunner headless_runner(argc, argv);
+		return headless_runner.Run();
+	}
+
 	while (state != MAIN_EXIT)
 	{
 		switch (state)
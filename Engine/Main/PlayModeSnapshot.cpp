@@ -0,0 +1,229 @@
+#include "PlayModeSnapshot.h"
+
+#include "Helper/Config.h"
+#include "Helper/JobSystem.h"
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+#include "Main/GameObject.h"
+#include "Module/ModuleAnimation.h"
+#include "Module/ModuleResourceManager.h"
+#include "Module/ModuleScene.h"
+#include "Module/ModuleScriptManager.h"
+
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
+#include "ResourceManagement/Resources/Prefab.h"
+#include "ResourceManagement/Resources/Scene.h"
+
+#include <Brofiler/Brofiler.h>
+#include <algorithm>
+#include <atomic>
+#include <stack>
+#include <unordered_set>
+
+void PlayModeSnapshot::Save(GameObject* root)
+{
+	BROFILER_CATEGORY("Save Play Mode Snapshot", Profiler::Color::Brown);
+	Clear();
+
+	// Parents are saved before their children, so they already exist when a destroyed subtree is recreated
+	SceneBinary::Writer snapshot_writer;
+	snapshot_writer.StartArray("GameObjects");
+	std::stack<GameObject*> pending_objects;
+	for (auto it = root->children.rbegin(); it != root->children.rend(); ++it)
+	{
+		pending_objects.push(*it);
+	}
+	while (!pending_objects.empty())
+	{
+		GameObject* game_object = pending_objects.top();
+		pending_objects.pop();
+
+		Config game_object_config;
+		game_object->Save(game_object_config);
+		snapshot_writer.Add(game_object_config);
+
+		if (game_object->prefab_reference != nullptr)
+		{
+			PrefabLink& prefab_link = prefab_links[game_object->UUID];
+			prefab_link.prefab_reference = game_object->prefab_reference;
+			prefab_link.original_UUID = game_object->original_UUID;
+			prefab_link.is_prefab_parent = game_object->is_prefab_parent;
+			prefab_link.original_prefab = game_object->original_prefab;
+			prefab_link.modified_by_user = game_object->modified_by_user;
+			prefab_link.transform_modified_by_user = game_object->transform.modified_by_user;
+			for (const auto& component : game_object->components)
+			{
+				if (component->modified_by_user)
+				{
+					prefab_link.modified_components.push_back(component->UUID);
+				}
+				if (component->added_by_user)
+				{
+					prefab_link.added_components.push_back(component->UUID);
+				}
+			}
+		}
+
+		for (auto it = game_object->children.rbegin(); it != game_object->children.rend(); ++it)
+		{
+			pending_objects.push(*it);
+		}
+	}
+
+	snapshot_writer.EndArray();
+
+	Config settings_config;
+	Scene::SaveSettings(settings_config);
+	snapshot_writer.AddMembers(settings_config);
+
+	FileData binary_data = snapshot_writer.Finish();
+	const char* binary_buffer = static_cast<const char*>(binary_data.buffer);
+	snapshot_data.assign(binary_buffer, binary_buffer + binary_data.size);
+	delete[] binary_data.buffer;
+	scene_binary = std::make_unique<SceneBinary>(snapshot_data.data(), snapshot_data.size());
+
+	// Holding the resources keeps them cached, so game objects recreated by Restore do not load them again
+	std::unordered_set<uint32_t> resources_UUIDs;
+	GameObjectDescriptor descriptor;
+	for (size_t i = 0; i < scene_binary->GetNumGameObjects(); ++i)
+	{
+		if (!descriptor.Parse(*scene_binary, i))
+		{
+			APP_LOG_ERROR("Error saving play mode snapshot, game object %zu does not read back.", i);
+			Clear();
+			return;
+		}
+		resources_UUIDs.insert(descriptor.resources.begin(), descriptor.resources.end());
+	}
+	for (const auto& resource_UUID : resources_UUIDs)
+	{
+		std::shared_ptr<Resource> resource = App->resources->RetrieveFromCacheIfExist(resource_UUID);
+		if (resource != nullptr)
+		{
+			resources.push_back(resource);
+		}
+	}
+}
+
+bool PlayModeSnapshot::Restore(GameObject* root)
+{
+	BROFILER_CATEGORY("Restore Play Mode Snapshot", Profiler::Color::Brown);
+	if (IsEmpty())
+	{
+		return false;
+	}
+	App->scene->DestroyPendingGameObjects();
+
+	const SceneBinary& snapshot = *scene_binary;
+	std::vector<GameObjectDescriptor> descriptors(snapshot.GetNumGameObjects());
+	std::atomic<bool> parsed = true;
+	App->job_system->ParallelFor(descriptors.size(), PARSE_BATCH_SIZE, [&descriptors, &snapshot, &parsed](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (!descriptors[i].Parse(snapshot, i))
+			{
+				parsed = false;
+			}
+		}
+	});
+	if (!parsed)
+	{
+		APP_LOG_ERROR("Error reading play mode snapshot.");
+		Clear();
+		return false;
+	}
+
+	std::unordered_set<uint64_t> saved_UUIDs;
+	saved_UUIDs.reserve(descriptors.size());
+	for (const auto& descriptor : descriptors)
+	{
+		saved_UUIDs.insert(descriptor.UUID);
+
+		GameObject* parent = descriptor.parent_UUID == 0 ? root : App->scene->GetGameObject(descriptor.parent_UUID);
+		assert(parent != nullptr);
+
+		GameObject* game_object = App->scene->GetGameObject(descriptor.UUID);
+		if (game_object != nullptr)
+		{
+			game_object->Restore(descriptor, parent);
+		}
+		else
+		{
+			game_object = App->scene->CreateGameObject();
+			game_object->Load(descriptor, parent);
+			RestorePrefabLink(game_object);
+		}
+	}
+
+	// Saved game objects are back under their saved parents, what is left out of the snapshot was spawned while playing
+	std::stack<GameObject*> pending_objects;
+	pending_objects.push(root);
+	while (!pending_objects.empty())
+	{
+		GameObject* game_object = pending_objects.top();
+		pending_objects.pop();
+		for (const auto& child : game_object->children)
+		{
+			if (saved_UUIDs.find(child->UUID) == saved_UUIDs.end())
+			{
+				App->scene->DestroyGameObject(child);
+			}
+			else
+			{
+				pending_objects.push(child);
+			}
+		}
+	}
+	App->scene->DestroyPendingGameObjects();
+
+	Scene::LoadSettings(snapshot.GetHeader().settings);
+	App->scripts->ReLink();
+	App->animations->UpdateAnimationMeshes();
+
+	Clear();
+	return true;
+}
+
+void PlayModeSnapshot::Clear()
+{
+	scene_binary = nullptr;
+	snapshot_data.clear();
+	snapshot_data.shrink_to_fit();
+	prefab_links.clear();
+	resources.clear();
+}
+
+bool PlayModeSnapshot::IsEmpty() const
+{
+	return scene_binary == nullptr || !scene_binary->IsValid();
+}
+
+void PlayModeSnapshot::RestorePrefabLink(GameObject* game_object) const
+{
+	const auto it = prefab_links.find(game_object->UUID);
+	if (it == prefab_links.end())
+	{
+		return;
+	}
+
+	const PrefabLink& prefab_link = it->second;
+	game_object->prefab_reference = prefab_link.prefab_reference;
+	game_object->original_UUID = prefab_link.original_UUID;
+	game_object->is_prefab_parent = prefab_link.is_prefab_parent;
+	game_object->original_prefab = prefab_link.original_prefab;
+	game_object->modified_by_user = prefab_link.modified_by_user;
+	game_object->transform.modified_by_user = prefab_link.transform_modified_by_user;
+	for (const auto& component : game_object->components)
+	{
+		const auto& modified_components = prefab_link.modified_components;
+		const auto& added_components = prefab_link.added_components;
+		component->modified_by_user = std::find(modified_components.begin(), modified_components.end(), component->UUID) != modified_components.end();
+		component->added_by_user = std::find(added_components.begin(), added_components.end(), component->UUID) != added_components.end();
+	}
+
+	if (prefab_link.is_prefab_parent)
+	{
+		prefab_link.prefab_reference->instances.push_back(game_object);
+	}
+}
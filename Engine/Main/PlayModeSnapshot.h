@@ -0,0 +1,60 @@
+#ifndef _PLAYMODESNAPSHOT_H_
+#define _PLAYMODESNAPSHOT_H_
+
+#include "ResourceManagement/Manager/SceneBinary.h"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+class Prefab;
+class Resource;
+
+/*
+	Scene state taken when play mode starts, kept in memory in the binary scene format.
+	Restore diffs it against the live scene: game objects spawned while playing are destroyed, destroyed ones are recreated
+	and the ones that survived get their saved state back in place. Resources referenced by the snapshot stay cached meanwhile.
+*/
+class PlayModeSnapshot
+{
+public:
+	PlayModeSnapshot() = default;
+	~PlayModeSnapshot() = default;
+
+	PlayModeSnapshot(const PlayModeSnapshot& snapshot_to_copy) = delete;
+	PlayModeSnapshot& operator=(const PlayModeSnapshot& snapshot_to_copy) = delete;
+
+	void Save(GameObject* root);
+	bool Restore(GameObject* root);
+	void Clear();
+
+	bool IsEmpty() const;
+
+private:
+	void RestorePrefabLink(GameObject* game_object) const;
+
+private:
+	// Prefab state is not part of the saved game object, it is only needed to recreate prefab instances
+	struct PrefabLink
+	{
+		std::shared_ptr<Prefab> prefab_reference = nullptr;
+		uint64_t original_UUID = 0;
+		bool is_prefab_parent = false;
+		bool original_prefab = false;
+		bool modified_by_user = false;
+		bool transform_modified_by_user = false;
+		std::vector<uint64_t> modified_components;
+		std::vector<uint64_t> added_components;
+	};
+
+	static const size_t PARSE_BATCH_SIZE = 64;
+
+	std::vector<char> snapshot_data;
+	std::unique_ptr<SceneBinary> scene_binary = nullptr;
+	std::unordered_map<uint64_t, PrefabLink> prefab_links;
+	std::vector<std::shared_ptr<Resource>> resources;
+};
+
+#endif // _PLAYMODESNAPSHOT_H_
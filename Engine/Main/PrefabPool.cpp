@@ -0,0 +1,243 @@
+#include "PrefabPool.h"
+
+#include "Component/ComponentCollider.h"
+#include "Component/ComponentScript.h"
+#include "Main/Application.h"
+#include "Main/GameObject.h"
+#include "Module/ModulePhysics.h"
+#include "Module/ModuleScene.h"
+
+#include "ResourceManagement/Resources/Prefab.h"
+
+#include <Brofiler/Brofiler.h>
+#include <algorithm>
+#include <stack>
+
+namespace
+{
+	// Components are cloned in the order of the prefab, the nth component of a type matches the nth one of the prefab game object
+	const Component* GetPrefabComponent(const GameObject& game_object, size_t component_index, const GameObject& prefab_game_object)
+	{
+		Component::ComponentType type = game_object.components[component_index]->type;
+		size_t occurrence = std::count_if(game_object.components.begin(), game_object.components.begin() + component_index, [type](const Component* component)
+		{
+			return component->type == type;
+		});
+
+		for (const auto& prefab_component : prefab_game_object.components)
+		{
+			if (prefab_component->type == type && occurrence-- == 0)
+			{
+				return prefab_component;
+			}
+		}
+		return nullptr;
+	}
+}
+
+PrefabPool::PrefabPool(const std::shared_ptr<Prefab>& prefab) : prefab(prefab)
+{
+}
+
+void PrefabPool::Warmup(size_t warmup_count)
+{
+	BROFILER_CATEGORY("Warmup Prefab Pool", Profiler::Color::Brown);
+	this->warmup_count = warmup_count;
+	if (parked_instances.size() >= warmup_count)
+	{
+		return;
+	}
+
+	std::vector<GameObject*> created_instances = prefab->InstantiateBatch(App->scene->GetRoot(), warmup_count - parked_instances.size());
+	parked_instances.reserve(warmup_count);
+	parked_lookup.reserve(warmup_count);
+	for (const auto& instance : created_instances)
+	{
+		Park(instance);
+	}
+}
+
+GameObject* PrefabPool::Spawn(GameObject* parent, const float3& translation, const Quat& rotation)
+{
+	++spawns;
+	if (parked_instances.empty())
+	{
+		std::vector<float4x4> transforms = { float4x4::FromTRS(translation, rotation, prefab->GetRootGameObject()->transform.GetScale()) };
+		GameObject* created_instance = prefab->InstantiateBatch(parent, 1, transforms).front();
+		spawned_instances.insert(created_instance);
+		return created_instance;
+	}
+
+	++hits;
+	GameObject* instance = parked_instances.back();
+	parked_instances.pop_back();
+	parked_lookup.erase(instance);
+
+	instance->SetParent(parent);
+	instance->transform.SetTranslation(translation);
+	instance->transform.SetRotation(rotation);
+	instance->SetEnabled(true);
+
+	// What is disabled in the prefab stays disabled, rigid bodies are moved to the new place before simulating again
+	std::vector<ComponentCollider*> colliders;
+	ForEachPrefabGameObject(instance, [&colliders](GameObject& game_object, const GameObject* prefab_game_object)
+	{
+		if (prefab_game_object != nullptr && !prefab_game_object->IsEnabled())
+		{
+			game_object.SetEnabled(false);
+		}
+
+		for (size_t i = 0; i < game_object.components.size(); ++i)
+		{
+			Component* component = game_object.components[i];
+			const Component* prefab_component = prefab_game_object != nullptr ? GetPrefabComponent(game_object, i, *prefab_game_object) : nullptr;
+			if (prefab_component != nullptr && !prefab_component->IsEnabled())
+			{
+				component->Disable();
+			}
+			if (component->type == Component::ComponentType::COLLIDER)
+			{
+				colliders.push_back(static_cast<ComponentCollider*>(component));
+			}
+		}
+	});
+	App->physics->UpdateColliderDimensions(colliders);
+
+	spawned_instances.insert(instance);
+	return instance;
+}
+
+bool PrefabPool::Despawn(GameObject* instance)
+{
+	if (instance == nullptr || !instance->is_prefab_parent || instance->prefab_reference == nullptr || instance->prefab_reference->GetUUID() != prefab->GetUUID())
+	{
+		return false;
+	}
+
+	if (parked_lookup.find(instance) != parked_lookup.end())
+	{
+		return true;
+	}
+
+	++despawns;
+	spawned_instances.erase(instance);
+	ResetToPrefab(instance);
+	Park(instance);
+	return true;
+}
+
+void PrefabPool::Forget(GameObject* instance)
+{
+	spawned_instances.erase(instance);
+	if (parked_lookup.erase(instance) > 0)
+	{
+		parked_instances.erase(std::remove(parked_instances.begin(), parked_instances.end(), instance), parked_instances.end());
+	}
+}
+
+void PrefabPool::Clear()
+{
+	for (const auto& instance : parked_instances)
+	{
+		App->scene->DestroyGameObject(instance);
+	}
+	parked_instances.clear();
+	parked_lookup.clear();
+	spawned_instances.clear();
+}
+
+const std::shared_ptr<Prefab>& PrefabPool::GetPrefab() const
+{
+	return prefab;
+}
+
+size_t PrefabPool::GetNumParked() const
+{
+	return parked_instances.size();
+}
+
+size_t PrefabPool::GetNumSpawned() const
+{
+	return spawned_instances.size();
+}
+
+float PrefabPool::GetHitRate() const
+{
+	return spawns > 0 ? static_cast<float>(hits) / static_cast<float>(spawns) : 0.f;
+}
+
+void PrefabPool::Park(GameObject* instance)
+{
+	instance->SetEnabled(false);
+	instance->SetParent(App->scene->GetRoot());
+	parked_instances.push_back(instance);
+	parked_lookup.insert(instance);
+}
+
+// Game objects and components added while playing are not in the prefab and are left as they are
+void PrefabPool::ResetToPrefab(GameObject* instance) const
+{
+	ForEachPrefabGameObject(instance, [](GameObject& game_object, const GameObject* prefab_game_object)
+	{
+		if (prefab_game_object == nullptr)
+		{
+			return;
+		}
+
+		game_object.transform = prefab_game_object->transform;
+		for (size_t i = 0; i < game_object.components.size(); ++i)
+		{
+			Component* component = game_object.components[i];
+			const Component* prefab_component = GetPrefabComponent(game_object, i, *prefab_game_object);
+			if (prefab_component == nullptr)
+			{
+				continue;
+			}
+
+			switch (component->type)
+			{
+			case Component::ComponentType::COLLIDER:
+			{
+				// Copying a collider would share the collision shape of the prefab, only its motion is reset
+				static_cast<ComponentCollider*>(component)->ResetMotion();
+				break;
+			}
+
+			case Component::ComponentType::SCRIPT:
+			{
+				// Copying a script would construct it again, it runs Awake and Start again once spawned instead
+				ComponentScript* component_script = static_cast<ComponentScript*>(component);
+				component_script->awaken = false;
+				component_script->started = false;
+				break;
+			}
+
+			default:
+			{
+				uint64_t component_UUID = component->UUID;
+				prefab_component->CopyTo(component);
+				component->UUID = component_UUID;
+				component->owner = &game_object;
+				break;
+			}
+			}
+		}
+	});
+}
+
+template<typename Function>
+void PrefabPool::ForEachPrefabGameObject(GameObject* instance, Function function) const
+{
+	std::stack<GameObject*> pending_objects;
+	pending_objects.push(instance);
+	while (!pending_objects.empty())
+	{
+		GameObject* game_object = pending_objects.top();
+		pending_objects.pop();
+		function(*game_object, prefab->GetOriginalGameObject(game_object->original_UUID));
+		for (const auto& child : game_object->children)
+		{
+			pending_objects.push(child);
+		}
+	}
+}
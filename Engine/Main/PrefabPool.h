@@ -0,0 +1,67 @@
+#ifndef _PREFABPOOL_H_
+#define _PREFABPOOL_H_
+
+#include <MathGeoLib.h>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+class GameObject;
+class Prefab;
+
+/*
+	Instances of one prefab that are recycled instead of destroyed. A despawned instance is put back to the state of the
+	prefab, disabled and parked under the scene root, so spawning it again only places and enables it.
+	Colliders keep their rigid bodies, which stay out of the simulation while the instance is parked.
+*/
+class PrefabPool
+{
+public:
+	PrefabPool(const std::shared_ptr<Prefab>& prefab);
+	~PrefabPool() = default;
+
+	PrefabPool(const PrefabPool& pool_to_copy) = delete;
+	PrefabPool& operator=(const PrefabPool& pool_to_copy) = delete;
+
+	// Instantiates what is missing to have warmup_count instances parked
+	void Warmup(size_t warmup_count);
+
+	GameObject* Spawn(GameObject* parent, const float3& translation, const Quat& rotation);
+
+	// Any instance of the prefab can be despawned, also the ones that were not spawned by the pool
+	bool Despawn(GameObject* instance);
+
+	// Instances destroyed by the scene are no longer pooled
+	void Forget(GameObject* instance);
+
+	// Destroys the parked instances, spawned ones stay in the scene
+	void Clear();
+
+	const std::shared_ptr<Prefab>& GetPrefab() const;
+	size_t GetNumParked() const;
+	size_t GetNumSpawned() const;
+	float GetHitRate() const;
+
+public:
+	size_t warmup_count = 0;
+
+	size_t spawns = 0;
+	size_t hits = 0; // Spawns served by a parked instance
+	size_t despawns = 0;
+
+private:
+	void Park(GameObject* instance);
+	void ResetToPrefab(GameObject* instance) const;
+
+	// Walks the instance with the prefab game object each game object was copied from, if any
+	template<typename Function>
+	void ForEachPrefabGameObject(GameObject* instance, Function function) const;
+
+private:
+	std::shared_ptr<Prefab> prefab;
+	std::vector<GameObject*> parked_instances; // Spawned again from the back
+	std::unordered_set<GameObject*> parked_lookup; // Same instances as parked_instances, to check them in constant time
+	std::unordered_set<GameObject*> spawned_instances;
+};
+
+#endif // _PREFABPOOL_H_
@@ -0,0 +1,273 @@
+#include "SceneIndex.h"
+
+#include "Component/Component.h"
+#include "Main/GameObject.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+	template<typename Map, typename Key, typename Value>
+	void EraseEntry(Map& map, const Key& key, const Value& value)
+	{
+		auto range = map.equal_range(key);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == value)
+			{
+				map.erase(it);
+				return;
+			}
+		}
+	}
+}
+
+void SceneIndex::Clear()
+{
+	indexed_game_objects.clear();
+	game_objects_by_UUID.clear();
+	game_objects_by_name.clear();
+	game_objects_by_tag.clear();
+	indexed_components.clear();
+	components_by_UUID.clear();
+	for (auto& components : components_by_type)
+	{
+		components.clear();
+	}
+}
+
+void SceneIndex::Index(GameObject* game_object)
+{
+	auto found = indexed_game_objects.find(game_object);
+	if (found != indexed_game_objects.end())
+	{
+		Reindex(game_object);
+		return;
+	}
+
+	IndexedGameObject& indexed_game_object = indexed_game_objects[game_object];
+	indexed_game_object.order = next_order++;
+	InsertKeys(game_object, indexed_game_object);
+
+	for (const auto& component : game_object->components)
+	{
+		IndexComponent(component);
+	}
+}
+
+void SceneIndex::Unindex(const GameObject* game_object)
+{
+	auto found = indexed_game_objects.find(game_object);
+	if (found == indexed_game_objects.end())
+	{
+		return;
+	}
+
+	for (const auto& component : game_object->components)
+	{
+		UnindexComponent(component);
+	}
+
+	EraseKeys(game_object, found->second);
+	indexed_game_objects.erase(found);
+}
+
+void SceneIndex::Reindex(GameObject* game_object)
+{
+	auto found = indexed_game_objects.find(game_object);
+	if (found == indexed_game_objects.end())
+	{
+		return;
+	}
+
+	IndexedGameObject& indexed_game_object = found->second;
+	if (indexed_game_object.UUID != game_object->UUID || indexed_game_object.name != game_object->name || indexed_game_object.tag != game_object->tag)
+	{
+		EraseKeys(game_object, indexed_game_object);
+		InsertKeys(game_object, indexed_game_object);
+	}
+
+	for (const auto& component : game_object->components)
+	{
+		IndexComponent(component);
+	}
+}
+
+bool SceneIndex::IsIndexed(const GameObject* game_object) const
+{
+	return indexed_game_objects.find(game_object) != indexed_game_objects.end();
+}
+
+void SceneIndex::IndexComponent(Component* component)
+{
+	if (component == nullptr || !IsIndexed(component->owner))
+	{
+		return;
+	}
+
+	// Transforms and bounding boxes live inside the game object, only components it owns are indexed
+	const std::vector<Component*>& owner_components = component->owner->components;
+	if (std::find(owner_components.begin(), owner_components.end(), component) == owner_components.end())
+	{
+		return;
+	}
+
+	auto found = indexed_components.find(component);
+	if (found != indexed_components.end())
+	{
+		if (found->second.UUID == component->UUID)
+		{
+			return;
+		}
+		EraseEntry(components_by_UUID, found->second.UUID, component);
+		found->second.UUID = component->UUID;
+		components_by_UUID[component->UUID] = component;
+		return;
+	}
+
+	IndexedComponent& indexed_component = indexed_components[component];
+	indexed_component.UUID = component->UUID;
+	indexed_component.type_index = static_cast<size_t>(component->GetType());
+	assert(indexed_component.type_index < MAX_COMPONENT_TYPES);
+
+	std::vector<Component*>& components_of_type = components_by_type[indexed_component.type_index];
+	indexed_component.type_position = components_of_type.size();
+	components_of_type.push_back(component);
+
+	components_by_UUID[component->UUID] = component;
+}
+
+void SceneIndex::UnindexComponent(const Component* component)
+{
+	auto found = indexed_components.find(component);
+	if (found == indexed_components.end())
+	{
+		return;
+	}
+
+	EraseEntry(components_by_UUID, found->second.UUID, component);
+
+	std::vector<Component*>& components_of_type = components_by_type[found->second.type_index];
+	Component* last_component = components_of_type.back();
+	components_of_type[found->second.type_position] = last_component;
+	indexed_components[last_component].type_position = found->second.type_position;
+	components_of_type.pop_back();
+
+	indexed_components.erase(found);
+}
+
+GameObject* SceneIndex::GetGameObject(uint64_t UUID) const
+{
+	auto found = game_objects_by_UUID.find(UUID);
+	if (found == game_objects_by_UUID.end() || found->second->UUID != UUID)
+	{
+		return nullptr;
+	}
+	return found->second;
+}
+
+GameObject* SceneIndex::GetGameObjectByName(const std::string& name) const
+{
+	return GetFirst(game_objects_by_name, name);
+}
+
+GameObject* SceneIndex::GetGameObjectWithTag(const std::string& tag) const
+{
+	return GetFirst(game_objects_by_tag, tag);
+}
+
+std::vector<GameObject*> SceneIndex::GetGameObjectsWithTag(const std::string& tag) const
+{
+	std::vector<GameObject*> tagged_game_objects;
+	auto found = game_objects_by_tag.find(tag);
+	if (found == game_objects_by_tag.end())
+	{
+		return tagged_game_objects;
+	}
+
+	tagged_game_objects.reserve(found->second.size());
+	for (const auto& ordered_game_object : found->second)
+	{
+		tagged_game_objects.push_back(ordered_game_object.game_object);
+	}
+	return tagged_game_objects;
+}
+
+Component* SceneIndex::GetComponent(uint64_t UUID) const
+{
+	auto found = components_by_UUID.find(UUID);
+	if (found == components_by_UUID.end() || found->second->UUID != UUID)
+	{
+		return nullptr;
+	}
+	return found->second;
+}
+
+const std::vector<Component*>& SceneIndex::GetComponents(Component::ComponentType type) const
+{
+	return components_by_type[static_cast<size_t>(type)];
+}
+
+size_t SceneIndex::Size() const
+{
+	return indexed_game_objects.size();
+}
+
+void SceneIndex::InsertKeys(GameObject* game_object, IndexedGameObject& indexed_game_object)
+{
+	indexed_game_object.UUID = game_object->UUID;
+	indexed_game_object.name = game_object->name;
+	indexed_game_object.tag = game_object->tag;
+
+	game_objects_by_UUID[game_object->UUID] = game_object;
+	InsertOrdered(game_objects_by_name, game_object->name, game_object, indexed_game_object.order);
+	InsertOrdered(game_objects_by_tag, game_object->tag, game_object, indexed_game_object.order);
+}
+
+void SceneIndex::EraseKeys(const GameObject* game_object, const IndexedGameObject& indexed_game_object)
+{
+	EraseEntry(game_objects_by_UUID, indexed_game_object.UUID, game_object);
+	EraseOrdered(game_objects_by_name, indexed_game_object.name, indexed_game_object.order);
+	EraseOrdered(game_objects_by_tag, indexed_game_object.tag, indexed_game_object.order);
+}
+
+// New game objects have the highest order and are appended, only renamed ones are inserted in the middle
+void SceneIndex::InsertOrdered(OrderedGameObjects& game_objects, const std::string& key, GameObject* game_object, uint64_t order)
+{
+	std::vector<OrderedGameObject>& ordered_game_objects = game_objects[key];
+	auto position = std::lower_bound(ordered_game_objects.begin(), ordered_game_objects.end(), order, [](const OrderedGameObject& ordered_game_object, uint64_t order)
+	{
+		return ordered_game_object.order < order;
+	});
+	ordered_game_objects.insert(position, OrderedGameObject{ order, game_object });
+}
+
+void SceneIndex::EraseOrdered(OrderedGameObjects& game_objects, const std::string& key, uint64_t order)
+{
+	auto found = game_objects.find(key);
+	if (found == game_objects.end())
+	{
+		return;
+	}
+
+	std::vector<OrderedGameObject>& ordered_game_objects = found->second;
+	auto position = std::lower_bound(ordered_game_objects.begin(), ordered_game_objects.end(), order, [](const OrderedGameObject& ordered_game_object, uint64_t order)
+	{
+		return ordered_game_object.order < order;
+	});
+	if (position != ordered_game_objects.end() && position->order == order)
+	{
+		ordered_game_objects.erase(position);
+	}
+	if (ordered_game_objects.empty())
+	{
+		game_objects.erase(found);
+	}
+}
+
+GameObject* SceneIndex::GetFirst(const OrderedGameObjects& game_objects, const std::string& key)
+{
+	auto found = game_objects.find(key);
+	return found == game_objects.end() ? nullptr : found->second.front().game_object;
+}
@@ -0,0 +1,88 @@
+#ifndef _SCENEINDEX_H_
+#define _SCENEINDEX_H_
+
+#include "Component/Component.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+
+/*
+	Hash indices over the scene game objects (UUID, name and tag) and their components (UUID and type).
+	Components of each type are also kept in a dense list, so the scene can update them type by type.
+	Every entry remembers the keys it was indexed with, so removing it never depends on the current field values.
+	Game objects sharing a name or a tag are kept in creation order, the first one is the front of its list.
+*/
+class SceneIndex
+{
+public:
+	SceneIndex() = default;
+	~SceneIndex() = default;
+
+	void Clear();
+
+	void Index(GameObject* game_object);
+	void Unindex(const GameObject* game_object);
+	void Reindex(GameObject* game_object);
+	bool IsIndexed(const GameObject* game_object) const;
+
+	void IndexComponent(Component* component);
+	void UnindexComponent(const Component* component);
+
+	GameObject* GetGameObject(uint64_t UUID) const;
+	GameObject* GetGameObjectByName(const std::string& name) const;
+	GameObject* GetGameObjectWithTag(const std::string& tag) const;
+	std::vector<GameObject*> GetGameObjectsWithTag(const std::string& tag) const;
+	Component* GetComponent(uint64_t UUID) const;
+	const std::vector<Component*>& GetComponents(Component::ComponentType type) const;
+
+	size_t Size() const;
+
+private:
+	struct IndexedGameObject
+	{
+		uint64_t UUID = 0;
+		std::string name;
+		std::string tag;
+		uint64_t order = 0; // Lookups return the results in creation order, as the scene does
+	};
+
+	struct IndexedComponent
+	{
+		uint64_t UUID = 0;
+		size_t type_index = 0;
+		size_t type_position = 0; // Position in components_by_type, removal swaps the last component of the type into it
+	};
+
+	struct OrderedGameObject
+	{
+		uint64_t order = 0;
+		GameObject* game_object = nullptr;
+	};
+	using OrderedGameObjects = std::unordered_map<std::string, std::vector<OrderedGameObject>>;
+
+	void InsertKeys(GameObject* game_object, IndexedGameObject& indexed_game_object);
+	void EraseKeys(const GameObject* game_object, const IndexedGameObject& indexed_game_object);
+	static void InsertOrdered(OrderedGameObjects& game_objects, const std::string& key, GameObject* game_object, uint64_t order);
+	static void EraseOrdered(OrderedGameObjects& game_objects, const std::string& key, uint64_t order);
+	static GameObject* GetFirst(const OrderedGameObjects& game_objects, const std::string& key);
+
+private:
+	std::unordered_map<const GameObject*, IndexedGameObject> indexed_game_objects;
+	std::unordered_map<uint64_t, GameObject*> game_objects_by_UUID;
+	OrderedGameObjects game_objects_by_name;
+	OrderedGameObjects game_objects_by_tag;
+
+	static const size_t MAX_COMPONENT_TYPES = 32;
+	std::unordered_map<const Component*, IndexedComponent> indexed_components;
+	std::unordered_map<uint64_t, Component*> components_by_UUID;
+	std::array<std::vector<Component*>, MAX_COMPONENT_TYPES> components_by_type;
+
+	uint64_t next_order = 0;
+};
+
+#endif // _SCENEINDEX_H_
@@ -0,0 +1,258 @@
+#include "SceneLoader.h"
+
+#include "Component/ComponentCollider.h"
+#include "Component/ComponentMeshRenderer.h"
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+#include "Main/GameObject.h"
+#include "Module/ModulePhysics.h"
+#include "Module/ModuleRender.h"
+#include "Module/ModuleResourceManager.h"
+#include "Module/ModuleScene.h"
+#include "Module/ModuleSpacePartitioning.h"
+
+#include "ResourceManagement/Manager/SceneManager.h"
+#include "ResourceManagement/Resources/Scene.h"
+
+#include <Brofiler/Brofiler.h>
+#include <chrono>
+
+SceneLoader::~SceneLoader()
+{
+	Cancel();
+}
+
+void SceneLoader::Start(uint32_t scene_uuid)
+{
+	Cancel();
+
+	this->scene_uuid = scene_uuid;
+	std::shared_ptr<Resource> cached_scene = App->resources->RetrieveFromCacheIfExist(scene_uuid);
+	if (cached_scene != nullptr)
+	{
+		scene = std::static_pointer_cast<Scene>(cached_scene);
+		BeginInstantiating();
+		return;
+	}
+
+	state = State::READING;
+	App->job_system->Schedule([this, scene_uuid]()
+	{
+		FileData scene_data;
+		if (App->resources->RetrieveFileDataByUUID(scene_uuid, scene_data))
+		{
+			read_scene = SceneManager::Load(scene_uuid, scene_data);
+			delete[] scene_data.buffer;
+		}
+	}, &reading_counter);
+
+	// Without workers the job only runs when someone waits for it
+	if (App->job_system->GetNumThreads() <= 1)
+	{
+		App->job_system->Wait(reading_counter);
+	}
+}
+
+void SceneLoader::Start(const std::shared_ptr<Scene>& scene_to_load)
+{
+	Cancel();
+
+	scene_uuid = scene_to_load->GetUUID();
+	scene = scene_to_load;
+	BeginInstantiating();
+}
+
+bool SceneLoader::Update(float budget_ms)
+{
+	BROFILER_CATEGORY("Scene Loader Update", Profiler::Color::Brown);
+	auto start = std::chrono::high_resolution_clock::now();
+
+	if (state == State::READING)
+	{
+		if (!reading_counter.IsDone())
+		{
+			return false;
+		}
+
+		scene = std::move(read_scene);
+		if (scene == nullptr)
+		{
+			RESOURCES_LOG_ERROR("Error loading scene %u.", scene_uuid);
+			state = State::LOADED;
+			return true;
+		}
+
+		App->resources->AddResourceToCache(scene);
+		BeginInstantiating();
+	}
+
+	if (state == State::INSTANTIATING)
+	{
+		float elapsed_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		if (!scene->LoadStep(budget_ms - elapsed_ms))
+		{
+			return false;
+		}
+
+		scene->EndLoad();
+		BeginPreparing();
+	}
+
+	if (state == State::PREPARING)
+	{
+		float elapsed_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		if (!PrepareStep(budget_ms - elapsed_ms))
+		{
+			return false;
+		}
+		state = State::LOADED;
+	}
+
+	return state == State::LOADED;
+}
+
+// Game objects instantiated or prepared so far stay in the scene, they go away with it
+void SceneLoader::Cancel()
+{
+	if (state == State::READING)
+	{
+		App->job_system->Wait(reading_counter);
+		read_scene = nullptr;
+	}
+	else if (state == State::INSTANTIATING)
+	{
+		scene->CancelLoad();
+	}
+
+	state = State::IDLE;
+	scene = nullptr;
+}
+
+SceneLoader::State SceneLoader::GetState() const
+{
+	return state;
+}
+
+bool SceneLoader::IsLoading() const
+{
+	return state == State::READING || state == State::INSTANTIATING || state == State::PREPARING;
+}
+
+float SceneLoader::GetProgress() const
+{
+	switch (state)
+	{
+	case State::READING:
+		return 0.f;
+
+	case State::INSTANTIATING:
+		return READING_PROGRESS + (1.f - READING_PROGRESS - PREPARING_PROGRESS) * scene->GetLoadProgress();
+
+	case State::PREPARING:
+	{
+		size_t total = 2 * App->renderer->mesh_renderers.GetComponents().size() + App->physics->colliders.size();
+		size_t prepared = next_bounding_box + next_static_game_object + next_collider;
+		return 1.f - PREPARING_PROGRESS + (total > 0 ? PREPARING_PROGRESS * prepared / total : PREPARING_PROGRESS);
+	}
+
+	case State::LOADED:
+		return 1.f;
+
+	default:
+		return 0.f;
+	}
+}
+
+std::shared_ptr<Scene> SceneLoader::GetScene() const
+{
+	return scene;
+}
+
+void SceneLoader::BeginInstantiating()
+{
+	state = State::INSTANTIATING;
+	scene->BeginLoad();
+}
+
+// The world partition sets the minimum size of the trees, so it is loaded before they are created
+void SceneLoader::BeginPreparing()
+{
+	state = State::PREPARING;
+	App->scene->GetWorldPartition().Load(*scene);
+
+	mesh_limits.SetNegativeInfinity();
+	trees_created = false;
+	next_bounding_box = 0;
+	next_static_game_object = 0;
+	next_collider = 0;
+}
+
+// Every mesh renderer and collider belongs to the loaded scene, the previous one was deleted when the load started
+bool SceneLoader::PrepareStep(float budget_ms)
+{
+	BROFILER_CATEGORY("Scene Loader Prepare", Profiler::Color::Brown);
+	auto start = std::chrono::high_resolution_clock::now();
+	auto has_budget = [start, budget_ms]()
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count() < budget_ms;
+	};
+	auto get_chunk_end = [](size_t begin, size_t size)
+	{
+		return begin + PREPARE_CHUNK_SIZE < size ? begin + PREPARE_CHUNK_SIZE : size;
+	};
+
+	const std::vector<ComponentMeshRenderer*>& mesh_renderers = App->renderer->mesh_renderers.GetComponents();
+	std::vector<GameObject*> game_objects;
+	while (next_bounding_box < mesh_renderers.size() && has_budget())
+	{
+		size_t end = get_chunk_end(next_bounding_box, mesh_renderers.size());
+		game_objects.clear();
+		for (size_t i = next_bounding_box; i < end; ++i)
+		{
+			game_objects.push_back(mesh_renderers[i]->owner);
+		}
+
+		App->scene->UpdateBoundingBoxes(game_objects);
+		for (const auto& game_object : game_objects)
+		{
+			mesh_limits.Enclose(game_object->aabb.bounding_box);
+		}
+		next_bounding_box = end;
+	}
+	if (next_bounding_box < mesh_renderers.size())
+	{
+		return false;
+	}
+
+	if (!trees_created)
+	{
+		App->space_partitioning->CreateStaticTrees(mesh_limits);
+		trees_created = true;
+	}
+
+	while (next_static_game_object < mesh_renderers.size() && has_budget())
+	{
+		size_t end = get_chunk_end(next_static_game_object, mesh_renderers.size());
+		game_objects.clear();
+		for (size_t i = next_static_game_object; i < end; ++i)
+		{
+			game_objects.push_back(mesh_renderers[i]->owner);
+		}
+
+		App->space_partitioning->InsertStatic(game_objects);
+		next_static_game_object = end;
+	}
+	if (next_static_game_object < mesh_renderers.size())
+	{
+		return false;
+	}
+
+	const std::vector<ComponentCollider*>& colliders = App->physics->colliders;
+	while (next_collider < colliders.size() && has_budget())
+	{
+		size_t end = get_chunk_end(next_collider, colliders.size());
+		App->physics->UpdateColliderDimensions(std::vector<ComponentCollider*>(colliders.begin() + next_collider, colliders.begin() + end));
+		next_collider = end;
+	}
+	return next_collider == colliders.size();
+}
@@ -0,0 +1,70 @@
+#ifndef _SCENELOADER_H_
+#define _SCENELOADER_H_
+
+#include "Helper/JobSystem.h"
+
+#include <MathGeoLib.h>
+#include <cstdint>
+#include <memory>
+
+class Scene;
+
+/*
+	Resumable scene load, advanced by Update once per frame within a millisecond budget.
+	The exported scene file is read by a job, then the game objects are parsed and instantiated in chunks on the main thread.
+	Bounding boxes, space partitioning trees and physics bodies are prepared in chunks too. The loaded scene is neither
+	updated nor drawn while loading, the caller activates it all at once when Update returns true.
+*/
+class SceneLoader
+{
+public:
+	enum class State
+	{
+		IDLE,
+		READING,
+		INSTANTIATING,
+		PREPARING,
+		LOADED
+	};
+
+	SceneLoader() = default;
+	~SceneLoader();
+
+	SceneLoader(const SceneLoader& loader_to_copy) = delete;
+	SceneLoader& operator=(const SceneLoader& loader_to_copy) = delete;
+
+	void Start(uint32_t scene_uuid);
+	void Start(const std::shared_ptr<Scene>& scene_to_load);
+	bool Update(float budget_ms);
+	void Cancel();
+
+	State GetState() const;
+	bool IsLoading() const;
+	float GetProgress() const;
+	std::shared_ptr<Scene> GetScene() const;
+
+private:
+	void BeginInstantiating();
+	void BeginPreparing();
+	bool PrepareStep(float budget_ms);
+
+private:
+	static constexpr float READING_PROGRESS = 0.1f;
+	static constexpr float PREPARING_PROGRESS = 0.1f;
+	static const size_t PREPARE_CHUNK_SIZE = 64; // Game objects or colliders prepared between budget checks
+
+	State state = State::IDLE;
+	uint32_t scene_uuid = 0;
+	std::shared_ptr<Scene> scene = nullptr;
+
+	JobCounter reading_counter;
+	std::shared_ptr<Scene> read_scene = nullptr; // Written by the reading job
+
+	AABB mesh_limits; // Enclosed while the bounding boxes are generated, the trees are created with them
+	bool trees_created = false;
+	size_t next_bounding_box = 0;
+	size_t next_static_game_object = 0;
+	size_t next_collider = 0;
+};
+
+#endif // _SCENELOADER_H_
@@ -0,0 +1,210 @@
+#include "TransformHierarchy.h"
+
+#include "Helper/JobSystem.h"
+#include "Main/Application.h"
+#include "Main/GameObject.h"
+
+#include <Brofiler/Brofiler.h>
+
+#include <algorithm>
+#include <cassert>
+#include <xmmintrin.h>
+
+namespace
+{
+	// Row major 4x4 product: every row of the result is a linear combination of the rows of b
+	inline void MultiplyMatrices(const float4x4& a, const float4x4& b, float4x4& result)
+	{
+		const float* a_ptr = a.ptr();
+		const float* b_ptr = b.ptr();
+		const __m128 b_row_0 = _mm_loadu_ps(b_ptr);
+		const __m128 b_row_1 = _mm_loadu_ps(b_ptr + 4);
+		const __m128 b_row_2 = _mm_loadu_ps(b_ptr + 8);
+		const __m128 b_row_3 = _mm_loadu_ps(b_ptr + 12);
+
+		float* result_ptr = result.ptr();
+		for (int i = 0; i < 4; ++i)
+		{
+			const float* a_row = a_ptr + 4 * i;
+			__m128 row = _mm_mul_ps(_mm_set1_ps(a_row[0]), b_row_0);
+			row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a_row[1]), b_row_1));
+			row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a_row[2]), b_row_2));
+			row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a_row[3]), b_row_3));
+			_mm_storeu_ps(result_ptr + 4 * i, row);
+		}
+	}
+}
+
+void TransformHierarchy::Build(GameObject* root)
+{
+	BROFILER_CATEGORY("Build Transform Hierarchy", Profiler::Color::Lavender);
+	Clear();
+
+	// Breadth first traversal already visits the nodes sorted by depth
+	std::vector<GameObject*> game_objects;
+	game_objects.push_back(root);
+	AddNode(-1, &root->transform);
+	for (size_t i = 0; i < game_objects.size(); ++i)
+	{
+		for (const auto& child : game_objects[i]->children)
+		{
+			game_objects.push_back(child);
+			AddNode(static_cast<int>(i), &child->transform);
+		}
+	}
+
+	topology_dirty = false;
+}
+
+void TransformHierarchy::Clear()
+{
+	// Stored transforms can be already deleted here, stale handles are rejected by OnLocalTransformChange
+	transforms.clear();
+	parents.clear();
+	depths.clear();
+	level_offsets.clear();
+	translations.clear();
+	rotations.clear();
+	scales.clear();
+	world_matrices.clear();
+	dirty.clear();
+}
+
+size_t TransformHierarchy::AddNode(int parent_index, ComponentTransform* transform)
+{
+	assert(parent_index < static_cast<int>(Size()));
+	size_t index = Size();
+
+	uint32_t depth = parent_index < 0 ? 0 : depths[parent_index] + 1;
+	assert(depths.empty() || depth >= depths.back());
+	if (level_offsets.size() <= depth)
+	{
+		level_offsets.push_back(index);
+	}
+
+	transforms.push_back(transform);
+	parents.push_back(parent_index);
+	depths.push_back(depth);
+	world_matrices.push_back(float4x4::identity);
+	dirty.push_back(1);
+	nodes_dirty = true;
+
+	if (transform != nullptr)
+	{
+		transform->hierarchy = this;
+		transform->hierarchy_index = index;
+		translations.push_back(transform->translation);
+		rotations.push_back(transform->rotation);
+		scales.push_back(transform->scale);
+	}
+	else
+	{
+		translations.push_back(float3::zero);
+		rotations.push_back(Quat::identity);
+		scales.push_back(float3::one);
+	}
+
+	return index;
+}
+
+size_t TransformHierarchy::Size() const
+{
+	return parents.size();
+}
+
+void TransformHierarchy::MarkTopologyDirty()
+{
+	topology_dirty = true;
+}
+
+bool TransformHierarchy::IsTopologyDirty() const
+{
+	return topology_dirty;
+}
+
+void TransformHierarchy::SetLocalTransform(size_t index, const float3& translation, const Quat& rotation, const float3& scale)
+{
+	translations[index] = translation;
+	rotations[index] = rotation;
+	scales[index] = scale;
+	dirty[index] = 1;
+	nodes_dirty = true;
+}
+
+void TransformHierarchy::OnLocalTransformChange(const ComponentTransform& transform)
+{
+	// Nodes are gathered again from the scene when the topology changes
+	if (topology_dirty || transform.hierarchy_index >= Size() || transforms[transform.hierarchy_index] != &transform)
+	{
+		return;
+	}
+
+	SetLocalTransform(transform.hierarchy_index, transform.translation, transform.rotation, transform.scale);
+}
+
+const float4x4& TransformHierarchy::GetWorldMatrix(size_t index) const
+{
+	return world_matrices[index];
+}
+
+void TransformHierarchy::Update()
+{
+	BROFILER_CATEGORY("Update Transform Hierarchy", Profiler::Color::Lavender);
+	if (!nodes_dirty)
+	{
+		return;
+	}
+
+	// Levels are processed in order. Nodes inside a level only read their parent, stored on the previous one
+	for (size_t level = 0; level < level_offsets.size(); ++level)
+	{
+		size_t level_begin = level_offsets[level];
+		size_t level_end = level + 1 < level_offsets.size() ? level_offsets[level + 1] : Size();
+		size_t level_size = level_end - level_begin;
+
+		if (parallel && level_size >= MIN_PARALLEL_LEVEL_SIZE)
+		{
+			App->job_system->ParallelFor(level_size, PARALLEL_BATCH_SIZE, [this, level_begin](size_t begin, size_t end)
+			{
+				UpdateRange(level_begin + begin, level_begin + end);
+			});
+		}
+		else
+		{
+			UpdateRange(level_begin, level_end);
+		}
+	}
+
+	std::fill(dirty.begin(), dirty.end(), 0);
+	nodes_dirty = false;
+}
+
+void TransformHierarchy::UpdateRange(size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; ++i)
+	{
+		int parent = parents[i];
+		if (!dirty[i] && (parent < 0 || !dirty[parent]))
+		{
+			continue;
+		}
+		dirty[i] = 1;
+
+		float4x4 local_matrix = float4x4::FromTRS(translations[i], rotations[i], scales[i]);
+		if (parent < 0)
+		{
+			world_matrices[i] = local_matrix;
+		}
+		else
+		{
+			MultiplyMatrices(world_matrices[parent], local_matrix, world_matrices[i]);
+		}
+
+		ComponentTransform* transform = transforms[i];
+		if (transform != nullptr)
+		{
+			transform->global_model_matrix = world_matrices[i];
+			transform->global_model_matrix_dirty = false;
+		}
+	}
+}
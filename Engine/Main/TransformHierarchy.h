@@ -0,0 +1,63 @@
+#ifndef _TRANSFORMHIERARCHY_H_
+#define _TRANSFORMHIERARCHY_H_
+
+#include <MathGeoLib.h>
+
+#include <cstdint>
+#include <vector>
+
+class ComponentTransform;
+class GameObject;
+
+/*
+	Contiguous transform store. Nodes are sorted by hierarchy depth so every parent is stored before its children.
+	Local TRS is kept as SoA and world matrices are computed in one linear pass, level by level.
+	Scene transforms keep a handle (index) to its node and push their local TRS on every change.
+*/
+class TransformHierarchy
+{
+public:
+	TransformHierarchy() = default;
+	~TransformHierarchy() = default;
+
+	void Build(GameObject* root);
+	void Clear();
+
+	size_t AddNode(int parent_index, ComponentTransform* transform = nullptr);
+	size_t Size() const;
+
+	void MarkTopologyDirty();
+	bool IsTopologyDirty() const;
+
+	void SetLocalTransform(size_t index, const float3& translation, const Quat& rotation, const float3& scale);
+	void OnLocalTransformChange(const ComponentTransform& transform);
+	const float4x4& GetWorldMatrix(size_t index) const;
+
+	void Update();
+
+private:
+	void UpdateRange(size_t begin, size_t end);
+
+public:
+	bool parallel = true;
+
+private:
+	std::vector<ComponentTransform*> transforms;
+	std::vector<int> parents;
+	std::vector<uint32_t> depths;
+	std::vector<size_t> level_offsets; // First node of every depth level
+
+	std::vector<float3> translations;
+	std::vector<Quat> rotations;
+	std::vector<float3> scales;
+	std::vector<float4x4> world_matrices;
+	std::vector<uint8_t> dirty;
+
+	bool topology_dirty = true;
+	bool nodes_dirty = false; // Any node changed since the last update
+
+	static const size_t MIN_PARALLEL_LEVEL_SIZE = 4096;
+	static const size_t PARALLEL_BATCH_SIZE = 1024;
+};
+
+#endif // _TRANSFORMHIERARCHY_H_
@@ -0,0 +1,593 @@
+#include "WorldPartition.h"
+
+#include "Component/ComponentCollider.h"
+#include "Helper/Config.h"
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+#include "Main/GameObject.h"
+#include "Module/ModuleFileSystem.h"
+#include "Module/ModulePhysics.h"
+#include "Module/ModuleResourceManager.h"
+#include "Module/ModuleScene.h"
+#include "Module/ModuleSpacePartitioning.h"
+
+#include "ResourceManagement/Metafile/Metafile.h"
+#include "ResourceManagement/Metafile/MetafileManager.h"
+#include "ResourceManagement/Resources/Scene.h"
+
+#include <Brofiler/Brofiler.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stack>
+#include <unordered_map>
+
+WorldPartition::~WorldPartition()
+{
+	Clear();
+}
+
+void WorldPartition::Load(const Scene& scene)
+{
+	Clear();
+	scene_uuid = scene.GetUUID();
+
+	Config world_partition_config;
+	scene.GetWorldPartitionConfig(world_partition_config);
+	enabled = world_partition_config.GetBool("Enabled", false);
+	cell_size = world_partition_config.GetFloat("CellSize", cell_size);
+
+	std::vector<Config> cells_config;
+	world_partition_config.GetChildrenConfig("Cells", cells_config);
+	for (const auto& cell_config : cells_config)
+	{
+		std::unique_ptr<Cell> cell = std::make_unique<Cell>();
+		cell->x = cell_config.GetInt("X", 0);
+		cell->z = cell_config.GetInt("Z", 0);
+		cell->file_path = GetCellPath(scene_uuid, cell->x, cell->z);
+		cells.push_back(std::move(cell));
+	}
+
+	// Cells stream in inside the grid, its height grows with the game objects loaded
+	AABB limits(float3::inf, -float3::inf);
+	for (const auto& cell : cells)
+	{
+		limits.Enclose(float3(cell->x * cell_size, 0.f, cell->z * cell_size));
+		limits.Enclose(float3((cell->x + 1) * cell_size, 0.f, (cell->z + 1) * cell_size));
+	}
+	App->space_partitioning->SetStaticLimits(limits);
+}
+
+// Unloads go first so their budget is not taken by new cells, then finished reads are instantiated nearest first
+void WorldPartition::Update(const std::vector<float3>& focus_points, bool streaming)
+{
+	BROFILER_CATEGORY("World Partition Update", Profiler::Color::Brown);
+	auto start = std::chrono::high_resolution_clock::now();
+	auto elapsed_ms = [start]()
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	};
+
+	last_update_cells = 0;
+	if (cells.empty())
+	{
+		last_update_ms = 0.f;
+		return;
+	}
+
+	std::vector<std::pair<float, Cell*>> cells_by_distance;
+	cells_by_distance.reserve(cells.size());
+	for (const auto& cell : cells)
+	{
+		cells_by_distance.emplace_back(streaming ? GetDistance(*cell, focus_points) : 0.f, cell.get());
+	}
+	std::sort(cells_by_distance.begin(), cells_by_distance.end(), [](const auto& cell_a, const auto& cell_b)
+	{
+		return cell_a.first < cell_b.first;
+	});
+
+	for (auto it = cells_by_distance.rbegin(); it != cells_by_distance.rend() && elapsed_ms() < budget_ms; ++it)
+	{
+		Cell& cell = *it->second;
+		if (it->first > unload_radius && (cell.state == CellState::INSTANTIATING || cell.state == CellState::LOADED))
+		{
+			Unload(cell);
+			++last_update_cells;
+		}
+	}
+
+	std::vector<ComponentCollider*> loaded_colliders;
+	size_t reading_cells = 0;
+	for (const auto& cell_by_distance : cells_by_distance)
+	{
+		Cell& cell = *cell_by_distance.second;
+		if (cell.state == CellState::READING)
+		{
+			if (!cell.reading_counter.IsDone())
+			{
+				++reading_cells;
+				continue;
+			}
+
+			// Left behind while it was being read
+			if (cell_by_distance.first > unload_radius)
+			{
+				ResetCell(cell);
+				continue;
+			}
+			FinishReading(cell);
+		}
+
+		if (cell.state == CellState::INSTANTIATING && elapsed_ms() < budget_ms)
+		{
+			Instantiate(cell, budget_ms - elapsed_ms());
+			if (cell.state == CellState::LOADED)
+			{
+				App->space_partitioning->InsertStatic(cell.created_game_objects);
+				for (const auto& game_object : cell.created_game_objects)
+				{
+					for (const auto& component : game_object->components)
+					{
+						if (component->GetType() == Component::ComponentType::COLLIDER)
+						{
+							loaded_colliders.push_back(static_cast<ComponentCollider*>(component));
+						}
+					}
+				}
+				cell.created_game_objects.clear();
+				++last_update_cells;
+			}
+		}
+	}
+
+	for (const auto& cell_by_distance : cells_by_distance)
+	{
+		Cell& cell = *cell_by_distance.second;
+		if (reading_cells < MAX_READING_CELLS && cell.state == CellState::UNLOADED && !cell.failed && cell_by_distance.first <= load_radius)
+		{
+			StartReading(cell);
+			++reading_cells;
+		}
+	}
+
+	if (!loaded_colliders.empty())
+	{
+		App->physics->UpdateColliderDimensions(loaded_colliders);
+	}
+
+	last_update_ms = elapsed_ms();
+}
+
+// Game objects of loaded cells stay in the scene, they go away with it
+void WorldPartition::Clear()
+{
+	for (const auto& cell : cells)
+	{
+		if (cell->state == CellState::READING)
+		{
+			App->job_system->Wait(cell->reading_counter);
+		}
+	}
+	cells.clear();
+	scene_uuid = 0;
+}
+
+bool WorldPartition::SaveCells(uint32_t scene_uuid, GameObject* scene_root, std::vector<GameObject*>& game_objects, Config& config)
+{
+	BROFILER_CATEGORY("Save World Partition Cells", Profiler::Color::Brown);
+
+	Metafile* scene_metafile = App->resources->resource_DB->GetEntry(scene_uuid);
+	std::string scene_asset_path = scene_metafile != nullptr ? scene_metafile->imported_file_path : "";
+
+	// Cell files written for another scene are not ours to remove
+	std::vector<std::string> previous_cell_files;
+	if (this->scene_uuid == scene_uuid)
+	{
+		for (const auto& cell : cells)
+		{
+			previous_cell_files.push_back(GetCellAssetPath(scene_asset_path, cell->x, cell->z));
+			previous_cell_files.push_back(cell->file_path);
+		}
+	}
+	Clear();
+	this->scene_uuid = scene_uuid;
+
+	std::vector<std::vector<GameObject*>> cells_game_objects;
+	if (enabled && cell_size > 0.f)
+	{
+		// Game objects come parents first, children go to the cell of their top level ancestor
+		std::map<std::pair<int, int>, size_t> cell_indices;
+		std::unordered_map<const GameObject*, size_t> game_object_cells;
+		for (const auto& game_object : game_objects)
+		{
+			size_t cell_index = 0;
+			if (game_object->parent == scene_root)
+			{
+				if (!IsPartitioned(game_object))
+				{
+					continue;
+				}
+
+				float3 translation = game_object->transform.GetGlobalTranslation();
+				std::pair<int, int> cell_coordinates(static_cast<int>(std::floor(translation.x / cell_size)), static_cast<int>(std::floor(translation.z / cell_size)));
+				auto inserted_cell = cell_indices.emplace(cell_coordinates, cells.size());
+				if (inserted_cell.second)
+				{
+					std::unique_ptr<Cell> cell = std::make_unique<Cell>();
+					cell->x = cell_coordinates.first;
+					cell->z = cell_coordinates.second;
+					cell->file_path = GetCellPath(scene_uuid, cell->x, cell->z);
+					cell->state = CellState::LOADED;
+					cells.push_back(std::move(cell));
+					cells_game_objects.emplace_back();
+				}
+				cell_index = inserted_cell.first->second;
+				cells[cell_index]->root_UUIDs.push_back(game_object->UUID);
+			}
+			else
+			{
+				auto parent_cell = game_object_cells.find(game_object->parent);
+				if (parent_cell == game_object_cells.end())
+				{
+					continue;
+				}
+				cell_index = parent_cell->second;
+			}
+
+			game_object_cells.emplace(game_object, cell_index);
+			cells_game_objects[cell_index].push_back(game_object);
+		}
+
+		game_objects.erase(std::remove_if(game_objects.begin(), game_objects.end(), [&game_object_cells](const GameObject* game_object)
+		{
+			return game_object_cells.find(game_object) != game_object_cells.end();
+		}), game_objects.end());
+	}
+
+	std::vector<Config> cells_config;
+	for (size_t i = 0; i < cells.size(); ++i)
+	{
+		SceneBinary::Writer cell_writer;
+		cell_writer.StartArray("GameObjects");
+		for (const auto& game_object : cells_game_objects[i])
+		{
+			Config game_object_config;
+			game_object->Save(game_object_config);
+			cell_writer.Add(game_object_config);
+		}
+		cell_writer.EndArray();
+
+		// The scene import that follows the save exports the cell to the library
+		std::string cell_asset_path = GetCellAssetPath(scene_asset_path, cells[i]->x, cells[i]->z);
+		FileData cell_data = cell_writer.Finish();
+		if (App->filesystem->Save(cell_asset_path, cell_data) == nullptr)
+		{
+			RESOURCES_LOG_ERROR("Error saving world partition cell %s", cell_asset_path.c_str());
+		}
+		delete[] cell_data.buffer;
+
+		Config cell_config;
+		cell_config.AddInt(cells[i]->x, "X");
+		cell_config.AddInt(cells[i]->z, "Z");
+		cells_config.push_back(cell_config);
+
+		previous_cell_files.erase(std::remove_if(previous_cell_files.begin(), previous_cell_files.end(), [&cell_asset_path, &cell_path = cells[i]->file_path](const std::string& previous_cell_file)
+		{
+			return previous_cell_file == cell_asset_path || previous_cell_file == cell_path;
+		}), previous_cell_files.end());
+	}
+
+	for (const auto& previous_cell_file : previous_cell_files)
+	{
+		if (App->filesystem->Exists(previous_cell_file))
+		{
+			App->filesystem->Remove(previous_cell_file);
+		}
+	}
+
+	if (!enabled)
+	{
+		return false;
+	}
+
+	config.AddBool(enabled, "Enabled");
+	config.AddFloat(cell_size, "CellSize");
+	config.AddChildrenConfig(cells_config, "Cells");
+	return true;
+}
+
+void WorldPartition::SyncLoadedCells()
+{
+	for (const auto& cell : cells)
+	{
+		bool loaded = !cell->root_UUIDs.empty();
+		for (const auto& root_UUID : cell->root_UUIDs)
+		{
+			loaded = loaded && App->scene->GetGameObject(root_UUID) != nullptr;
+		}
+
+		if (loaded)
+		{
+			ResetCell(*cell);
+			cell->state = CellState::LOADED;
+		}
+		else
+		{
+			Unload(*cell);
+		}
+	}
+}
+
+bool WorldPartition::IsFullyLoaded() const
+{
+	return std::all_of(cells.begin(), cells.end(), [](const auto& cell)
+	{
+		return cell->state == CellState::LOADED || cell->failed;
+	});
+}
+
+size_t WorldPartition::GetNumCells() const
+{
+	return cells.size();
+}
+
+size_t WorldPartition::GetNumCells(CellState state) const
+{
+	return std::count_if(cells.begin(), cells.end(), [state](const auto& cell)
+	{
+		return cell->state == state;
+	});
+}
+
+bool WorldPartition::ExportCells(const Scene& scene, const std::string& scene_asset_path)
+{
+	std::vector<std::pair<int, int>> cells_coordinates;
+	GetCellsCoordinates(scene, cells_coordinates);
+
+	bool exported = true;
+	for (const auto& cell_coordinates : cells_coordinates)
+	{
+		std::string cell_asset_path = GetCellAssetPath(scene_asset_path, cell_coordinates.first, cell_coordinates.second);
+		if (!App->filesystem->Exists(cell_asset_path))
+		{
+			RESOURCES_LOG_ERROR("Missing world partition cell %s", cell_asset_path.c_str());
+			exported = false;
+			continue;
+		}
+
+		FileData cell_data = App->filesystem->GetPath(cell_asset_path)->GetFile()->Load();
+		std::string cell_path = GetCellPath(scene.GetUUID(), cell_coordinates.first, cell_coordinates.second);
+		if (App->filesystem->Save(cell_path, cell_data) == nullptr)
+		{
+			RESOURCES_LOG_ERROR("Error exporting world partition cell %s", cell_path.c_str());
+			exported = false;
+		}
+		delete[] cell_data.buffer;
+	}
+	return exported;
+}
+
+bool WorldPartition::HasExportedCells(const Scene& scene)
+{
+	std::vector<std::pair<int, int>> cells_coordinates;
+	GetCellsCoordinates(scene, cells_coordinates);
+
+	bool exported = true;
+	for (const auto& cell_coordinates : cells_coordinates)
+	{
+		std::string cell_path = GetCellPath(scene.GetUUID(), cell_coordinates.first, cell_coordinates.second);
+		if (!App->filesystem->Exists(cell_path))
+		{
+			RESOURCES_LOG_ERROR("Missing exported world partition cell %s", cell_path.c_str());
+			exported = false;
+		}
+	}
+	return exported;
+}
+
+// Named after the scene UUID, so cleaning the library keeps them as long as the scene exists
+std::string WorldPartition::GetCellPath(uint32_t scene_uuid, int x, int z)
+{
+	return MetafileManager::GetUUIDExportedFile(scene_uuid) + "_" + std::to_string(x) + "_" + std::to_string(z);
+}
+
+// Cells are kept next to the scene asset, so they are not lost when the library is rebuilt
+std::string WorldPartition::GetCellAssetPath(const std::string& scene_asset_path, int x, int z)
+{
+	std::string scene_path = scene_asset_path;
+	size_t extension_position = scene_path.find_last_of('.');
+	if (extension_position != std::string::npos)
+	{
+		scene_path = scene_path.substr(0, extension_position);
+	}
+	return scene_path + "_" + std::to_string(x) + "_" + std::to_string(z) + ".cell";
+}
+
+void WorldPartition::GetCellsCoordinates(const Scene& scene, std::vector<std::pair<int, int>>& cells_coordinates)
+{
+	Config world_partition_config;
+	scene.GetWorldPartitionConfig(world_partition_config);
+
+	std::vector<Config> cells_config;
+	world_partition_config.GetChildrenConfig("Cells", cells_config);
+	for (const auto& cell_config : cells_config)
+	{
+		cells_coordinates.emplace_back(cell_config.GetInt("X", 0), cell_config.GetInt("Z", 0));
+	}
+}
+
+// Only whole static subtrees are streamed. Prefab instances and scripts stay in the scene, other game objects may refer to them.
+bool WorldPartition::IsPartitioned(const GameObject* game_object)
+{
+	std::stack<const GameObject*> pending_objects;
+	pending_objects.push(game_object);
+	while (!pending_objects.empty())
+	{
+		const GameObject* current_game_object = pending_objects.top();
+		pending_objects.pop();
+		if (!current_game_object->IsStatic() || current_game_object->prefab_reference != nullptr || current_game_object->is_prefab_parent)
+		{
+			return false;
+		}
+		if (current_game_object->GetComponent(Component::ComponentType::SCRIPT) != nullptr)
+		{
+			return false;
+		}
+
+		for (const auto& child : current_game_object->children)
+		{
+			pending_objects.push(child);
+		}
+	}
+	return true;
+}
+
+float WorldPartition::GetDistance(const Cell& cell, const float3& point) const
+{
+	float min_x = cell.x * cell_size;
+	float min_z = cell.z * cell_size;
+	float distance_x = std::fmax(std::fmax(min_x - point.x, point.x - (min_x + cell_size)), 0.f);
+	float distance_z = std::fmax(std::fmax(min_z - point.z, point.z - (min_z + cell_size)), 0.f);
+	return std::sqrt(distance_x * distance_x + distance_z * distance_z);
+}
+
+float WorldPartition::GetDistance(const Cell& cell, const std::vector<float3>& points) const
+{
+	float distance = std::numeric_limits<float>::infinity();
+	for (const auto& point : points)
+	{
+		distance = std::fmin(distance, GetDistance(cell, point));
+	}
+	return distance;
+}
+
+// The job reads the cell file and parses every game object, the main thread only instantiates them
+void WorldPartition::StartReading(Cell& cell)
+{
+	cell.state = CellState::READING;
+	Cell* reading_cell = &cell;
+	App->job_system->Schedule([reading_cell]()
+	{
+		if (!App->filesystem->Exists(reading_cell->file_path))
+		{
+			return;
+		}
+
+		FileData cell_data = App->filesystem->GetPath(reading_cell->file_path)->GetFile()->Load();
+		if (cell_data.buffer == nullptr)
+		{
+			return;
+		}
+		const char* cell_bytes = static_cast<const char*>(cell_data.buffer);
+		reading_cell->data.assign(cell_bytes, cell_bytes + cell_data.size);
+		delete[] cell_data.buffer;
+
+		reading_cell->scene_binary = std::make_unique<SceneBinary>(reading_cell->data.data(), reading_cell->data.size());
+		if (!reading_cell->scene_binary->IsValid())
+		{
+			return;
+		}
+
+		reading_cell->game_objects.resize(reading_cell->scene_binary->GetNumGameObjects());
+		for (size_t i = 0; i < reading_cell->game_objects.size(); ++i)
+		{
+			if (!reading_cell->game_objects[i].Parse(*reading_cell->scene_binary, i))
+			{
+				// FinishReading reports the cell as failed
+				reading_cell->scene_binary = nullptr;
+				return;
+			}
+		}
+	}, &cell.reading_counter);
+
+	// Without workers the job only runs when someone waits for it
+	if (App->job_system->GetNumThreads() <= 1)
+	{
+		App->job_system->Wait(cell.reading_counter);
+	}
+}
+
+bool WorldPartition::FinishReading(Cell& cell)
+{
+	if (cell.scene_binary == nullptr || !cell.scene_binary->IsValid())
+	{
+		RESOURCES_LOG_ERROR("Error loading world partition cell %s", cell.file_path.c_str());
+		ResetCell(cell);
+		cell.failed = true;
+		return false;
+	}
+
+	cell.state = CellState::INSTANTIATING;
+	cell.root_UUIDs.clear();
+	cell.created_game_objects.reserve(cell.game_objects.size());
+	return true;
+}
+
+void WorldPartition::Instantiate(Cell& cell, float budget_ms)
+{
+	BROFILER_CATEGORY("Instantiate World Partition Cell", Profiler::Color::Brown);
+	auto start = std::chrono::high_resolution_clock::now();
+	auto has_budget = [start, budget_ms]()
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count() < budget_ms;
+	};
+
+	GameObject* scene_root = App->scene->GetRoot();
+	for (; cell.next_game_object < cell.game_objects.size() && has_budget(); ++cell.next_game_object)
+	{
+		const GameObjectDescriptor& descriptor = cell.game_objects[cell.next_game_object];
+
+		// Cells are saved parents first, the parent of a nested game object is already in the scene
+		GameObject* game_object_parent = descriptor.parent_UUID == 0 ? nullptr : App->scene->GetGameObject(descriptor.parent_UUID);
+		if (game_object_parent == nullptr)
+		{
+			game_object_parent = scene_root;
+			cell.root_UUIDs.push_back(descriptor.UUID);
+		}
+
+		GameObject* created_game_object = App->scene->CreateGameObject();
+		created_game_object->Load(descriptor, game_object_parent);
+		cell.created_game_objects.push_back(created_game_object);
+	}
+
+	if (cell.next_game_object == cell.game_objects.size())
+	{
+		std::vector<GameObject*> created_game_objects = std::move(cell.created_game_objects);
+		ResetCell(cell);
+		cell.created_game_objects = std::move(created_game_objects);
+		cell.state = CellState::LOADED;
+	}
+}
+
+// Every game object of the cell is destroyed in one pass, which takes it out of the space partitioning trees and physics in bulk
+void WorldPartition::Unload(Cell& cell)
+{
+	for (const auto& root_UUID : cell.root_UUIDs)
+	{
+		GameObject* game_object = App->scene->GetGameObject(root_UUID);
+		if (game_object != nullptr)
+		{
+			App->scene->DestroyGameObject(game_object);
+		}
+	}
+	App->scene->DestroyPendingGameObjects();
+	ResetCell(cell);
+}
+
+// The top level UUIDs are kept, play mode snapshots bring unloaded cells back and look for them
+void WorldPartition::ResetCell(Cell& cell)
+{
+	if (cell.state == CellState::READING)
+	{
+		App->job_system->Wait(cell.reading_counter);
+	}
+
+	cell.state = CellState::UNLOADED;
+	cell.scene_binary = nullptr;
+	cell.data = std::vector<char>();
+	cell.game_objects = std::vector<GameObjectDescriptor>();
+	cell.next_game_object = 0;
+	cell.created_game_objects.clear();
+}
@@ -0,0 +1,107 @@
+#ifndef _WORLDPARTITION_H_
+#define _WORLDPARTITION_H_
+
+#include "Helper/JobSystem.h"
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
+#include "ResourceManagement/Manager/SceneBinary.h"
+
+#include <MathGeoLib.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Config;
+class GameObject;
+class Scene;
+
+/*
+	Grid of streaming cells on the XZ plane. When a scene is saved, top level static subtrees are taken out of the scene
+	and written to a binary sub-scene per cell, next to the scene asset. Importing the scene exports its cells beside it in
+	the library, which is all a game build has. Cells are read by jobs and instantiated on the main thread within a per-frame budget around the focus points, and unloaded once every focus point is past the unload radius.
+	Outside play mode every cell is kept loaded, so the editor always sees and saves the whole world.
+*/
+class WorldPartition
+{
+public:
+	enum class CellState
+	{
+		UNLOADED,
+		READING,
+		INSTANTIATING,
+		LOADED
+	};
+
+	WorldPartition() = default;
+	~WorldPartition();
+
+	WorldPartition(const WorldPartition& world_partition_to_copy) = delete;
+	WorldPartition& operator=(const WorldPartition& world_partition_to_copy) = delete;
+
+	void Load(const Scene& scene);
+	void Update(const std::vector<float3>& focus_points, bool streaming);
+	void Clear();
+
+	// Takes the partitioned game objects out of the list and writes their cells, returns false if the scene is not partitioned
+	bool SaveCells(uint32_t scene_uuid, GameObject* scene_root, std::vector<GameObject*>& game_objects, Config& config);
+	// Copies the cells written next to the scene asset to the library, returns false if any of them is missing
+	static bool ExportCells(const Scene& scene, const std::string& scene_asset_path);
+	static bool HasExportedCells(const Scene& scene);
+
+	// Play mode snapshots recreate or destroy game objects behind the cells, their state is read back from the scene
+	void SyncLoadedCells();
+
+	bool IsFullyLoaded() const;
+	size_t GetNumCells() const;
+	size_t GetNumCells(CellState state) const;
+
+public:
+	bool enabled = false;
+	float cell_size = 64.f;
+	float load_radius = 96.f;
+	float unload_radius = 128.f; // Past the load radius, so cells on the border do not load and unload every frame
+	float budget_ms = 2.f; // Spent instantiating and unloading cells every frame
+
+	float last_update_ms = 0.f;
+	size_t last_update_cells = 0; // Cells that finished loading or unloading in the last update
+
+private:
+	struct Cell
+	{
+		int x = 0;
+		int z = 0;
+		std::string file_path;
+		CellState state = CellState::UNLOADED;
+		bool failed = false;
+
+		JobCounter reading_counter;
+		std::vector<char> data; // Written by the reading job
+		std::unique_ptr<SceneBinary> scene_binary;
+		std::vector<GameObjectDescriptor> game_objects;
+		size_t next_game_object = 0;
+		std::vector<GameObject*> created_game_objects; // Same order as the descriptors, passed on to physics once the cell is loaded
+		std::vector<uint64_t> root_UUIDs; // Top level game objects, destroying them unloads the cell
+	};
+
+	static std::string GetCellPath(uint32_t scene_uuid, int x, int z);
+	static std::string GetCellAssetPath(const std::string& scene_asset_path, int x, int z);
+	static void GetCellsCoordinates(const Scene& scene, std::vector<std::pair<int, int>>& cells_coordinates);
+	static bool IsPartitioned(const GameObject* game_object);
+
+	float GetDistance(const Cell& cell, const float3& point) const;
+	float GetDistance(const Cell& cell, const std::vector<float3>& points) const;
+
+	void StartReading(Cell& cell);
+	bool FinishReading(Cell& cell);
+	void Instantiate(Cell& cell, float budget_ms);
+	void Unload(Cell& cell);
+	void ResetCell(Cell& cell);
+
+private:
+	static const size_t MAX_READING_CELLS = 4;
+
+	uint32_t scene_uuid = 0;
+	std::vector<std::unique_ptr<Cell>> cells;
+};
+
+#endif // _WORLDPARTITION_H_
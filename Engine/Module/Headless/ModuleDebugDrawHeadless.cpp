@@ -0,0 +1,32 @@
+#include "ModuleDebugDrawHeadless.h"
+
+#include "EditorUI/DebugDraw.h"
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+
+namespace
+{
+	// dd::RenderInterface methods are no-ops by default
+	class NullDebugDrawImplementation : public dd::RenderInterface
+	{
+	};
+
+	NullDebugDrawImplementation null_debug_draw_implementation;
+}
+
+bool ModuleDebugDrawHeadless::Init()
+{
+	APP_LOG_SECTION("************ Module Debug Draw Init (Headless) ************");
+
+	dd::initialize(&null_debug_draw_implementation);
+
+	APP_LOG_INFO("Module Debug Draw initialized without renderer.")
+
+	return true;
+}
+
+update_status ModuleDebugDrawHeadless::PostUpdate()
+{
+	dd::flush();
+	return update_status::UPDATE_CONTINUE;
+}
@@ -0,0 +1,20 @@
+#ifndef _MODULEDEBUGDRAWHEADLESS_H_
+#define _MODULEDEBUGDRAWHEADLESS_H_
+
+#include "Module/ModuleDebugDraw.h"
+
+/*
+	Null debug draw used by the headless runtime. Debug draw is initialized with a render interface that draws nothing,
+	so scripts can keep calling the Render* methods. Queued primitives are discarded at the end of every frame.
+*/
+class ModuleDebugDrawHeadless : public ModuleDebugDraw
+{
+public:
+	ModuleDebugDrawHeadless() = default;
+	~ModuleDebugDrawHeadless() = default;
+
+	bool Init() override;
+	update_status PostUpdate() override;
+};
+
+#endif // _MODULEDEBUGDRAWHEADLESS_H_
@@ -0,0 +1,47 @@
+#include "ModuleEditorHeadless.h"
+
+#include "EditorUI/Panel/PanelGame.h"
+#include "EditorUI/Panel/PanelHierarchy.h"
+#include "EditorUI/Panel/PanelPopups.h"
+#include "Filesystem/PathAtlas.h"
+#include "Helper/TagManager.h"
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+
+bool ModuleEditorHeadless::Init()
+{
+	APP_LOG_SECTION("************ Module Editor Init (Headless) ************");
+
+	game_panel = new PanelGame();
+	hierarchy = new PanelHierarchy();
+	popups = new PanelPopups();
+
+	tag_manager = new TagManager();
+	tag_manager->LoadTags();
+
+	APP_LOG_INFO("Running without editor.");
+
+	return true;
+}
+
+update_status ModuleEditorHeadless::PreUpdate()
+{
+	return update_status::UPDATE_CONTINUE;
+}
+
+update_status ModuleEditorHeadless::Update()
+{
+	return update_status::UPDATE_CONTINUE;
+}
+
+bool ModuleEditorHeadless::CleanUp()
+{
+	remove(TMP_SCENE_PATH);
+
+	delete game_panel;
+	delete hierarchy;
+	delete popups;
+	delete tag_manager;
+
+	return true;
+}
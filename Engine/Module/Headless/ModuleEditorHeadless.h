@@ -0,0 +1,23 @@
+#ifndef _MODULEEDITORHEADLESS_H_
+#define _MODULEEDITORHEADLESS_H_
+
+#include "Module/ModuleEditor.h"
+
+/*
+	Null editor used by the headless runtime. ImGui is never initialized and nothing is rendered.
+	Only the panels that the scene and the game components query are created (hierarchy names, game panel state, popups),
+	the rest of the panels stay null.
+*/
+class ModuleEditorHeadless : public ModuleEditor
+{
+public:
+	ModuleEditorHeadless() = default;
+	~ModuleEditorHeadless() = default;
+
+	bool Init() override;
+	update_status PreUpdate() override;
+	update_status Update() override;
+	bool CleanUp() override;
+};
+
+#endif // _MODULEEDITORHEADLESS_H_
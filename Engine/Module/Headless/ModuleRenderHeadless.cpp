@@ -0,0 +1,25 @@
+#include "ModuleRenderHeadless.h"
+
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+
+bool ModuleRenderHeadless::Init()
+{
+	APP_LOG_SECTION("************ Module Render Init (Headless) ************");
+
+	vsync = false;
+	shadows_enabled = false;
+
+	APP_LOG_INFO("Running without GL context. Nothing will be rendered.");
+
+	return true;
+}
+
+update_status ModuleRenderHeadless::PreUpdate()
+{
+	return update_status::UPDATE_CONTINUE;
+}
+
+void ModuleRenderHeadless::Render() const
+{
+}
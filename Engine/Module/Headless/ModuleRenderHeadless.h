@@ -0,0 +1,22 @@
+#ifndef _MODULERENDERHEADLESS_H_
+#define _MODULERENDERHEADLESS_H_
+
+#include "Module/ModuleRender.h"
+
+/*
+	Null renderer used by the headless runtime. Glew is never initialized and no viewport is created,
+	mesh renderers are still registered so the scene keeps working but nothing is drawn nor swapped.
+*/
+class ModuleRenderHeadless : public ModuleRender
+{
+public:
+	ModuleRenderHeadless() = default;
+	~ModuleRenderHeadless() = default;
+
+	bool Init() override;
+	update_status PreUpdate() override;
+
+	void Render() const override;
+};
+
+#endif // _MODULERENDERHEADLESS_H_
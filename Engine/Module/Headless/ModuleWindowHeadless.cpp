@@ -0,0 +1,17 @@
+#include "ModuleWindowHeadless.h"
+
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+
+bool ModuleWindowHeadless::Init()
+{
+	APP_LOG_SECTION("************ Module Window Init (Headless) ************");
+
+	screen_width = HEADLESS_WIDTH;
+	screen_height = HEADLESS_HEIGHT;
+	WindowResized(HEADLESS_WIDTH, HEADLESS_HEIGHT);
+
+	APP_LOG_INFO("Running without window. Window size set to %dx%d.", HEADLESS_WIDTH, HEADLESS_HEIGHT);
+
+	return true;
+}
@@ -0,0 +1,23 @@
+#ifndef _MODULEWINDOWHEADLESS_H_
+#define _MODULEWINDOWHEADLESS_H_
+
+#include "Module/ModuleWindow.h"
+
+/*
+	Null window used by the headless runtime. It doesn't init SDL video nor create a GL context,
+	it only reports a fixed window size so cameras and canvases keep a valid aspect ratio.
+*/
+class ModuleWindowHeadless : public ModuleWindow
+{
+public:
+	ModuleWindowHeadless() = default;
+	~ModuleWindowHeadless() = default;
+
+	bool Init() override;
+
+private:
+	const int HEADLESS_WIDTH = 1920;
+	const int HEADLESS_HEIGHT = 1080;
+};
+
+#endif // _MODULEWINDOWHEADLESS_H_
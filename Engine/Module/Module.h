@@ -5,12 +5,47 @@
 
 class Application;
 
+/*
+	Engine data that modules touch during PreUpdate, Update and PostUpdate.
+	Modules that declare what they read and write can be updated concurrently with the modules they don't conflict with.
+*/
+enum class ModuleData
+{
+	TRANSFORMS = 1 << 0,
+	PHYSICS_WORLD = 1 << 1,
+	NAVIGATION = 1 << 2,
+	TWEENS = 1 << 3,
+	PARTICLES = 1 << 4,
+	TRANSFORMS_2D = 1 << 5
+};
+
+struct ModuleDependencies
+{
+	bool main_thread = true; // Modules that didn't declare their dependencies are updated alone in the main thread
+	int reads = 0;
+	int writes = 0;
+
+	bool ConflictsWith(const ModuleDependencies& other) const
+	{
+		if (main_thread || other.main_thread)
+		{
+			return true;
+		}
+		return (writes & (other.reads | other.writes)) != 0 || (other.writes & reads) != 0;
+	}
+};
+
 class Module
 {
 public:
 
 	Module() = default;
 
+	virtual ModuleDependencies GetDependencies() const
+	{
+		return ModuleDependencies();
+	}
+
 	virtual bool Init() 
 	{
 		return true; 
@@ -11,6 +11,14 @@ bool ModuleAI::Init()
 	return true;
 }
 
+ModuleDependencies ModuleAI::GetDependencies() const
+{
+	ModuleDependencies dependencies;
+	dependencies.main_thread = false;
+	dependencies.reads = (int)ModuleData::NAVIGATION;
+	return dependencies;
+}
+
 update_status ModuleAI::Update()
 {
 	BROFILER_CATEGORY("Module AI Update", Profiler::Color::FireBrick);
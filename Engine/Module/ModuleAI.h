@@ -19,6 +19,7 @@ public:
 	~ModuleAI() = default;
 
 	bool Init() override;
+	ModuleDependencies GetDependencies() const override;
 	update_status Update() override;
 
 	void RenderNavMesh(ComponentCamera& camera);
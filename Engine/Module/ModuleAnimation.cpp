@@ -10,6 +10,21 @@
 
 #include <Brofiler/Brofiler.h>
 
+// The scene resets the tweens when it is cleaned up, after this module
+ModuleAnimation::~ModuleAnimation()
+{
+	delete(tweener);
+}
+
+// Tweens only move UI transforms, so they are updated along with physics
+ModuleDependencies ModuleAnimation::GetDependencies() const
+{
+	ModuleDependencies dependencies;
+	dependencies.main_thread = false;
+	dependencies.writes = (int)ModuleData::TWEENS | (int)ModuleData::TRANSFORMS_2D;
+	return dependencies;
+}
+
 bool ModuleAnimation::Init()
 {
 	APP_LOG_SECTION("************ Module Animation Init ************");
@@ -51,8 +66,6 @@ bool ModuleAnimation::CleanUp()
 	}
 	animations.clear();
 
-	delete(tweener);
-
 	return true;
 }
 
@@ -88,6 +101,21 @@ void ModuleAnimation::UpdateAnimationMeshes()
 	}
 }
 
+// Only the animations of these game objects, meshes are looked up under the owner of each animation
+void ModuleAnimation::UpdateAnimationMeshes(const std::vector<GameObject*>& game_objects)
+{
+	for (const auto& game_object : game_objects)
+	{
+		for (const auto& component : game_object->components)
+		{
+			if (component->type == Component::ComponentType::ANIMATION)
+			{
+				static_cast<ComponentAnimation*>(component)->Init();
+			}
+		}
+	}
+}
+
 void ModuleAnimation::PlayAnimations() const
 {
 	for(const auto& anim : animations)
@@ -106,3 +134,8 @@ void ModuleAnimation::CleanTweens()
 {
 	tweener->Reset();
 }
+
+void ModuleAnimation::RunTweenCallbacks()
+{
+	tweener->RunCompletedCallbacks();
+}
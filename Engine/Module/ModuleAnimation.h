@@ -18,8 +18,9 @@ class ModuleAnimation : public Module
 {
 public:
 	ModuleAnimation() = default;
-	~ModuleAnimation() = default;
+	~ModuleAnimation();
 	
+	ModuleDependencies GetDependencies() const override;
 	bool Init() override;
 	update_status Update() override;
 	update_status PostUpdate() override;
@@ -30,10 +31,12 @@ public:
 
 	void RemoveComponentAnimation(ComponentAnimation* animation_to_remove);
 	void UpdateAnimationMeshes();
+	void UpdateAnimationMeshes(const std::vector<GameObject*>& game_objects);
 	void PlayAnimations() const;
 
 	ENGINE_API TweenSequence* CreateTweenSequence();
 	void CleanTweens();
+	void RunTweenCallbacks();
 
 private:
 	std::vector<ComponentAnimation*> animations;
@@ -126,7 +126,7 @@ bool ModuleCamera::IsSceneCameraMoving() const
 
 void ModuleCamera::HandleSceneCameraMovements()
 {
-	if (!(App->editor->scene_panel->IsHovered()))
+	if (App->editor->scene_panel == nullptr || !(App->editor->scene_panel->IsHovered()))
 	{
 		return;
 	}
@@ -5,6 +5,9 @@
 #include "Component/ComponentCamera.h"
 
 #include <GL/glew.h>
+#include <vector>
+
+class Config;
 
 class ModuleDebug : public Module
 {
@@ -18,6 +21,25 @@ public:
 	
 	void CreateFrustumCullingDebugScene() const;
 
+	// Benchmarks, see ModuleDebugBenchmarks.cpp
+	void RunJobSystemBenchmark();
+	void RunTransformPropagationBenchmark();
+	void RunTransformHierarchyBenchmark();
+	void RunSceneLookupBenchmark();
+	void RunComponentPoolBenchmark();
+	void RunSceneFormatBenchmark();
+	void RunConfigBenchmark();
+	void RunSceneDeserializationBenchmark();
+	void RunSceneSaveBenchmark();
+	void RunPrefabSpawnBenchmark();
+	void RunPrefabPoolBenchmark();
+	void RunResourceCacheBenchmark();
+	void RunResourcePriorityBenchmark();
+	void RunTextureUploadCheck();
+
+private:
+	void CreateBenchmarkSceneConfig(size_t num_objects, Config& scene_config) const;
+
 public:
 	bool show_imgui_demo = false;
 	bool show_debug_metrics = true;
@@ -46,6 +68,75 @@ private:
 	int max_dispersion_x = 40;
 	int max_dispersion_z = 40;
 
+	int job_system_benchmark_objects = 100000;
+	int job_system_benchmark_frames = 100;
+	std::vector<float> job_system_benchmark_frame_times; // Average frame time in ms using 1, 2, ..., N threads
+
+	int transform_benchmark_depth = 1000;
+	int transform_benchmark_width = 1000;
+	int transform_benchmark_frames = 100;
+	float transform_benchmark_deep_times[2] = { 0.f, 0.f }; // Average frame time in ms: eager, lazy
+	float transform_benchmark_wide_times[2] = { 0.f, 0.f };
+
+	int transform_hierarchy_benchmark_nodes = 100000;
+	int transform_hierarchy_benchmark_branching = 8;
+	float transform_hierarchy_benchmark_times[2] = { 0.f, 0.f }; // Average frame time in ms: one thread, job system
+
+	int scene_lookup_benchmark_objects = 100000;
+	int scene_lookup_benchmark_lookups = 1000;
+	float scene_lookup_benchmark_times[3][2] = {}; // Average lookup time in us by UUID, name and tag: linear scan, hash index
+
+	int component_pool_benchmark_components = 100000;
+	int component_pool_benchmark_frames = 100;
+	size_t component_pool_benchmark_allocations[2] = { 0, 0 }; // Heap allocations made for the components: new, pool
+	float component_pool_benchmark_times[3][2] = {}; // Time in ms to create all, iterate one frame and remove 1%: new, pool
+
+	int scene_format_benchmark_objects = 50000;
+	size_t scene_format_benchmark_sizes[2] = { 0, 0 }; // Scene file size in bytes: JSON, binary
+	float scene_format_benchmark_times[2] = { 0.f, 0.f }; // Time in ms to read every game object: JSON, binary
+
+	int config_benchmark_objects = 50000;
+	size_t config_benchmark_documents[2] = { 0, 0 }; // JSON documents owning an allocator: child copies, child views
+	size_t config_benchmark_bytes[2] = { 0, 0 }; // Bytes allocated for strings and documents
+	float config_benchmark_times[2] = { 0.f, 0.f }; // Time in ms to parse and read every game object
+
+	int scene_deserialization_benchmark_objects = 50000;
+	size_t scene_deserialization_benchmark_threads = 0;
+	float scene_deserialization_benchmark_times[2][2] = {}; // Time in ms to parse every game object into descriptors, JSON and binary: one thread, job system
+
+	int scene_save_benchmark_objects = 50000;
+	float scene_save_benchmark_times[3] = { 0.f, 0.f, 0.f }; // Time in ms to save the scene: JSON document, streamed JSON, streamed binary
+	size_t scene_save_benchmark_peak_growth[3] = { 0, 0, 0 }; // Growth of the process peak working set in bytes, same order
+	bool scene_save_benchmark_identical = false; // Streamed output matches the document output byte for byte
+
+	int prefab_spawn_benchmark_instances = 200;
+	size_t prefab_spawn_benchmark_scripts = 0; // Scripts in the scene before spawning
+	float prefab_spawn_benchmark_times[3] = { 0.f, 0.f, 0.f }; // Time in ms to spawn every instance: one by one relinking the scene, one by one, batch
+
+	int prefab_pool_benchmark_instances = 100;
+	int prefab_pool_benchmark_frames = 50;
+	int prefab_pool_benchmark_warmup = 50;
+	float prefab_pool_benchmark_times[2] = { 0.f, 0.f }; // Average frame time in ms spawning and despawning every instance: instantiate and destroy, pool
+	float prefab_pool_benchmark_hit_rate = 0.f;
+
+	int resource_cache_benchmark_resources = 10000;
+	int resource_cache_benchmark_lookups = 100000;
+	int resource_cache_benchmark_budget = 25; // Percentage of the memory of every resource
+	float resource_cache_benchmark_times[2] = { 0.f, 0.f }; // Average lookup time in us: linear scan, hash cache
+	float resource_cache_benchmark_hit_rate = 0.f; // Lookups of a hot fifth of the resources eight times out of ten, under the budget
+	size_t resource_cache_benchmark_evictions = 0;
+
+	int resource_priority_benchmark_loads = 2000;
+	int resource_priority_benchmark_threads = 2;
+	float resource_priority_benchmark_decode_ms = 0.1f; // Simulated decode time of every load
+	float resource_priority_benchmark_aging = 10.f; // Priority gained per second waited, the priorities go from 0 to 10
+	float resource_priority_benchmark_waits[2][2] = {}; // Wait in ms of the loads in the top tenth of priorities, average and max: FIFO, priority
+	size_t resource_priority_benchmark_inversions = 0; // Loads started while a higher priority one waited
+	size_t resource_priority_benchmark_unbounded_inversions = 0; // Among them, the ones that had not waited long enough to overtake it
+	float resource_priority_benchmark_max_inversion_ms = 0.f; // Longest a load waited behind a lower priority one, bounded by 10 / aging seconds
+
+	int texture_upload_check_result = -1; // -1 not run, 0 split upload differs from the source pixels, 1 identical
+
 	friend class PanelDebug;
 	friend class PanelConfiguration;
 };
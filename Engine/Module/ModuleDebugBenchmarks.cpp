@@ -0,0 +1,1062 @@
+#include "ModuleDebug.h"
+
+#include "Component/ComponentMeshRenderer.h"
+#include "Helper/Benchmark.h"
+#include "Helper/ComponentPool.h"
+#include "Helper/Config.h"
+#include "Helper/JobSystem.h"
+#include "Log/EngineLog.h"
+
+#include "Main/Application.h"
+#include "Main/GameObject.h"
+#include "Main/PrefabPool.h"
+#include "Main/SceneIndex.h"
+#include "Main/TransformHierarchy.h"
+
+#include "Module/ModuleAnimation.h"
+#include "Module/ModuleEditor.h"
+#include "Module/ModuleResourceManager.h"
+#include "Module/ModuleScene.h"
+#include "Module/ModuleScriptManager.h"
+
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
+#include "ResourceManagement/Manager/SceneBinary.h"
+#include "ResourceManagement/ResourcesDB/ResourceCache.h"
+#include "ResourceManagement/ResourcesDB/ResourceLoader.h"
+#include "ResourceManagement/Resources/Prefab.h"
+#include "ResourceManagement/Resources/Scene.h"
+#include "ResourceManagement/Resources/Texture.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <numeric>
+#include <psapi.h>
+#include <random>
+#include <string_view>
+#include <thread>
+
+// Benchmarks run from the configuration panel. Each one logs its results and keeps them in ModuleDebug for the panel to show.
+
+void ModuleDebug::RunJobSystemBenchmark()
+{
+	APP_LOG_INFO("Running job system benchmark: %d objects, %d frames", job_system_benchmark_objects, job_system_benchmark_frames);
+
+	// Synthetic scene: every object is animated and has its world matrix and bounding box recomputed each frame
+	size_t num_objects = static_cast<size_t>(job_system_benchmark_objects);
+	std::vector<float3> translations(num_objects);
+	std::vector<Quat> rotations(num_objects, Quat::identity);
+	std::vector<float4x4> global_matrices(num_objects);
+	std::vector<AABB> bounding_boxes(num_objects);
+	for (size_t i = 0; i < num_objects; ++i)
+	{
+		translations[i] = float3(static_cast<float>(i % 1000), 0.f, static_cast<float>(i / 1000));
+	}
+
+	const float4x4 parent_matrix = float4x4::FromTRS(float3(1.f, 2.f, 3.f), Quat::RotateY(0.5f), float3::one);
+	const AABB local_box(-float3::one, float3::one);
+	const Quat frame_rotation = Quat::RotateY(0.01f);
+
+	size_t previous_num_threads = App->job_system->GetNumThreads();
+	size_t max_threads = App->job_system->GetMaxThreads();
+	job_system_benchmark_frame_times.clear();
+
+	for (size_t num_threads = 1; num_threads <= max_threads; ++num_threads)
+	{
+		App->job_system->SetNumThreads(num_threads);
+
+		float frame_time = Benchmark::AverageMs(static_cast<size_t>(job_system_benchmark_frames), [&](size_t frame)
+		{
+			App->job_system->ParallelFor(num_objects, 1024, [&](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					rotations[i] = frame_rotation * rotations[i];
+					global_matrices[i] = parent_matrix * float4x4::FromTRS(translations[i], rotations[i], float3::one);
+					bounding_boxes[i] = local_box;
+					bounding_boxes[i].TransformAsAABB(global_matrices[i]);
+				}
+			});
+		});
+		job_system_benchmark_frame_times.push_back(frame_time);
+
+		APP_LOG_INFO("Job system benchmark. Threads: %u Frame time: %.3f ms Speedup: %.2fx", static_cast<unsigned int>(num_threads), frame_time, Benchmark::Speedup(job_system_benchmark_frame_times.front(), frame_time));
+	}
+
+	App->job_system->SetNumThreads(previous_num_threads);
+}
+
+void ModuleDebug::RunTransformPropagationBenchmark()
+{
+	APP_LOG_INFO("Running transform propagation benchmark: depth %d, width %d, %d frames", transform_benchmark_depth, transform_benchmark_width, transform_benchmark_frames);
+
+	// Standalone hierarchies, they are not registered in the scene
+	std::vector<std::unique_ptr<GameObject>> deep_hierarchy;
+	deep_hierarchy.emplace_back(std::make_unique<GameObject>("Deep Root"));
+	for (int i = 0; i < transform_benchmark_depth; ++i)
+	{
+		deep_hierarchy.emplace_back(std::make_unique<GameObject>("Deep Child"));
+		deep_hierarchy.back()->SetParent(deep_hierarchy[deep_hierarchy.size() - 2].get());
+		deep_hierarchy.back()->transform.SetTranslation(float3(0.f, 1.f, 0.f));
+	}
+
+	std::vector<std::unique_ptr<GameObject>> wide_hierarchy;
+	wide_hierarchy.emplace_back(std::make_unique<GameObject>("Wide Root"));
+	for (int i = 0; i < transform_benchmark_width; ++i)
+	{
+		wide_hierarchy.emplace_back(std::make_unique<GameObject>("Wide Child"));
+		wide_hierarchy.back()->SetParent(wide_hierarchy.front().get());
+		wide_hierarchy.back()->transform.SetTranslation(float3(static_cast<float>(i), 0.f, 0.f));
+	}
+
+	// Resolves global matrices and bounding boxes, the same work the old per-setter propagation did
+	auto resolve_hierarchy = [](const std::vector<std::unique_ptr<GameObject>>& hierarchy)
+	{
+		for (const auto& game_object : hierarchy)
+		{
+			game_object->transform.UpdateGlobalModelMatrix();
+			if (game_object->aabb.IsDirty())
+			{
+				game_object->aabb.GenerateBoundingBox();
+			}
+		}
+	};
+
+	auto run_frames = [this, &resolve_hierarchy](const std::vector<std::unique_ptr<GameObject>>& hierarchy, bool eager)
+	{
+		ComponentTransform& root_transform = hierarchy.front()->transform;
+		return Benchmark::AverageMs(static_cast<size_t>(transform_benchmark_frames), [&](size_t frame)
+		{
+			float time = static_cast<float>(frame);
+			root_transform.SetTranslation(float3(time, 0.f, 0.f));
+			if (eager)
+			{
+				resolve_hierarchy(hierarchy);
+			}
+			root_transform.SetRotation(Quat::RotateY(time * 0.01f));
+			if (eager)
+			{
+				resolve_hierarchy(hierarchy);
+			}
+			root_transform.SetScale(float3(1.f + time * 0.001f));
+			resolve_hierarchy(hierarchy);
+		});
+	};
+
+	transform_benchmark_deep_times[0] = run_frames(deep_hierarchy, true);
+	transform_benchmark_deep_times[1] = run_frames(deep_hierarchy, false);
+	transform_benchmark_wide_times[0] = run_frames(wide_hierarchy, true);
+	transform_benchmark_wide_times[1] = run_frames(wide_hierarchy, false);
+
+	APP_LOG_INFO("Transform propagation benchmark. Deep: eager %.3f ms lazy %.3f ms", transform_benchmark_deep_times[0], transform_benchmark_deep_times[1]);
+	APP_LOG_INFO("Transform propagation benchmark. Wide: eager %.3f ms lazy %.3f ms", transform_benchmark_wide_times[0], transform_benchmark_wide_times[1]);
+}
+
+void ModuleDebug::RunTransformHierarchyBenchmark()
+{
+	APP_LOG_INFO("Running transform hierarchy benchmark: %d nodes, branching %d, %d frames", transform_hierarchy_benchmark_nodes, transform_hierarchy_benchmark_branching, transform_benchmark_frames);
+
+	// Complete tree stored breadth first, so nodes are already sorted by depth
+	TransformHierarchy hierarchy;
+	size_t num_nodes = static_cast<size_t>(transform_hierarchy_benchmark_nodes);
+	size_t branching = static_cast<size_t>(max(transform_hierarchy_benchmark_branching, 1));
+	hierarchy.AddNode(-1);
+	for (size_t i = 1; i < num_nodes; ++i)
+	{
+		hierarchy.AddNode(static_cast<int>((i - 1) / branching));
+	}
+
+	for (int run = 0; run < 2; ++run)
+	{
+		hierarchy.parallel = run == 1;
+		transform_hierarchy_benchmark_times[run] = Benchmark::AverageMs(static_cast<size_t>(transform_benchmark_frames), [&](size_t frame)
+		{
+			// Every transform moves every frame
+			Quat frame_rotation = Quat::RotateY(frame * 0.01f);
+			for (size_t i = 0; i < num_nodes; ++i)
+			{
+				hierarchy.SetLocalTransform(i, float3(static_cast<float>(i % branching), 1.f, 0.f), frame_rotation, float3::one);
+			}
+			hierarchy.Update();
+		});
+	}
+
+	APP_LOG_INFO("Transform hierarchy benchmark. One thread: %.3f ms Job system (%u threads): %.3f ms", transform_hierarchy_benchmark_times[0], static_cast<unsigned int>(App->job_system->GetNumThreads()), transform_hierarchy_benchmark_times[1]);
+}
+
+void ModuleDebug::RunSceneLookupBenchmark()
+{
+	APP_LOG_INFO("Running scene lookup benchmark: %d objects, %d lookups", scene_lookup_benchmark_objects, scene_lookup_benchmark_lookups);
+
+	// Standalone game objects, they are not registered in the scene
+	size_t num_objects = static_cast<size_t>(max(scene_lookup_benchmark_objects, 1));
+	std::vector<std::unique_ptr<GameObject>> game_objects;
+	game_objects.reserve(num_objects);
+	SceneIndex scene_index;
+	for (size_t i = 0; i < num_objects; ++i)
+	{
+		game_objects.emplace_back(std::make_unique<GameObject>("GameObject " + std::to_string(i)));
+		game_objects.back()->tag = "Tag " + std::to_string(i % 100);
+		scene_index.Index(game_objects.back().get());
+	}
+
+	std::mt19937 random_engine(1);
+	std::uniform_int_distribution<size_t> distribution(0, num_objects - 1);
+	std::vector<const GameObject*> targets(static_cast<size_t>(max(scene_lookup_benchmark_lookups, 1)));
+	for (auto& target : targets)
+	{
+		target = game_objects[distribution(random_engine)].get();
+	}
+
+	// Same scans ModuleScene did before the index
+	auto linear_lookup = [&game_objects](auto predicate) -> GameObject*
+	{
+		for (const auto& game_object : game_objects)
+		{
+			if (predicate(*game_object))
+			{
+				return game_object.get();
+			}
+		}
+		return nullptr;
+	};
+
+	scene_lookup_benchmark_times[0][0] = Benchmark::AverageLookupUs(targets, [&](const GameObject* target) { return linear_lookup([target](const GameObject& game_object) { return game_object.UUID == target->UUID; }); });
+	scene_lookup_benchmark_times[0][1] = Benchmark::AverageLookupUs(targets, [&](const GameObject* target) { return scene_index.GetGameObject(target->UUID); });
+	scene_lookup_benchmark_times[1][0] = Benchmark::AverageLookupUs(targets, [&](const GameObject* target) { return linear_lookup([target](const GameObject& game_object) { return game_object.name == target->name; }); });
+	scene_lookup_benchmark_times[1][1] = Benchmark::AverageLookupUs(targets, [&](const GameObject* target) { return scene_index.GetGameObjectByName(target->name); });
+	scene_lookup_benchmark_times[2][0] = Benchmark::AverageLookupUs(targets, [&](const GameObject* target) { return linear_lookup([target](const GameObject& game_object) { return game_object.tag == target->tag; }); });
+	scene_lookup_benchmark_times[2][1] = Benchmark::AverageLookupUs(targets, [&](const GameObject* target) { return scene_index.GetGameObjectWithTag(target->tag); });
+
+	APP_LOG_INFO("Scene lookup benchmark. UUID: linear %.3f us index %.3f us", scene_lookup_benchmark_times[0][0], scene_lookup_benchmark_times[0][1]);
+	APP_LOG_INFO("Scene lookup benchmark. Name: linear %.3f us index %.3f us", scene_lookup_benchmark_times[1][0], scene_lookup_benchmark_times[1][1]);
+	APP_LOG_INFO("Scene lookup benchmark. Tag: linear %.3f us index %.3f us", scene_lookup_benchmark_times[2][0], scene_lookup_benchmark_times[2][1]);
+}
+
+void ModuleDebug::RunComponentPoolBenchmark()
+{
+	APP_LOG_INFO("Running component pool benchmark: %d components, %d frames", component_pool_benchmark_components, component_pool_benchmark_frames);
+
+	// Roughly the size of a mesh renderer, updated the way modules update their components
+	struct BenchmarkComponent
+	{
+		BenchmarkComponent(size_t id) : id(id) {}
+
+		size_t id = 0;
+		bool active = true;
+		float4x4 model_matrix = float4x4::identity;
+		float3 position = float3::zero;
+		float padding[32] = {};
+		uint32_t pool_index = UINT32_MAX;
+	};
+
+	size_t num_components = static_cast<size_t>(max(component_pool_benchmark_components, 100));
+	size_t num_frames = static_cast<size_t>(max(component_pool_benchmark_frames, 1));
+	size_t num_removals = num_components / 100;
+
+	std::mt19937 random_engine(1);
+	std::vector<size_t> removals(num_removals);
+	for (size_t i = 0; i < num_removals; ++i)
+	{
+		removals[i] = std::uniform_int_distribution<size_t>(0, num_components - i - 1)(random_engine);
+	}
+
+	auto update = [num_frames](const auto& components)
+	{
+		float sum = 0.f;
+		for (size_t frame = 0; frame < num_frames; ++frame)
+		{
+			for (const auto& component : components)
+			{
+				if (component->active)
+				{
+					component->position = component->model_matrix.TransformPos(component->position + float3::unitX);
+					sum += component->position.x;
+				}
+			}
+		}
+		return sum;
+	};
+
+	// Before: one new per component, interleaved with the other allocations a scene load makes
+	{
+		std::vector<BenchmarkComponent*> components;
+		std::vector<std::unique_ptr<std::string>> other_allocations;
+		component_pool_benchmark_times[0][0] = Benchmark::TimeMs([&]()
+		{
+			for (size_t i = 0; i < num_components; ++i)
+			{
+				components.push_back(new BenchmarkComponent(i));
+				other_allocations.emplace_back(std::make_unique<std::string>(64, 'x'));
+			}
+		});
+		component_pool_benchmark_allocations[0] = num_components;
+
+		float sum = 0.f;
+		component_pool_benchmark_times[1][0] = Benchmark::TimeMs([&]() { sum = update(components); }) / num_frames;
+
+		component_pool_benchmark_times[2][0] = Benchmark::TimeMs([&]()
+		{
+			for (size_t removal : removals)
+			{
+				// Same find and erase the modules did before the pools
+				BenchmarkComponent* component_to_remove = components[removal];
+				auto it = std::find(components.begin(), components.end(), component_to_remove);
+				delete *it;
+				components.erase(it);
+			}
+		});
+
+		APP_LOG_INFO("Component pool benchmark checksum (new): %f", sum);
+		for (auto& component : components)
+		{
+			delete component;
+		}
+	}
+
+	// After: components packed in pool pages
+	{
+		ComponentPool<BenchmarkComponent> components;
+		std::vector<std::unique_ptr<std::string>> other_allocations;
+		component_pool_benchmark_times[0][1] = Benchmark::TimeMs([&]()
+		{
+			for (size_t i = 0; i < num_components; ++i)
+			{
+				components.Create(i);
+				other_allocations.emplace_back(std::make_unique<std::string>(64, 'x'));
+			}
+		});
+		component_pool_benchmark_allocations[1] = components.GetNumAllocations();
+
+		float sum = 0.f;
+		component_pool_benchmark_times[1][1] = Benchmark::TimeMs([&]() { sum = update(components); }) / num_frames;
+
+		component_pool_benchmark_times[2][1] = Benchmark::TimeMs([&]()
+		{
+			for (size_t removal : removals)
+			{
+				components.Destroy(components[removal]);
+			}
+		});
+
+		APP_LOG_INFO("Component pool benchmark checksum (pool): %f", sum);
+	}
+
+	APP_LOG_INFO("Component pool benchmark. Allocations: new %zu pool %zu", component_pool_benchmark_allocations[0], component_pool_benchmark_allocations[1]);
+	APP_LOG_INFO("Component pool benchmark. Create: new %.3f ms pool %.3f ms", component_pool_benchmark_times[0][0], component_pool_benchmark_times[0][1]);
+	APP_LOG_INFO("Component pool benchmark. Iterate: new %.3f ms pool %.3f ms", component_pool_benchmark_times[1][0], component_pool_benchmark_times[1][1]);
+	APP_LOG_INFO("Component pool benchmark. Remove %zu: new %.3f ms pool %.3f ms", num_removals, component_pool_benchmark_times[2][0], component_pool_benchmark_times[2][1]);
+}
+
+void ModuleDebug::RunSceneFormatBenchmark()
+{
+	APP_LOG_INFO("Running scene format benchmark: %d game objects", scene_format_benchmark_objects);
+
+	size_t num_objects = static_cast<size_t>(max(scene_format_benchmark_objects, 1));
+	Config scene_config;
+	CreateBenchmarkSceneConfig(num_objects, scene_config);
+
+	std::string serialized_scene_string;
+	scene_config.GetSerializedString(serialized_scene_string);
+	FileData binary_scene_data = SceneBinary::Convert(scene_config);
+	scene_format_benchmark_sizes[0] = serialized_scene_string.size();
+	scene_format_benchmark_sizes[1] = binary_scene_data.size;
+
+	// Both paths read every field GameObject::Load reads, without creating the game objects, so only the format is measured
+	float checksum[2] = { 0.f, 0.f };
+	{
+		auto start = Benchmark::Clock::now();
+		Config loaded_scene_config(serialized_scene_string);
+		std::vector<Config> loaded_game_objects_config;
+		loaded_scene_config.GetChildrenConfig("GameObjects", loaded_game_objects_config);
+
+		std::string name;
+		std::string tag;
+		for (const auto& game_object_config : loaded_game_objects_config)
+		{
+			game_object_config.GetString("Name", name, "GameObject");
+			game_object_config.GetString("Tag", tag, "");
+			uint64_t UUID = game_object_config.GetUInt("UUID", 0);
+			bool is_static = game_object_config.GetBool("IsStatic", false);
+
+			Config transform_config;
+			game_object_config.GetChildConfig("Transform", transform_config);
+			float3 translation;
+			transform_config.GetFloat3("Translation", translation, float3::zero);
+
+			Config transform_2d_config;
+			game_object_config.GetChildConfig("Transform2D", transform_2d_config);
+
+			std::vector<Config> components_config;
+			game_object_config.GetChildrenConfig("Components", components_config);
+			for (const auto& component_config : components_config)
+			{
+				checksum[0] += component_config.GetUInt("Mesh", 0);
+			}
+			checksum[0] += translation.x + (UUID & 1) + name.size() + tag.size() + (is_static ? 1 : 0);
+		}
+		scene_format_benchmark_times[0] = Benchmark::ElapsedMs(start);
+	}
+
+	{
+		auto start = Benchmark::Clock::now();
+		SceneBinary scene_binary(static_cast<const char*>(binary_scene_data.buffer), binary_scene_data.size);
+		assert(scene_binary.IsValid());
+
+		std::string name;
+		std::string tag;
+		Config transform_2d_config;
+		Config component_config;
+		for (size_t i = 0; i < scene_binary.GetNumGameObjects(); ++i)
+		{
+			const SceneBinary::GameObjectRecord& game_object_record = scene_binary.GetGameObject(i);
+			name = scene_binary.GetString(game_object_record.name);
+			tag = scene_binary.GetString(game_object_record.tag);
+			float3 translation(game_object_record.translation);
+
+			bool read = scene_binary.ReadConfig(game_object_record.transform_2d, transform_2d_config);
+			assert(read);
+			for (uint32_t j = 0; j < game_object_record.num_components; ++j)
+			{
+				const SceneBinary::ComponentRecord& component_record = scene_binary.GetComponent(game_object_record.first_component + j);
+				if (component_record.data == SceneBinary::NONE)
+				{
+					checksum[1] += component_record.mesh_renderer.mesh_uuid;
+					continue;
+				}
+				read = scene_binary.ReadConfig(component_record.data, component_config);
+				assert(read);
+				checksum[1] += component_config.GetUInt("Mesh", 0);
+			}
+			checksum[1] += translation.x + (game_object_record.UUID & 1) + name.size() + tag.size() + game_object_record.is_static;
+		}
+		scene_format_benchmark_times[1] = Benchmark::ElapsedMs(start);
+	}
+	delete[] binary_scene_data.buffer;
+
+	assert(checksum[0] == checksum[1]);
+	APP_LOG_INFO("Scene format benchmark checksum: %f", checksum[1]);
+	APP_LOG_INFO("Scene format benchmark. Size: JSON %zu bytes binary %zu bytes", scene_format_benchmark_sizes[0], scene_format_benchmark_sizes[1]);
+	APP_LOG_INFO("Scene format benchmark. Load: JSON %.3f ms binary %.3f ms", scene_format_benchmark_times[0], scene_format_benchmark_times[1]);
+}
+
+void ModuleDebug::RunConfigBenchmark()
+{
+	APP_LOG_INFO("Running config benchmark: %d game objects", config_benchmark_objects);
+
+	size_t num_objects = static_cast<size_t>(max(config_benchmark_objects, 1));
+	std::string serialized_scene_string;
+	{
+		Config scene_config;
+		CreateBenchmarkSceneConfig(num_objects, scene_config);
+		scene_config.GetSerializedString(serialized_scene_string);
+	}
+
+	// Fields Scene::Load and GameObject::Load read from every game object
+	auto read_game_object = [](const Config& game_object_config, const Config& transform_config, const std::vector<Config>& components_config)
+	{
+		std::string name;
+		game_object_config.GetString("Name", name, "GameObject");
+		float3 translation;
+		transform_config.GetFloat3("Translation", translation, float3::zero);
+		float sum = translation.x + game_object_config.GetUInt("UUID", 0) % 2 + name.size();
+		for (const auto& component_config : components_config)
+		{
+			sum += component_config.GetUInt("Mesh", 0);
+		}
+		return sum;
+	};
+
+	float checksum[2] = { 0.f, 0.f };
+
+	// Before: file copied into a string, then every child deep copied into its own document, as GetChildConfig and GetChildrenConfig did
+	{
+		size_t documents = 0;
+		size_t document_bytes = serialized_scene_string.size();
+		auto copy_config = [&documents, &document_bytes](const Config& config_to_copy)
+		{
+			Config copied_config(config_to_copy);
+			++documents;
+			document_bytes += copied_config.GetAllocator().Capacity();
+			return copied_config;
+		};
+
+		auto start = Benchmark::Clock::now();
+		std::string copied_scene_string(serialized_scene_string.c_str(), serialized_scene_string.size());
+		Config scene_config(copied_scene_string);
+		++documents;
+		document_bytes += scene_config.GetAllocator().Capacity();
+
+		std::vector<Config> game_objects_view;
+		scene_config.GetChildrenConfig("GameObjects", game_objects_view);
+		std::vector<Config> game_objects_config;
+		for (const auto& game_object_view : game_objects_view)
+		{
+			game_objects_config.push_back(copy_config(game_object_view));
+		}
+
+		for (const auto& game_object_config : game_objects_config)
+		{
+			Config transform_view;
+			game_object_config.GetChildConfig("Transform", transform_view);
+			Config transform_config = copy_config(transform_view);
+			Config transform_2d_view;
+			game_object_config.GetChildConfig("Transform2D", transform_2d_view);
+			Config transform_2d_config = copy_config(transform_2d_view);
+
+			std::vector<Config> components_view;
+			game_object_config.GetChildrenConfig("Components", components_view);
+			std::vector<Config> components_config;
+			for (const auto& component_view : components_view)
+			{
+				components_config.push_back(copy_config(component_view));
+			}
+			checksum[0] += read_game_object(game_object_config, transform_config, components_config);
+		}
+		config_benchmark_times[0] = Benchmark::ElapsedMs(start);
+		config_benchmark_documents[0] = documents;
+		config_benchmark_bytes[0] = document_bytes;
+	}
+
+	// After: in situ parse of one buffer copy, children are views into it
+	{
+		auto start = Benchmark::Clock::now();
+		Config scene_config(serialized_scene_string.c_str(), serialized_scene_string.size());
+
+		std::vector<Config> game_objects_config;
+		scene_config.GetChildrenConfig("GameObjects", game_objects_config);
+		std::vector<Config> components_config;
+		for (const auto& game_object_config : game_objects_config)
+		{
+			Config transform_config;
+			game_object_config.GetChildConfig("Transform", transform_config);
+			Config transform_2d_config;
+			game_object_config.GetChildConfig("Transform2D", transform_2d_config);
+			game_object_config.GetChildrenConfig("Components", components_config);
+			checksum[1] += read_game_object(game_object_config, transform_config, components_config);
+		}
+		config_benchmark_times[1] = Benchmark::ElapsedMs(start);
+		config_benchmark_documents[1] = 1;
+		config_benchmark_bytes[1] = serialized_scene_string.size() + 1 + scene_config.GetAllocator().Capacity();
+	}
+
+	assert(checksum[0] == checksum[1]);
+	APP_LOG_INFO("Config benchmark checksum: %f", checksum[1]);
+	APP_LOG_INFO("Config benchmark. Documents: copies %zu views %zu", config_benchmark_documents[0], config_benchmark_documents[1]);
+	APP_LOG_INFO("Config benchmark. Allocated: copies %zu KB views %zu KB", config_benchmark_bytes[0] / 1024, config_benchmark_bytes[1] / 1024);
+	APP_LOG_INFO("Config benchmark. Load: copies %.3f ms views %.3f ms", config_benchmark_times[0], config_benchmark_times[1]);
+}
+
+void ModuleDebug::RunSceneDeserializationBenchmark()
+{
+	scene_deserialization_benchmark_threads = App->job_system->GetNumThreads();
+	APP_LOG_INFO("Running scene deserialization benchmark: %d game objects, %zu threads", scene_deserialization_benchmark_objects, scene_deserialization_benchmark_threads);
+
+	size_t num_objects = static_cast<size_t>(max(scene_deserialization_benchmark_objects, 1));
+	Config scene_config;
+	CreateBenchmarkSceneConfig(num_objects, scene_config);
+	std::vector<Config> game_objects_config;
+	scene_config.GetChildrenConfig("GameObjects", game_objects_config);
+
+	FileData binary_scene_data = SceneBinary::Convert(scene_config);
+	SceneBinary scene_binary(static_cast<const char*>(binary_scene_data.buffer), binary_scene_data.size);
+	assert(scene_binary.IsValid());
+
+	// Same parse phase as Scene::LoadStep, run on one thread and split among the job system threads. Every run parses into new descriptors.
+	auto parse_game_objects = [num_objects](bool parallel, const std::function<void(GameObjectDescriptor&, size_t)>& parse)
+	{
+		const size_t BATCH_SIZE = 64;
+		std::vector<GameObjectDescriptor> descriptors(num_objects);
+		auto start = Benchmark::Clock::now();
+		if (parallel)
+		{
+			App->job_system->ParallelFor(num_objects, BATCH_SIZE, [&descriptors, &parse](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					parse(descriptors[i], i);
+				}
+			});
+		}
+		else
+		{
+			for (size_t i = 0; i < num_objects; ++i)
+			{
+				parse(descriptors[i], i);
+			}
+		}
+		return Benchmark::ElapsedMs(start);
+	};
+
+	for (size_t parallel = 0; parallel < 2; ++parallel)
+	{
+		scene_deserialization_benchmark_times[0][parallel] = parse_game_objects(parallel != 0, [&game_objects_config](GameObjectDescriptor& descriptor, size_t i)
+		{
+			descriptor.Parse(game_objects_config[i]);
+		});
+		scene_deserialization_benchmark_times[1][parallel] = parse_game_objects(parallel != 0, [&scene_binary](GameObjectDescriptor& descriptor, size_t i)
+		{
+			bool parsed = descriptor.Parse(scene_binary, i);
+			assert(parsed);
+		});
+	}
+	delete[] binary_scene_data.buffer;
+
+	const char* format_names[2] = { "JSON", "binary" };
+	for (size_t i = 0; i < 2; ++i)
+	{
+		float speedup = Benchmark::Speedup(scene_deserialization_benchmark_times[i][0], scene_deserialization_benchmark_times[i][1]);
+		APP_LOG_INFO("Scene deserialization benchmark. %s: one thread %.3f ms job system %.3f ms (x%.2f)", format_names[i], scene_deserialization_benchmark_times[i][0], scene_deserialization_benchmark_times[i][1], speedup);
+	}
+}
+
+void ModuleDebug::RunSceneSaveBenchmark()
+{
+	APP_LOG_INFO("Running scene save benchmark: %d game objects", scene_save_benchmark_objects);
+
+	size_t num_objects = static_cast<size_t>(max(scene_save_benchmark_objects, 1));
+	GameObject root(0);
+	std::vector<std::unique_ptr<GameObject>> game_objects;
+	game_objects.reserve(num_objects);
+	for (size_t i = 0; i < num_objects; ++i)
+	{
+		game_objects.emplace_back(std::make_unique<GameObject>("GameObject " + std::to_string(i)));
+		GameObject* game_object = game_objects.back().get();
+		game_object->tag = "Tag " + std::to_string(i % 100);
+		game_object->transform.SetTranslation(float3(static_cast<float>(i), 0.f, 0.f));
+		game_object->parent = &root;
+		root.children.push_back(game_object);
+	}
+
+	// The peak working set only grows, streamed saves go first so the document save is not hidden by them
+	auto peak_working_set = []()
+	{
+		PROCESS_MEMORY_COUNTERS memory_counters;
+		GetProcessMemoryInfo(GetCurrentProcess(), &memory_counters, sizeof(memory_counters));
+		return static_cast<size_t>(memory_counters.PeakWorkingSetSize);
+	};
+
+	Scene scene;
+	size_t streamed_hashes[2] = { 0, 0 };
+	for (size_t binary = 0; binary < 2; ++binary)
+	{
+		size_t peak_before = peak_working_set();
+		auto start = Benchmark::Clock::now();
+		FileData scene_data = binary ? scene.SaveBinary(&root) : scene.Save(&root);
+		scene_save_benchmark_times[1 + binary] = Benchmark::ElapsedMs(start);
+		scene_save_benchmark_peak_growth[1 + binary] = peak_working_set() - peak_before;
+
+		streamed_hashes[binary] = std::hash<std::string_view>()(std::string_view(static_cast<const char*>(scene_data.buffer), scene_data.size));
+		delete[] scene_data.buffer;
+	}
+
+	// What Scene::Save did before streaming: the whole scene document, its serialized string and the copy written to the file
+	size_t document_hashes[2] = { 0, 0 };
+	{
+		size_t peak_before = peak_working_set();
+		auto start = Benchmark::Clock::now();
+		Config scene_config;
+		std::vector<Config> prefabs_config;
+		std::vector<Config> prefabs_components_config;
+		std::vector<Config> game_objects_config;
+		for (const auto& game_object : game_objects)
+		{
+			Config game_object_config;
+			game_object->Save(game_object_config);
+			game_objects_config.push_back(game_object_config);
+		}
+		scene_config.AddChildrenConfig(prefabs_config, "Prefabs");
+		scene_config.AddChildrenConfig(prefabs_components_config, "PrefabsComponents");
+		scene_config.AddChildrenConfig(game_objects_config, "GameObjects");
+		scene_config.AddVector(std::vector<uint32_t>(), "Dependencies");
+		Scene::SaveSettings(scene_config);
+
+		std::string serialized_scene_string;
+		scene_config.GetSerializedString(serialized_scene_string);
+		char* scene_bytes = new char[serialized_scene_string.size() + 1];
+		memcpy(scene_bytes, serialized_scene_string.c_str(), serialized_scene_string.size() + 1);
+		scene_save_benchmark_times[0] = Benchmark::ElapsedMs(start);
+		scene_save_benchmark_peak_growth[0] = peak_working_set() - peak_before;
+
+		document_hashes[0] = std::hash<std::string_view>()(std::string_view(scene_bytes, serialized_scene_string.size() + 1));
+		delete[] scene_bytes;
+
+		FileData binary_scene_data = SceneBinary::Convert(scene_config);
+		document_hashes[1] = std::hash<std::string_view>()(std::string_view(static_cast<const char*>(binary_scene_data.buffer), binary_scene_data.size));
+		delete[] binary_scene_data.buffer;
+	}
+
+	scene_save_benchmark_identical = streamed_hashes[0] == document_hashes[0] && streamed_hashes[1] == document_hashes[1];
+	APP_LOG_INFO("Scene save benchmark. Streamed output identical: %s", scene_save_benchmark_identical ? "yes" : "no");
+	APP_LOG_INFO("Scene save benchmark. Time: document %.3f ms streamed JSON %.3f ms streamed binary %.3f ms", scene_save_benchmark_times[0], scene_save_benchmark_times[1], scene_save_benchmark_times[2]);
+	APP_LOG_INFO("Scene save benchmark. Peak working set growth: document %zu KB streamed JSON %zu KB streamed binary %zu KB", scene_save_benchmark_peak_growth[0] / 1024, scene_save_benchmark_peak_growth[1] / 1024, scene_save_benchmark_peak_growth[2] / 1024);
+}
+
+// Spawns instances of the prefab selected in the editor and removes them after each run
+void ModuleDebug::RunPrefabSpawnBenchmark()
+{
+	GameObject* selected_game_object = App->editor->selected_game_object;
+	if (selected_game_object == nullptr || selected_game_object->prefab_reference == nullptr)
+	{
+		APP_LOG_ERROR("Prefab spawn benchmark needs a prefab instance selected.");
+		return;
+	}
+
+	std::shared_ptr<Prefab> prefab = selected_game_object->prefab_reference;
+	size_t num_instances = static_cast<size_t>(max(prefab_spawn_benchmark_instances, 1));
+	prefab_spawn_benchmark_scripts = App->scripts->scripts.size();
+	APP_LOG_INFO("Running prefab spawn benchmark: %zu instances, %zu scripts in the scene", num_instances, prefab_spawn_benchmark_scripts);
+
+	std::vector<float4x4> transforms(num_instances);
+	for (size_t i = 0; i < num_instances; ++i)
+	{
+		transforms[i] = float4x4::FromTRS(float3(2.f * static_cast<float>(i % 32), 0.f, 2.f * static_cast<float>(i / 32)), Quat::identity, float3::one);
+	}
+
+	auto remove_instances = [](const std::vector<GameObject*>& spawned_instances)
+	{
+		for (const auto& instance : spawned_instances)
+		{
+			App->scene->DestroyGameObject(instance);
+		}
+		App->scene->DestroyPendingGameObjects();
+	};
+
+	std::vector<GameObject*> spawned_instances;
+	spawned_instances.reserve(num_instances);
+	for (size_t one_by_one = 0; one_by_one < 2; ++one_by_one)
+	{
+		auto start = Benchmark::Clock::now();
+		for (size_t i = 0; i < num_instances; ++i)
+		{
+			GameObject* instance = prefab->Instantiate(App->scene->GetRoot());
+			instance->transform.SetTranslation(transforms[i].TranslatePart());
+			spawned_instances.push_back(instance);
+
+			// What Instantiate did before linking only the new game objects
+			if (one_by_one == 0)
+			{
+				App->animations->UpdateAnimationMeshes();
+				App->scripts->ReLink();
+			}
+		}
+		prefab_spawn_benchmark_times[one_by_one] = Benchmark::ElapsedMs(start);
+		remove_instances(spawned_instances);
+		spawned_instances.clear();
+	}
+
+	auto start = Benchmark::Clock::now();
+	spawned_instances = prefab->InstantiateBatch(App->scene->GetRoot(), num_instances, transforms);
+	prefab_spawn_benchmark_times[2] = Benchmark::ElapsedMs(start);
+	remove_instances(spawned_instances);
+
+	APP_LOG_INFO("Prefab spawn benchmark. Time: relinking the scene %.3f ms one by one %.3f ms batch %.3f ms", prefab_spawn_benchmark_times[0], prefab_spawn_benchmark_times[1], prefab_spawn_benchmark_times[2]);
+}
+
+// Every frame spawns every instance of the prefab selected in the editor and despawns them all
+void ModuleDebug::RunPrefabPoolBenchmark()
+{
+	GameObject* selected_game_object = App->editor->selected_game_object;
+	if (selected_game_object == nullptr || selected_game_object->prefab_reference == nullptr)
+	{
+		APP_LOG_ERROR("Prefab pool benchmark needs a prefab instance selected.");
+		return;
+	}
+
+	std::shared_ptr<Prefab> prefab = selected_game_object->prefab_reference;
+	size_t num_instances = static_cast<size_t>(max(prefab_pool_benchmark_instances, 1));
+	size_t num_frames = static_cast<size_t>(max(prefab_pool_benchmark_frames, 1));
+	APP_LOG_INFO("Running prefab pool benchmark: %zu instances, %zu frames, %d warmed up", num_instances, num_frames, prefab_pool_benchmark_warmup);
+
+	auto spawn_position = [](size_t i)
+	{
+		return float3(2.f * static_cast<float>(i % 32), 0.f, 2.f * static_cast<float>(i / 32));
+	};
+
+	std::vector<GameObject*> spawned_instances;
+	spawned_instances.reserve(num_instances);
+	prefab_pool_benchmark_times[0] = Benchmark::AverageMs(num_frames, [&](size_t frame)
+	{
+		for (size_t i = 0; i < num_instances; ++i)
+		{
+			GameObject* instance = prefab->Instantiate(App->scene->GetRoot());
+			instance->transform.SetTranslation(spawn_position(i));
+			spawned_instances.push_back(instance);
+		}
+		for (const auto& instance : spawned_instances)
+		{
+			App->scene->DestroyGameObject(instance);
+		}
+		App->scene->DestroyPendingGameObjects();
+		spawned_instances.clear();
+	});
+
+	// A pool of its own, so the pools of the scene and their metrics are left as they are
+	PrefabPool prefab_pool(prefab);
+	prefab_pool.Warmup(static_cast<size_t>(max(prefab_pool_benchmark_warmup, 0)));
+	prefab_pool_benchmark_times[1] = Benchmark::AverageMs(num_frames, [&](size_t frame)
+	{
+		for (size_t i = 0; i < num_instances; ++i)
+		{
+			spawned_instances.push_back(prefab_pool.Spawn(App->scene->GetRoot(), spawn_position(i), Quat::identity));
+		}
+		for (const auto& instance : spawned_instances)
+		{
+			prefab_pool.Despawn(instance);
+		}
+		spawned_instances.clear();
+	});
+	prefab_pool_benchmark_hit_rate = prefab_pool.GetHitRate();
+	prefab_pool.Clear();
+	App->scene->DestroyPendingGameObjects();
+
+	APP_LOG_INFO("Prefab pool benchmark. Hit rate: %.1f%%", 100.f * prefab_pool_benchmark_hit_rate);
+	APP_LOG_INFO("Prefab pool benchmark. Frame time: instantiate and destroy %.3f ms pool %.3f ms", prefab_pool_benchmark_times[0], prefab_pool_benchmark_times[1]);
+}
+
+void ModuleDebug::RunResourceCacheBenchmark()
+{
+	size_t num_resources = static_cast<size_t>(max(resource_cache_benchmark_resources, 1));
+	size_t num_lookups = static_cast<size_t>(max(resource_cache_benchmark_lookups, 1));
+	APP_LOG_INFO("Running resource cache benchmark: %zu resources, %zu lookups, %d%% budget", num_resources, num_lookups, resource_cache_benchmark_budget);
+
+	// Standalone resources of one megabyte, neither loaded from the library nor added to the resource manager cache
+	const size_t resource_memory = 1024 * 1024;
+	std::vector<std::shared_ptr<Resource>> linear_cache;
+	linear_cache.reserve(num_resources);
+	ResourceCache resource_cache;
+	resource_cache.SetBudget(num_resources * resource_memory);
+	for (size_t i = 0; i < num_resources; ++i)
+	{
+		linear_cache.push_back(std::make_shared<Resource>(static_cast<uint32_t>(i + 1)));
+		resource_cache.Add(linear_cache.back(), ResourceType::TEXTURE, resource_memory);
+	}
+
+	std::mt19937 random_engine(1);
+	std::uniform_int_distribution<uint32_t> distribution(1, static_cast<uint32_t>(num_resources));
+	std::vector<uint32_t> lookups(num_lookups);
+	for (auto& lookup : lookups)
+	{
+		lookup = distribution(random_engine);
+	}
+
+	// Same scan ModuleResourceManager did before the hash cache
+	resource_cache_benchmark_times[0] = Benchmark::AverageLookupUs(lookups, [&linear_cache](uint32_t uuid)
+	{
+		auto it = std::find_if(linear_cache.begin(), linear_cache.end(), [uuid](const std::shared_ptr<Resource>& resource) { return resource->GetUUID() == uuid; });
+		return it != linear_cache.end() ? *it : nullptr;
+	});
+	resource_cache_benchmark_times[1] = Benchmark::AverageLookupUs(lookups, [&resource_cache](uint32_t uuid) { return resource_cache.Get(uuid); });
+
+	// Nothing else holds the resources, a miss loads the resource again and the cache is trimmed once per frame of a hundred lookups
+	linear_cache.clear();
+	resource_cache.Clear();
+	resource_cache.SetBudget(num_resources * resource_memory * static_cast<size_t>(max(resource_cache_benchmark_budget, 1)) / 100);
+	std::uniform_int_distribution<uint32_t> hot_distribution(1, static_cast<uint32_t>(max(num_resources / 5, static_cast<size_t>(1))));
+	std::uniform_int_distribution<int> hot_chance(0, 9);
+	for (size_t i = 0; i < num_lookups; ++i)
+	{
+		uint32_t uuid = hot_chance(random_engine) < 8 ? hot_distribution(random_engine) : distribution(random_engine);
+		if (resource_cache.Get(uuid) == nullptr)
+		{
+			resource_cache.Add(std::make_shared<Resource>(uuid), ResourceType::TEXTURE, resource_memory);
+		}
+		if (i % 100 == 99)
+		{
+			resource_cache.Trim();
+		}
+	}
+
+	ResourceCache::Stats stats = resource_cache.GetStats();
+	resource_cache_benchmark_hit_rate = static_cast<float>(stats.hits) / static_cast<float>(stats.hits + stats.misses);
+	resource_cache_benchmark_evictions = stats.evictions;
+
+	APP_LOG_INFO("Resource cache benchmark. Lookup: linear %.3f us hash %.3f us", resource_cache_benchmark_times[0], resource_cache_benchmark_times[1]);
+	APP_LOG_INFO("Resource cache benchmark. Under budget: hit rate %.1f%% evictions %zu", 100.f * resource_cache_benchmark_hit_rate, resource_cache_benchmark_evictions);
+}
+
+void ModuleDebug::RunResourcePriorityBenchmark()
+{
+	size_t num_loads = static_cast<size_t>(max(resource_priority_benchmark_loads, 1));
+	size_t num_threads = static_cast<size_t>(max(resource_priority_benchmark_threads, 1));
+	float aging = resource_priority_benchmark_aging > 0.f ? resource_priority_benchmark_aging : 0.f;
+	APP_LOG_INFO("Running resource priority benchmark: %zu loads, %zu threads, %.2f ms decode", num_loads, num_threads, resource_priority_benchmark_decode_ms);
+
+	// Loads arrive in bursts a bit faster than the workers decode them, so the queue grows while the benchmark runs
+	const size_t num_bursts = 20;
+	const float max_priority = 10.f;
+	std::mt19937 random_engine(1);
+	std::uniform_real_distribution<float> priority_distribution(0.f, max_priority);
+	std::vector<float> priorities(num_loads);
+	for (auto& priority : priorities)
+	{
+		priority = priority_distribution(random_engine);
+	}
+	float decode_ms = resource_priority_benchmark_decode_ms;
+	float burst_ms = 0.8f * decode_ms * num_loads / (num_bursts * num_threads);
+
+	// Standalone loader whose loads only spin for the decode time, neither files nor resources are involved
+	auto simulate = [&](bool prioritized, std::vector<std::shared_ptr<AsyncLoad>>& loads, std::vector<float>& waits)
+	{
+		ResourceLoader resource_loader;
+		resource_loader.SetAging(aging);
+		resource_loader.Init(num_threads);
+
+		auto start = Benchmark::Clock::now();
+		auto elapsed_ms = [start]()
+		{
+			return Benchmark::ElapsedMs(start);
+		};
+
+		loads.resize(num_loads);
+		waits.assign(num_loads, 0.f);
+		std::vector<float> queued_ms(num_loads, 0.f);
+		for (size_t i = 0; i < num_loads; ++i)
+		{
+			if (i % (num_loads / num_bursts + 1) == 0)
+			{
+				while (elapsed_ms() < burst_ms * (i / (num_loads / num_bursts + 1)))
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			loads[i] = std::make_shared<AsyncLoad>();
+			loads[i]->priority = prioritized ? priorities[i] : 0.f;
+			loads[i]->load_function = [&waits, &queued_ms, &elapsed_ms, decode_ms, i](size_t& file_size) -> std::shared_ptr<Resource>
+			{
+				float decode_start_ms = elapsed_ms();
+				waits[i] = decode_start_ms - queued_ms[i];
+				while (elapsed_ms() - decode_start_ms < decode_ms)
+				{
+				}
+				return nullptr;
+			};
+			queued_ms[i] = elapsed_ms();
+			resource_loader.Push(loads[i]);
+		}
+
+		for (const auto& load : loads)
+		{
+			load->decoded.wait();
+		}
+		resource_loader.CleanUp();
+	};
+
+	auto top_priority_waits = [&priorities, max_priority](const std::vector<float>& waits, float* result)
+	{
+		size_t count = 0;
+		result[0] = 0.f;
+		result[1] = 0.f;
+		for (size_t i = 0; i < waits.size(); ++i)
+		{
+			if (priorities[i] >= 0.9f * max_priority)
+			{
+				result[0] += waits[i];
+				result[1] = waits[i] > result[1] ? waits[i] : result[1];
+				++count;
+			}
+		}
+		result[0] = count > 0 ? result[0] / count : 0.f;
+	};
+
+	std::vector<std::shared_ptr<AsyncLoad>> loads;
+	std::vector<float> waits;
+	simulate(false, loads, waits);
+	top_priority_waits(waits, resource_priority_benchmark_waits[0]);
+	simulate(true, loads, waits);
+	top_priority_waits(waits, resource_priority_benchmark_waits[1]);
+
+	// A load only starts before a higher priority one queued at the time if it was queued priority difference / aging seconds earlier
+	std::vector<size_t> started_loads(num_loads);
+	std::iota(started_loads.begin(), started_loads.end(), 0);
+	std::sort(started_loads.begin(), started_loads.end(), [&loads](size_t first, size_t second) { return loads[first]->started_order < loads[second]->started_order; });
+
+	resource_priority_benchmark_inversions = 0;
+	resource_priority_benchmark_unbounded_inversions = 0;
+	resource_priority_benchmark_max_inversion_ms = 0.f;
+	for (size_t i = 0; i < num_loads; ++i)
+	{
+		const AsyncLoad& waiting_load = *loads[started_loads[i]];
+		for (size_t j = i; j-- > 0 && loads[started_loads[j]]->started_order > waiting_load.queued_order;)
+		{
+			const AsyncLoad& started_load = *loads[started_loads[j]];
+			if (started_load.priority >= waiting_load.priority)
+			{
+				continue;
+			}
+
+			++resource_priority_benchmark_inversions;
+			float earlier_ms = static_cast<float>(1000.0 * (waiting_load.queued_time - started_load.queued_time));
+			float needed_ms = 1000.f * (waiting_load.priority - started_load.priority) / (aging > 0.f ? aging : 1.f);
+			if (aging == 0.f || earlier_ms < needed_ms - 0.01f)
+			{
+				++resource_priority_benchmark_unbounded_inversions;
+			}
+			resource_priority_benchmark_max_inversion_ms = max(resource_priority_benchmark_max_inversion_ms, earlier_ms);
+		}
+	}
+
+	APP_LOG_INFO("Resource priority benchmark. Top priority wait: FIFO %.3f ms (max %.3f ms) priority %.3f ms (max %.3f ms)", resource_priority_benchmark_waits[0][0], resource_priority_benchmark_waits[0][1], resource_priority_benchmark_waits[1][0], resource_priority_benchmark_waits[1][1]);
+	APP_LOG_INFO("Resource priority benchmark. Inversions: %zu, %zu unbounded, longest %.3f ms", resource_priority_benchmark_inversions, resource_priority_benchmark_unbounded_inversions, resource_priority_benchmark_max_inversion_ms);
+}
+
+// Uploads an RGB texture whose rows are not a multiple of 4 bytes one row per step, then reads it back and compares it with its pixels
+void ModuleDebug::RunTextureUploadCheck()
+{
+	const int width = 5;
+	const int height = 7;
+	std::vector<char> pixels(width * height * 3);
+	for (size_t i = 0; i < pixels.size(); ++i)
+	{
+		pixels[i] = static_cast<char>(i * 7 + 1);
+	}
+
+	TextureOptions texture_options;
+	texture_options.texture_type = TextureType::NORMAL;
+	texture_options.generate_mipmaps = false;
+	Texture texture(0, pixels.data(), pixels.size(), width, height, 3, texture_options, true);
+
+	size_t steps = 0;
+	size_t uploaded_bytes = 0;
+	while (!texture.LoadInMemoryStep(width * 3, uploaded_bytes))
+	{
+		++steps;
+	}
+	++steps;
+
+	std::vector<char> read_pixels(pixels.size());
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glBindTexture(GL_TEXTURE_2D, texture.opengl_texture);
+	glGetTexImage(GL_TEXTURE_2D, 0, GL_RGB, GL_UNSIGNED_BYTE, read_pixels.data());
+	glBindTexture(GL_TEXTURE_2D, 0);
+	--App->resources->loading_thread_communication.number_of_textures_loaded;
+
+	texture_upload_check_result = read_pixels == pixels ? 1 : 0;
+	APP_LOG_INFO("Texture upload check. %dx%d RGB in %zu steps: %s", width, height, steps, texture_upload_check_result == 1 ? "identical" : "different");
+}
+
+void ModuleDebug::CreateBenchmarkSceneConfig(size_t num_objects, Config& scene_config) const
+{
+	// Standalone game objects saved the way Scene::Save does, each one with a mesh renderer
+	std::vector<Config> game_objects_config(num_objects);
+	for (size_t i = 0; i < num_objects; ++i)
+	{
+		GameObject game_object("GameObject " + std::to_string(i));
+		game_object.tag = "Tag " + std::to_string(i % 100);
+		game_object.transform.SetTranslation(float3(static_cast<float>(i), 0.f, 0.f));
+		game_object.Save(game_objects_config[i]);
+
+		Config component_config;
+		component_config.AddUInt(i + 1, "UUID");
+		component_config.AddUInt(static_cast<uint64_t>(Component::ComponentType::MESH_RENDERER), "ComponentType");
+		component_config.AddBool(true, "Active");
+		component_config.AddUInt(i % 10 + 1, "Mesh");
+		component_config.AddUInt(i % 20 + 1, "Material");
+		component_config.AddUInt(0, "Skeleton");
+		component_config.AddInt(ComponentMeshRenderer::MeshProperties::RAYCASTABLE, "Properties");
+		std::vector<Config> components_config(1, component_config);
+		game_objects_config[i].AddChildrenConfig(components_config, "Components");
+	}
+	scene_config.AddChildrenConfig(game_objects_config, "GameObjects");
+}
@@ -5,6 +5,7 @@
 #include "Component/ComponentTrail.h"
 
 #include "Log/EngineLog.h"
+#include "Main/Application.h"
 #include "Main/GameObject.h"
 #include <Brofiler/Brofiler.h>
 
@@ -12,22 +13,46 @@
 bool ModuleEffects::Init()
 {
 	APP_LOG_SECTION("************ Module Effects Init ************");
+	if (App->IsHeadless())
+	{
+		return true;
+	}
+
 	quad = std::make_unique<Quad>();
 	quad->InitQuadBillboard();
 	return true;
 }
 
+ModuleDependencies ModuleEffects::GetDependencies() const
+{
+	ModuleDependencies dependencies;
+	dependencies.main_thread = false;
+	dependencies.writes = (int)ModuleData::PARTICLES;
+	return dependencies;
+}
+
 bool ModuleEffects::CleanUp()
 {
-	for (auto& particle : particle_systems)
+	std::vector<ComponentParticleSystem*> particle_systems_to_remove = particle_systems.GetComponents();
+	for (auto& particle : particle_systems_to_remove)
 	{
 		particle->owner->RemoveComponent(particle);
 	}
+	particle_systems.Clear();
 
-	for (auto& bilboard : billboards)
+	std::vector<ComponentBillboard*> billboards_to_remove = billboards.GetComponents();
+	for (auto& bilboard : billboards_to_remove)
 	{
 		bilboard->owner->RemoveComponent(bilboard);
 	}
+	billboards.Clear();
+
+	std::vector<ComponentTrail*> trails_to_remove = trails.GetComponents();
+	for (auto& trail : trails_to_remove)
+	{
+		trail->owner->RemoveComponent(trail);
+	}
+	trails.Clear();
 	return true;
 }
 
@@ -66,51 +91,30 @@ void ModuleEffects::Render()
 
 ComponentBillboard* ModuleEffects::CreateComponentBillboard()
 {
-	ComponentBillboard* created_billboard = new ComponentBillboard();
-	billboards.push_back(created_billboard);
-	return created_billboard;
+	return billboards.Create();
 }
 
 void ModuleEffects::RemoveComponentBillboard(ComponentBillboard* billboard_to_remove)
 {
-	auto it = std::find(billboards.begin(), billboards.end(), billboard_to_remove);
-	if (it != billboards.end())
-	{
-		delete *it;
-		billboards.erase(it);
-	}
+	billboards.Destroy(billboard_to_remove);
 }
 
 ComponentParticleSystem* ModuleEffects::CreateComponentParticleSystem()
 {
-	ComponentParticleSystem* created_particle_system = new ComponentParticleSystem();
-	particle_systems.push_back(created_particle_system);
-	return created_particle_system;
+	return particle_systems.Create();
 }
 
 void ModuleEffects::RemoveComponentParticleSystem(ComponentParticleSystem* particle_system_to_remove)
 {
-	auto it = std::find(particle_systems.begin(), particle_systems.end(), particle_system_to_remove);
-	if (it != particle_systems.end())
-	{
-		delete *it;
-		particle_systems.erase(it);
-	}
+	particle_systems.Destroy(particle_system_to_remove);
 }
 
 ComponentTrail* ModuleEffects::CreateComponentTrail(GameObject* owner)
 {
-	ComponentTrail* created_trail = new ComponentTrail(owner);
-	trails.push_back(created_trail);
-	return created_trail;
+	return trails.Create(owner);
 }
 
 void ModuleEffects::RemoveComponentTrail(ComponentTrail* trail_to_remove)
 {
-	auto it = std::find(trails.begin(), trails.end(), trail_to_remove);
-	if (it != trails.end())
-	{
-		delete *it;
-		trails.erase(it);
-	}
+	trails.Destroy(trail_to_remove);
 }
@@ -2,14 +2,15 @@
 #define _MODULEEFFECTS_H_
 
 #include "Module.h"
+#include "Component/ComponentBillboard.h"
+#include "Component/ComponentParticleSystem.h"
+#include "Component/ComponentTrail.h"
+#include "Helper/ComponentPool.h"
 
 #include <vector>
 #include <memory>
 #include "Helper/Quad.h"
 
-class ComponentBillboard;
-class ComponentParticleSystem;
-class ComponentTrail;
 class PanelConfiguration;
 
 class GameObject;
@@ -20,6 +21,7 @@ class ModuleEffects : public Module
 public:
 
 	bool Init() override;
+	ModuleDependencies GetDependencies() const override;
 
 	bool CleanUp() override;
 	void Render();
@@ -35,13 +37,13 @@ public:
 
 	std::unique_ptr<Quad> quad = nullptr;
 private:
-	std::vector<ComponentBillboard*> billboards;
+	ComponentPool<ComponentBillboard> billboards;
 	std::vector<ComponentBillboard*> billboards_to_render;
 
-	std::vector<ComponentParticleSystem*> particle_systems;
+	ComponentPool<ComponentParticleSystem> particle_systems;
 	std::vector<ComponentParticleSystem*> particle_systems_to_render;
 
-	std::vector<ComponentTrail*> trails;
+	ComponentPool<ComponentTrail> trails;
 	friend PanelConfiguration;
 };
 
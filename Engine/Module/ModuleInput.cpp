@@ -75,7 +75,7 @@ bool ModuleInput::Init()
 		mouse_bible[(MouseButton)i] = KeyState::IDLE;
 	}
 
-	SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER);
+	SDL_Init(App->IsHeadless() ? SDL_INIT_GAMECONTROLLER : SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER);
 
 	APP_LOG_INFO("SDL input event system initialized correctly.");
 
@@ -14,11 +14,13 @@
 #include "ModuleTime.h"
 #include "ModuleDebugDraw.h"
 #include "ModuleResourceManager.h"
+#include "ModuleScene.h"
 #include "Event/EventManager.h"
 
 #include <GL/glew.h>
 
 #include <Brofiler/Brofiler.h>
+#include <unordered_set>
 
 ModulePhysics::ModulePhysics()
 {
@@ -42,12 +44,25 @@ bool ModulePhysics::Init()
 	return true;
 }
 
+ModuleDependencies ModulePhysics::GetDependencies() const
+{
+	ModuleDependencies dependencies;
+	dependencies.main_thread = false;
+	dependencies.writes = (int)ModuleData::PHYSICS_WORLD | (int)ModuleData::TRANSFORMS;
+	return dependencies;
+}
 
 update_status ModulePhysics::Update()
 {
 
 	BROFILER_CATEGORY("Module Physics Update", Profiler::Color::PaleTurquoise);
 	ms = physics_timer->Read();
+
+	// Bodies of a scene that is still loading are not simulated until the whole scene is activated
+	if (App->scene->IsLoadingScene())
+	{
+		return update_status::UPDATE_CONTINUE;
+	}
 		
 	//update the world
 	world->stepSimulation(App->time->delta_time, 2);
@@ -112,7 +127,12 @@ update_status ModulePhysics::Update()
 
 void ModulePhysics::UpdateAllDimensions()
 {
-	for (auto collider : colliders)
+	UpdateColliderDimensions(colliders);
+}
+
+void ModulePhysics::UpdateColliderDimensions(const std::vector<ComponentCollider*>& colliders_to_update)
+{
+	for (auto collider : colliders_to_update)
 	{
 		collider->UpdateDimensions();
 		
@@ -173,6 +193,27 @@ void ModulePhysics::RemoveComponentCollider(ComponentCollider* collider_to_remov
 	}
 }
 
+void ModulePhysics::RemoveComponentColliders(const std::vector<ComponentCollider*>& colliders_to_remove)
+{
+	BROFILER_CATEGORY("Remove Colliders", Profiler::Color::Green);
+	std::unordered_set<const ComponentCollider*> removed_colliders;
+	for (const auto& collider : colliders_to_remove)
+	{
+		world->removeRigidBody(collider->body);
+		removed_colliders.insert(collider);
+	}
+
+	colliders.erase(std::remove_if(colliders.begin(), colliders.end(), [&removed_colliders](ComponentCollider* collider)
+	{
+		if (removed_colliders.find(collider) == removed_colliders.end())
+		{
+			return false;
+		}
+		delete collider;
+		return true;
+	}), colliders.end());
+}
+
 void DebugDrawer::drawLine(const btVector3& from, const btVector3& to, const btVector3& color)
 {
 	
@@ -41,6 +41,7 @@ public:
 	~ModulePhysics() = default;
 
 	bool Init() override;
+	ModuleDependencies GetDependencies() const override;
 	update_status Update() override;
 
 	void SetGravity(float3& newGgravity);
@@ -48,8 +49,10 @@ public:
 
 	ComponentCollider* CreateComponentCollider(const ComponentCollider::ColliderType collider_type, GameObject* owner);
 	void RemoveComponentCollider(ComponentCollider* collider_to_remove);
+	void RemoveComponentColliders(const std::vector<ComponentCollider*>& colliders_to_remove);
 	ComponentCollider* FindColliderByWorldId(int id);
 	void UpdateAllDimensions();
+	void UpdateColliderDimensions(const std::vector<ComponentCollider*>& colliders_to_update);
 
 public:
 
@@ -14,6 +14,12 @@
 bool ModuleProgram::Init()
 {
 	APP_LOG_SECTION("************ Module Program Init ************");
+	if (App->IsHeadless())
+	{
+		APP_LOG_INFO("Running without GL context. Shaders won't be compiled.");
+		return true;
+	}
+
 	LoadPrograms(SHADERS_PATH);
 	return true;
 }
@@ -21,6 +27,11 @@ bool ModuleProgram::Init()
 // Called before quitting
 bool ModuleProgram::CleanUp()
 {
+	if (App->IsHeadless())
+	{
+		return true;
+	}
+
 	for (const auto& program : loaded_programs)
 	{
 		for (const auto& program_variation : program.second.compiled_variations)
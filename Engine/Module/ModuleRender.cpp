@@ -148,10 +148,12 @@ update_status ModuleRender::PreUpdate()
 bool ModuleRender::CleanUp()
 {
 	APP_LOG_INFO("Destroying renderer");
-	for (auto& mesh : mesh_renderers)
+	std::vector<ComponentMeshRenderer*> mesh_renderers_to_remove = mesh_renderers.GetComponents();
+	for (auto& mesh : mesh_renderers_to_remove)
 	{
 		mesh->owner->RemoveComponent(mesh);
 	}
+	mesh_renderers.Clear();
 
 	delete scene_viewport;
 	delete game_viewport;
@@ -302,18 +304,19 @@ std::string ModuleRender::GetDrawMode() const
 
 ComponentMeshRenderer* ModuleRender::CreateComponentMeshRenderer()
 {
-	ComponentMeshRenderer* created_mesh = new ComponentMeshRenderer();
-	mesh_renderers.push_back(created_mesh);
-	return created_mesh;
+	return mesh_renderers.Create();
 }
 
 void ModuleRender::RemoveComponentMesh(ComponentMeshRenderer* mesh_to_remove)
 {
-	const auto it = std::find(mesh_renderers.begin(), mesh_renderers.end(), mesh_to_remove);
-	if (it != mesh_renderers.end())
+	mesh_renderers.Destroy(mesh_to_remove);
+}
+
+void ModuleRender::RemoveComponentMeshes(const std::vector<ComponentMeshRenderer*>& meshes_to_remove)
+{
+	for (const auto& mesh_to_remove : meshes_to_remove)
 	{
-		delete *it;
-		mesh_renderers.erase(it);
+		mesh_renderers.Destroy(mesh_to_remove);
 	}
 }
 
@@ -325,7 +328,7 @@ RaycastHit* ModuleRender::GetRaycastIntersection(const LineSegment& ray, const C
 	}
 
 	BROFILER_CATEGORY("Do Raycast", Profiler::Color::HotPink);
-	std::vector<ComponentMeshRenderer*> culled_mesh_renderers = App->space_partitioning->GetCullingMeshes(camera, mesh_renderers);
+	std::vector<ComponentMeshRenderer*> culled_mesh_renderers = App->space_partitioning->GetCullingMeshes(camera, mesh_renderers.GetComponents());
 	std::vector<ComponentMeshRenderer*> intersected_meshes;
 	for (const auto& mesh_renderer : culled_mesh_renderers)
 	{
@@ -6,6 +6,8 @@
 #endif
 
 #include "Module.h"
+#include "Component/ComponentMeshRenderer.h"
+#include "Helper/ComponentPool.h"
 #include "Helper/Timer.h"
 #include "Main/Globals.h"
 
@@ -14,7 +16,6 @@
 #include <list>
 #include <vector>
 
-class ComponentMeshRenderer;
 class ComponentCamera;
 
 class GameObject;
@@ -56,10 +57,11 @@ public:
 	update_status PreUpdate();
 	bool CleanUp();
 	
-	void Render() const;
+	virtual void Render() const;
 
 	ComponentMeshRenderer* CreateComponentMeshRenderer();
 	void RemoveComponentMesh(ComponentMeshRenderer* mesh_to_remove);
+	void RemoveComponentMeshes(const std::vector<ComponentMeshRenderer*>& meshes_to_remove);
 
 	ENGINE_API int GetRenderedTris() const;
 	ENGINE_API int GetRenderedVerts() const;
@@ -110,7 +112,7 @@ public:
 	Viewport* scene_viewport = nullptr;
 	Viewport* game_viewport = nullptr;
 
-	std::vector<ComponentMeshRenderer*> mesh_renderers;
+	ComponentPool<ComponentMeshRenderer> mesh_renderers;
 
 private:
 	void* context = nullptr;
@@ -7,6 +7,7 @@
 #include "Helper/Timer.h"
 
 #include "Main/GameObject.h"
+#include "Module/ModuleCamera.h"
 #include "Module/ModuleScene.h"
 
 #include "ResourceManagement/Importer/Importer.h"
@@ -16,6 +17,7 @@
 #include "ResourceManagement/Importer/ModelImporters/MeshImporter.h"
 #include "ResourceManagement/Importer/ModelImporters/SkeletonImporter.h"
 #include "ResourceManagement/Importer/PrefabImporter.h"
+#include "ResourceManagement/Importer/SceneImporter.h"
 #include "ResourceManagement/Importer/StateMachineImporter.h"
 #include "ResourceManagement/Importer/SoundImporter.h"
 #include "ResourceManagement/Importer/TextureImporter.h"
@@ -33,7 +35,10 @@
 
 #include <algorithm>
 #include <Brofiler/Brofiler.h>
+#include <chrono>
 #include <functional> //for std::hash
+#include <limits>
+#include <unordered_set>
 
 
 ModuleResourceManager::ModuleResourceManager()
@@ -51,6 +56,7 @@ bool ModuleResourceManager::Init()
 	mesh_importer = std::make_unique<MeshImporter>();
 	model_importer = std::make_unique<ModelImporter>();
 	prefab_importer = std::make_unique<PrefabImporter>();
+	scene_importer = std::make_unique<SceneImporter>();
 	skeleton_importer = std::make_unique<SkeletonImporter>();
 	state_machine_importer = std::make_unique<StateMachineImporter>();
 	sound_importer = std::make_unique<SoundImporter>();
@@ -68,10 +74,7 @@ bool ModuleResourceManager::Init()
 #endif
 
 #if MULTITHREADING
-	for(size_t i = 0; i < loading_thread_communication.max_threads; ++i)
-	{
-		loading_thread_communication.loader_threads.push_back(std::thread(&ModuleResourceManager::LoaderThread, this));
-	}
+	resource_loader.Init(num_loader_threads);
 #endif
 
 	thread_timer->Start();
@@ -89,16 +92,11 @@ update_status ModuleResourceManager::PreUpdate()
 		//importing_thread = std::thread(&ModuleResourceManager::StartThread, this);
 	}
 #endif
-	float t = thread_timer->Read();
-	if(cache_time > 0.0f && (thread_timer->Read() - cache_time) >= cache_interval_millis)
+	// Resources are destroyed here because they can own GPU objects, loads from other threads only add to the cache
+	if (!loading_thread_communication.loading && resource_cache.IsOverBudget())
 	{
-		cache_time = thread_timer->Read();
-		if(!loading_thread_communication.loading)
-		{
-
-			APP_LOG_INFO("Refresh resources");
-			RefreshResourceCache();
-		}
+		BROFILER_CATEGORY("Trim Resource Cache", Profiler::Color::Brown);
+		resource_cache.Trim();
 	}
 
 
@@ -111,26 +109,9 @@ update_status ModuleResourceManager::PreUpdate()
 		loading_thread_communication.restore_time_scale = false;
 	}
 
-	if(!processing_resources_queue.Empty())
-	{
-		LoadingJob load_job;
-		if(processing_resources_queue.TryPop(load_job))
-		{
-			//Generate OpenGL texture
-			if (load_job.component_to_load->type == Component::ComponentType::MESH_RENDERER)
-			{
-				load_job.component_to_load->InitResource(load_job.uuid, load_job.resource_type, load_job.texture_type);
-			}
-			else
-			{
-				load_job.component_to_load->InitResource(load_job.uuid, load_job.resource_type);
-			}
+	FinishDecodedLoads();
 
-			++loading_thread_communication.current_number_of_resources_loaded;
-		}
-	}
-
-	if(loading_thread_communication.loading && 
+	if(loading_thread_communication.loading && !App->scene->IsLoadingScene() &&
 		loading_thread_communication.current_number_of_resources_loaded == loading_thread_communication.total_number_of_resources_to_load)
 	{
 		for(const auto prefab : prefabs_to_reassign)
@@ -164,15 +145,14 @@ bool ModuleResourceManager::CleanUp()
 	 thread_comunication.stop_thread = true;
 	 importing_thread.join();
 #endif
-	 CleanResourceCache();
-
-#if MULTITHREADING
-	 loading_thread_communication.loading_threads_active = false;
-	 for(size_t i = 0; i < loading_thread_communication.max_threads; ++i)
+	 resource_loader.CleanUp();
+	 finishing_load = nullptr;
 	 {
-		 loading_thread_communication.loader_threads[i].join();
+		 std::lock_guard<std::mutex> lock(async_loads_mutex);
+		 async_loads.clear();
 	 }
-#endif
+	 CleanResourceCache();
+	 ClearPrefetchedFileData();
 
 	return true;
 }
@@ -188,7 +168,6 @@ bool ModuleResourceManager::CleanUp()
 
 	 thread_comunication.finished_loading = true;
 	 last_imported_time = thread_timer->Read();
-	 cache_time = thread_timer->Read();
 	 first_import_completed = true;
  }
 
@@ -319,7 +298,7 @@ uint32_t ModuleResourceManager::InternalImport(Path& file_path, bool force) cons
 			break;
 		
 		case FileType::SCENE:
-			asset_metafile = generic_importer->GenericImport(file_path, ResourceType::SCENE);
+			asset_metafile = scene_importer->Import(file_path);
 			break;
 
 		case FileType::SKELETON:
@@ -368,62 +347,335 @@ uint32_t ModuleResourceManager::CreateFromData(FileData data, const std::string&
 	return InternalImport(*created_asset_file_path);
 }
 
-void ModuleResourceManager::LoaderThread()
+bool ModuleResourceManager::LoadsAsynchronously() const
+{
+	return MULTITHREADING && !App->IsHeadless() && App->time->isGameRunning() && loading_thread_communication.load_scene_asyncronously;
+}
+
+// While components load asynchronously, a material streams its textures in instead of blocking on them
+bool ModuleResourceManager::UsesLoadGraph() const
+{
+	return resource_loader.GetNumThreads() > 0 && !LoadsAsynchronously();
+}
+
+std::shared_ptr<Resource> ModuleResourceManager::LoadGraph(uint32_t uuid)
+{
+	BROFILER_CATEGORY("Load Resource Graph", Profiler::Color::Brown);
+	ResourceLoadGraph load_graph;
+	std::shared_ptr<Resource> loaded_resource = load_graph.Load(uuid);
+	load_graph_stats = load_graph.GetStats();
+	return loaded_resource;
+}
+
+std::shared_ptr<AsyncLoad> ModuleResourceManager::StartAsyncLoad(uint32_t uuid, float priority, DecodeFunction decode)
+{
+	std::shared_ptr<AsyncLoad> load;
+	{
+		std::lock_guard<std::mutex> lock(async_loads_mutex);
+		auto async_load = async_loads.find(uuid);
+		if (async_load != async_loads.end())
+		{
+			resource_loader.RaisePriority(async_load->second, priority);
+			return async_load->second;
+		}
+
+		load = std::make_shared<AsyncLoad>();
+		load->uuid = uuid;
+		load->type = GetResourceType(uuid);
+		load->priority = priority;
+		std::shared_ptr<Resource> cached_resource = RetrieveFromCacheIfExist(uuid);
+		if (cached_resource != nullptr)
+		{
+			load->promise.set_value(cached_resource);
+			load->resource = cached_resource;
+			load->finished = true;
+			return load;
+		}
+		async_loads.emplace(uuid, load);
+	}
+
+	load->load_function = [this, uuid, decode](size_t& file_size) -> std::shared_ptr<Resource>
+	{
+		FileData file_data;
+		if (!RetrieveFileDataByUUID(uuid, file_data))
+		{
+			return nullptr;
+		}
+
+		file_size = file_data.size;
+		std::shared_ptr<Resource> resource = decode(uuid, file_data);
+		delete[] file_data.buffer;
+		return resource;
+	};
+
+	++loading_thread_communication.total_number_of_resources_to_load;
+	if (resource_loader.GetNumThreads() == 0)
+	{
+		size_t file_size = 0;
+		load->promise.set_value(load->load_function(file_size));
+		load->file_size = file_size;
+		load->load_function = nullptr;
+		FinishAsyncLoad(*load);
+	}
+	else
+	{
+		resource_loader.Push(load);
+	}
+	return load;
+}
+
+void ModuleResourceManager::FinishAsyncLoad(AsyncLoad& load)
+{
+	size_t uploaded_bytes = 0;
+	FinishAsyncLoadStep(load, std::numeric_limits<size_t>::max(), uploaded_bytes);
+}
+
+// The resource is cached before its upload, so loads of the same resource meanwhile find it instead of decoding it again
+bool ModuleResourceManager::FinishAsyncLoadStep(AsyncLoad& load, size_t max_upload_bytes, size_t& uploaded_bytes)
+{
+	uploaded_bytes = 0;
+	if (load.finished)
+	{
+		return true;
+	}
+
+	BROFILER_CATEGORY("Finish Async Load", Profiler::Color::Brown);
+	if (load.resource == nullptr)
+	{
+		load.resource = AddToCache(load.decoded.get(), load.file_size);
+	}
+
+	std::shared_ptr<Resource> resource = load.resource;
+	if (resource != nullptr && !resource->initialized && !App->IsHeadless() && !resource->LoadInMemoryStep(max_upload_bytes, uploaded_bytes))
+	{
+		return false;
+	}
+
+	std::vector<std::pair<const void*, AsyncLoad::Callback>> callbacks;
+	{
+		std::lock_guard<std::mutex> lock(load.callbacks_mutex);
+		load.finished = true;
+		callbacks.swap(load.callbacks);
+		load.num_requesters -= callbacks.size();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(async_loads_mutex);
+		auto async_load = async_loads.find(load.uuid);
+		if (async_load != async_loads.end() && async_load->second.get() == &load)
+		{
+			async_loads.erase(async_load);
+		}
+	}
+	++loading_thread_communication.current_number_of_resources_loaded;
+
+	if (resource == nullptr)
+	{
+		RESOURCES_LOG_ERROR("Error loading Resource %u asynchronously.", load.uuid);
+		return true;
+	}
+
+	for (const auto& callback : callbacks)
+	{
+		callback.second(resource);
+	}
+	return true;
+}
+
+// Finishes decoded loads until the frame budget is spent, uploads that do not fit are split across frames.
+// At least one step is made every frame, so the backlog drains even when the estimates exceed the budget.
+void ModuleResourceManager::FinishDecodedLoads()
+{
+	BROFILER_CATEGORY("Finish Decoded Loads", Profiler::Color::Brown);
+	auto start = std::chrono::high_resolution_clock::now();
+	auto elapsed_ms = [start]()
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	};
+
+	const size_t min_upload_bytes = 64 * 1024;
+	const float megabyte = 1024.f * 1024.f;
+	const float cost_smoothing = 0.2f;
+
+	finish_stats.loads = 0;
+	finish_stats.uploaded_bytes = 0;
+	size_t steps = 0;
+	while (finishing_load != nullptr || resource_loader.TryPopDecoded(finishing_load))
+	{
+		// Loads waited for meanwhile are finished already
+		if (finishing_load->finished)
+		{
+			finishing_load = nullptr;
+			finishing_load_steps = 0;
+			continue;
+		}
+
+		FinishCost& cost = finish_costs[finishing_load->type];
+		float remaining_ms = finish_budget_ms - elapsed_ms();
+		if (steps > 0 && remaining_ms < cost.ms_per_load)
+		{
+			break;
+		}
+
+		float upload_ms = remaining_ms - cost.ms_per_load;
+		size_t max_upload_bytes = upload_ms > 0.f ? static_cast<size_t>(upload_ms / cost.ms_per_megabyte * megabyte) : 0;
+		max_upload_bytes = max_upload_bytes > min_upload_bytes ? max_upload_bytes : min_upload_bytes;
+
+		float step_start_ms = elapsed_ms();
+		size_t uploaded_bytes = 0;
+		bool finished = FinishAsyncLoadStep(*finishing_load, max_upload_bytes, uploaded_bytes);
+		float step_ms = elapsed_ms() - step_start_ms;
+		float uploaded_megabytes = uploaded_bytes / megabyte;
+		++steps;
+		++finishing_load_steps;
+		finish_stats.uploaded_bytes += uploaded_bytes;
+
+		// Steps that leave the upload unfinished are all upload, the step that finishes the load also pays its fixed cost
+		if (!finished)
+		{
+			if (uploaded_bytes > 0)
+			{
+				float ms_per_megabyte = step_ms / uploaded_megabytes;
+				cost.ms_per_megabyte += (ms_per_megabyte - cost.ms_per_megabyte) * cost_smoothing;
+				cost.ms_per_megabyte = cost.ms_per_megabyte > 0.001f ? cost.ms_per_megabyte : 0.001f;
+			}
+			continue;
+		}
+
+		float ms_per_load = step_ms - uploaded_megabytes * cost.ms_per_megabyte;
+		cost.ms_per_load += ((ms_per_load > 0.f ? ms_per_load : 0.f) - cost.ms_per_load) * cost_smoothing;
+
+		++finish_stats.loads;
+		++finish_stats.total_loads;
+		finish_stats.split_loads += finishing_load_steps > 1 ? 1 : 0;
+		finishing_load = nullptr;
+		finishing_load_steps = 0;
+	}
+
+	finish_stats.backlog = resource_loader.GetNumDecoded() + (finishing_load != nullptr ? 1 : 0);
+	finish_stats.time_ms = elapsed_ms();
+	finish_stats.max_time_ms = finish_stats.time_ms > finish_stats.max_time_ms ? finish_stats.time_ms : finish_stats.max_time_ms;
+}
+
+void ModuleResourceManager::CancelAsyncLoads(const void* requester)
+{
+	CancelAsyncLoads(std::vector<const void*>{ requester });
+}
+
+// Cancelled loads finish without resource, requesters waiting for them get nullptr
+void ModuleResourceManager::CancelAsyncLoads(const std::vector<const void*>& requesters)
 {
-	while(loading_thread_communication.loading_threads_active)
+	if (requesters.empty())
 	{
-		if(!loading_resources_queue.Empty())
+		return;
+	}
+
+	std::vector<const void*> sorted_requesters(requesters);
+	std::sort(sorted_requesters.begin(), sorted_requesters.end());
+
+	std::vector<std::shared_ptr<AsyncLoad>> cancelled_loads;
+	{
+		std::lock_guard<std::mutex> lock(async_loads_mutex);
+		for (auto async_load = async_loads.begin(); async_load != async_loads.end();)
 		{
-			LoadingJob load_job;
-			if(loading_resources_queue.TryPop(load_job))
+			AsyncLoad& load = *async_load->second;
+			bool unrequested = false;
 			{
-				//Check if resource is already on cache
-				if(load_job.component_to_load->type == Component::ComponentType::MESH_RENDERER)
-				{
-					load_job.component_to_load->LoadResource(load_job.uuid, load_job.resource_type, load_job.texture_type);
-				}
-				else
+				std::lock_guard<std::mutex> callbacks_lock(load.callbacks_mutex);
+				size_t num_callbacks = load.callbacks.size();
+				load.callbacks.erase(std::remove_if(load.callbacks.begin(), load.callbacks.end(), [&sorted_requesters](const std::pair<const void*, AsyncLoad::Callback>& callback)
 				{
-					load_job.component_to_load->LoadResource(load_job.uuid, load_job.resource_type);
-				}
-				
-				processing_resources_queue.Push(load_job);
-			}
+					return std::binary_search(sorted_requesters.begin(), sorted_requesters.end(), callback.first);
+				}), load.callbacks.end());
 
-			unsigned int work_load_size_remaining = loading_resources_queue.Size();
+				// Handles still held, by pollers or a load graph, keep the load going
+				size_t num_removed_callbacks = num_callbacks - load.callbacks.size();
+				load.num_requesters -= num_removed_callbacks;
+				unrequested = num_removed_callbacks > 0 && load.num_requesters == 0;
+			}
 
-			const int ms_to_wait = work_load_size_remaining > 0 ? 10 : 2000;
-			std::this_thread::sleep_for(std::chrono::milliseconds(ms_to_wait));
+			if (unrequested && resource_loader.Cancel(async_load->second))
+			{
+				cancelled_loads.push_back(std::move(async_load->second));
+				async_load = async_loads.erase(async_load);
+			}
+			else
+			{
+				++async_load;
+			}
 		}
+	}
 
-		if(loading_resources_queue.Empty())
+	for (const auto& cancelled_load : cancelled_loads)
+	{
+		cancelled_load->promise.set_value(nullptr);
 		{
-			int hola = 0;
+			std::lock_guard<std::mutex> callbacks_lock(cancelled_load->callbacks_mutex);
+			cancelled_load->finished = true;
 		}
+		++loading_thread_communication.current_number_of_resources_loaded;
+		++cancelled_async_loads;
 	}
 }
 
+size_t ModuleResourceManager::GetNumAsyncLoads() const
+{
+	std::lock_guard<std::mutex> lock(async_loads_mutex);
+	return async_loads.size();
+}
+
+float ModuleResourceManager::GetStreamingPriority(const float3& position, float radius) const
+{
+	const ComponentCamera* camera = App->cameras->main_camera != nullptr ? App->cameras->main_camera : App->cameras->scene_camera;
+	if (camera == nullptr)
+	{
+		return 0.f;
+	}
+
+	float distance = camera->camera_frustum.pos.Distance(position);
+	return streaming_priority_scale * radius / (distance > radius ? distance : radius);
+}
 
 std::shared_ptr<Resource> ModuleResourceManager::RetrieveFromCacheIfExist(uint32_t uuid) const
 {
 	//Check if the resource is already loaded
-	auto& it = std::find_if(resource_cache.begin(), resource_cache.end(), [&uuid](const std::shared_ptr<Resource> & resource)
+	std::shared_ptr<Resource> cached_resource = resource_cache.Get(uuid);
+	if (cached_resource != nullptr)
 	{
-		return resource->GetUUID() == uuid;
-	});
+		RESOURCES_LOG_INFO("Resource %u exists in cache.", uuid);
+	}
+	return cached_resource;
+}
 
-	if (it != resource_cache.end())
+bool ModuleResourceManager::IsCached(uint32_t uuid) const
+{
+	return resource_cache.Contains(uuid);
+}
+
+std::shared_ptr<Resource> ModuleResourceManager::AddToCache(const std::shared_ptr<Resource>& resource, size_t file_size) const
+{
+	if (resource == nullptr)
 	{
-		RESOURCES_LOG_INFO("Resource %u exists in cache.", uuid);
-		return *it;
+		return nullptr;
 	}
 
+	size_t memory_size = resource->GetMemorySize();
+	return resource_cache.Add(resource, GetResourceType(resource->GetUUID()), memory_size > 0 ? memory_size : file_size);
+}
 
-	return nullptr;
+ResourceType ModuleResourceManager::GetResourceType(uint32_t uuid) const
+{
+	const Metafile* resource_metafile = resource_DB->GetEntry(uuid);
+	return resource_metafile != nullptr ? resource_metafile->resource_type : ResourceType::UNKNOWN;
 }
 
 bool ModuleResourceManager::RetrieveFileDataByUUID(uint32_t uuid, FileData& filedata) const
 {
+	if (TakePrefetchedFileData(uuid, filedata))
+	{
+		return true;
+	}
+
 	std::string resource_library_file = MetafileManager::GetUUIDExportedFile(uuid);
 	if (!App->filesystem->Exists(resource_library_file))
 	{
@@ -437,37 +689,93 @@ bool ModuleResourceManager::RetrieveFileDataByUUID(uint32_t uuid, FileData& file
 	return true;
 }
 
-void ModuleResourceManager::RefreshResourceCache()
+void ModuleResourceManager::GatherDependencies(std::vector<uint32_t>& resources) const
 {
-	//Erase Resource Cache
-	resource_cache.erase(std::remove_if(resource_cache.begin(), resource_cache.end(), [](const std::shared_ptr<Resource> & resource) {
-		return resource.use_count() == 1;
-	}), resource_cache.end());
+	std::vector<uint32_t> pending_resources(std::move(resources));
+	std::unordered_set<uint32_t> visited_resources;
+	resources.clear();
+	while (!pending_resources.empty())
+	{
+		uint32_t resource_uuid = pending_resources.back();
+		pending_resources.pop_back();
+		if (!visited_resources.insert(resource_uuid).second || resource_DB->GetEntry(resource_uuid) == nullptr)
+		{
+			continue;
+		}
+		resources.push_back(resource_uuid);
+
+		// Resources that are not loaded are not expanded, everything a saved scene uses is loaded already
+		std::shared_ptr<Resource> cached_resource = resource_cache.Find(resource_uuid);
+		if (cached_resource != nullptr)
+		{
+			cached_resource->GetDependencies(pending_resources);
+		}
+	}
 }
-void ModuleResourceManager::AddResourceToCache(std::shared_ptr<Resource> resource)
+
+void ModuleResourceManager::PrefetchFileData(uint32_t uuid)
 {
-	if (resource != nullptr)
+	std::string resource_library_file = MetafileManager::GetUUIDExportedFile(uuid);
+	if (!App->filesystem->Exists(resource_library_file))
 	{
-		resource_cache.push_back(resource);
+		return;
 	}
+
+	Path* resource_exported_file_path = App->filesystem->GetPath(resource_library_file);
+	FileData file_data = resource_exported_file_path->GetFile()->Load();
+	if (file_data.buffer == nullptr)
+	{
+		return;
+	}
+	StorePrefetchedFileData(uuid, file_data);
 }
-void ModuleResourceManager::CleanResourceCache()
+
+// Takes ownership of the buffer, which is deleted if the file was prefetched already
+void ModuleResourceManager::StorePrefetchedFileData(uint32_t uuid, const FileData& file_data) const
 {
-	resource_cache.clear();
+	std::lock_guard<std::mutex> lock(prefetched_file_data_mutex);
+	auto inserted = prefetched_file_data.emplace(uuid, file_data);
+	if (!inserted.second)
+	{
+		delete[] file_data.buffer;
+	}
 }
 
-bool ModuleResourceManager::CleanResourceFromCache(uint32_t uuid)
+void ModuleResourceManager::ClearPrefetchedFileData()
 {
-	bool found = false;
-	const auto it = std::remove_if(resource_cache.begin(), resource_cache.end(), [uuid](const std::shared_ptr<Resource> & resource) {
-		return resource->GetUUID() == uuid;
-	});
-	if (it != resource_cache.end())
+	std::lock_guard<std::mutex> lock(prefetched_file_data_mutex);
+	for (auto& prefetched_file : prefetched_file_data)
 	{
-		found = true;
-		resource_cache.erase(it, resource_cache.end());
+		delete[] prefetched_file.second.buffer;
 	}
+	prefetched_file_data.clear();
+}
+
+bool ModuleResourceManager::TakePrefetchedFileData(uint32_t uuid, FileData& file_data) const
+{
+	std::lock_guard<std::mutex> lock(prefetched_file_data_mutex);
+	auto prefetched_file = prefetched_file_data.find(uuid);
+	if (prefetched_file == prefetched_file_data.end())
+	{
+		return false;
+	}
+
+	file_data = prefetched_file->second;
+	prefetched_file_data.erase(prefetched_file);
+	return true;
+}
 
+void ModuleResourceManager::AddResourceToCache(std::shared_ptr<Resource> resource)
+{
+	AddToCache(resource, 0);
+}
 
-	return found;
+void ModuleResourceManager::CleanResourceCache()
+{
+	resource_cache.Clear();
+}
+
+bool ModuleResourceManager::CleanResourceFromCache(uint32_t uuid)
+{
+	return resource_cache.Remove(uuid);
 }
@@ -23,14 +23,20 @@
 #include "ResourceManagement/Resources/Video.h"
 
 #include "ResourceManagement/Metafile/MetafileManager.h"
+#include "ResourceManagement/ResourcesDB/ResourceCache.h"
 #include "ResourceManagement/ResourcesDB/ResourceDataBase.h"
+#include "ResourceManagement/ResourcesDB/ResourceLoader.h"
+#include "ResourceManagement/ResourcesDB/ResourceLoadGraph.h"
 
 #include <atomic>
 #include <Brofiler/Brofiler.h>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <type_traits>
+#include <unordered_map>
 
 #define MULTITHREADING 1
 
@@ -43,6 +49,7 @@ class MaterialImporter;
 class MeshImporter;
 class ModelImporter;
 class PrefabImporter;
+class SceneImporter;
 class SkeletonImporter;
 class StateMachineImporter;
 class SoundImporter;
@@ -50,18 +57,6 @@ class TextureImporter;
 
 class SceneManager;
 
-struct LoadingJob
-{
-	uint32_t uuid = 0;
-	bool already_in_cache = false;
-	Component* component_to_load = nullptr;
-
-	//For material type enum
-	ResourceType resource_type = ResourceType::TEXTURE;
-	unsigned texture_type = 0;
-};
-
-
 class ModuleResourceManager : public Module
 {
 public:
@@ -97,6 +92,7 @@ public:
 		FileData resource_data = ResourceManagement::Binarize<T>(modified_resource.get());
 		std::string modified_resource_path = resource_DB->GetEntry(modified_resource->GetUUID())->imported_file_path;
 		Path* saved_resource_assets_path = App->filesystem->Save(modified_resource_path, resource_data);
+		delete[] resource_data.buffer;
 
 		InternalImport(*saved_resource_assets_path);
 
@@ -117,48 +113,46 @@ public:
 			return std::static_pointer_cast<T>(loaded_resource);
 		}
 
-		//HERE WE CHECK IF T IS TEXTURE AND IF SO WE ADD FILEDATA TO THE QUEUE
-		//WE NEED TO CHECK HOW I AM GONNA SOLVE THE LOADED_RESOURCE NULLPTR WHILE NOT BEING CREATED
-		
-		if(MULTITHREADING && App->time->isGameRunning() && (std::is_same<T, Texture>::value || std::is_same<T, Mesh>::value || std::is_same<T, Font>::value) && !loading_thread_communication.normal_loading_flag && loading_thread_communication.load_scene_asyncronously)
+		// Resources that depend on others load them as a graph, decoding the independent ones at the same time
+		if ((std::is_same<T, Material>::value || std::is_same<T, Prefab>::value) && UsesLoadGraph())
 		{
-			loaded_resource = nullptr;
+			return std::static_pointer_cast<T>(LoadGraph(uuid));
+		}
+		return LoadFile<T>(uuid);
+	}
 
-			LoadingJob load_job;
+	// Requests for a resource that is already being loaded share its load, with the highest priority requested. Safe to call from any thread
+	template<typename T>
+	ResourceHandle<T> LoadAsync(uint32_t uuid, float priority = 0.f)
+	{
+		static_assert(std::is_same<T, Texture>::value || std::is_same<T, Mesh>::value || std::is_same<T, Video>::value, "Only resources that defer their GPU upload to LoadInMemory can be loaded asynchronously.");
 
-			load_job.component_to_load = loading_thread_communication.current_component_loading;
-			load_job.uuid = uuid;
-			load_job.resource_type = loading_thread_communication.current_type;
-			load_job.texture_type = loading_thread_communication.texture_type;
-			loading_resources_queue.Push(load_job);
-			++loading_thread_communication.total_number_of_resources_to_load;
-		}
-		else
+		return ResourceHandle<T>(StartAsyncLoad(uuid, priority, [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource>
 		{
-			std::string resource_library_file = MetafileManager::GetUUIDExportedFile(uuid);
-			if (!App->filesystem->Exists(resource_library_file))
-			{
-				RESOURCES_LOG_ERROR("Error loading Resource %u. File %s doesn't exist", uuid, resource_library_file.c_str());
-				return nullptr;
-			}
+			return ResourceManagement::Load<T>(uuid, file_data, true);
+		}));
+	}
 
-			Path* resource_exported_file_path = App->filesystem->GetPath(resource_library_file);
-			FileData exported_file_data = resource_exported_file_path->GetFile()->Load();
+	// Main thread only, blocks until the resource and everything it depends on are loaded
+	std::shared_ptr<Resource> LoadGraph(uint32_t uuid);
 
-			loaded_resource = ResourceManagement::Load<T>(uuid, exported_file_data);
-			//IMPORTANT IF TEXTURE THIS MUST BE DELETED
-			delete[] exported_file_data.buffer;
-		}
-		
+	// Whether components load their resources asynchronously right now, that is while a scene loads in game
+	bool LoadsAsynchronously() const;
 
-		if (loaded_resource != nullptr)
-		{
-			resource_cache.push_back(loaded_resource);
-		}
+	// Main thread only, caches the decoded resource, uploads it and runs the callbacks of the load
+	void FinishAsyncLoad(AsyncLoad& load);
+	// Same, uploading about max_upload_bytes at most. Returns whether the load is finished
+	bool FinishAsyncLoadStep(AsyncLoad& load, size_t max_upload_bytes, size_t& uploaded_bytes);
 
-		RESOURCES_LOG_INFO("Resource %u loaded correctly.", uuid);
-		return std::static_pointer_cast<T>(loaded_resource);
-	}
+	// The callbacks of the requester are dropped, the loads go on for the other requesters and the cache.
+	// Loads left without callbacks or handles are cancelled if they are still queued. Main thread only
+	void CancelAsyncLoads(const void* requester);
+	// Same for many requesters at once, walking the async loads a single time
+	void CancelAsyncLoads(const std::vector<const void*>& requesters);
+	size_t GetNumAsyncLoads() const;
+
+	// Screen size of something at the position as seen from the main camera, up to streaming_priority_scale. Zero without camera
+	float GetStreamingPriority(const float3& position, float radius = 1.f) const;
 
 	void CleanMetafilesInDirectory(const Path& directory_path);
 	void ImportAssetsInDirectory(const Path& directory_path, bool force = false);
@@ -170,18 +164,62 @@ public:
 	uint32_t CreateFromData(FileData data, Path& creation_folder_path, const std::string& created_resource_name);
 	uint32_t CreateFromData(FileData data, const std::string& created_resource_path);
 
-	//Multithread loader
-	void LoaderThread();
-	void RemoveUUIDFromCache(uint32_t uuid);
 	std::shared_ptr<Resource> RetrieveFromCacheIfExist(uint32_t uuid) const;
+	// Unlike RetrieveFromCacheIfExist, neither counted as a cache hit nor miss
+	bool IsCached(uint32_t uuid) const;
 
 	bool RetrieveFileDataByUUID(uint32_t uuid, FileData& filedata) const;
 
+	// Adds what the given resources load along with them, through every resource in the cache. Duplicates and unknown UUIDs are dropped
+	void GatherDependencies(std::vector<uint32_t>& resources) const;
+
+	// Safe to call from any thread, the file is kept in memory until the resource is loaded or the prefetched data is cleared
+	void PrefetchFileData(uint32_t uuid);
+	void ClearPrefetchedFileData();
+
 private:
+	using DecodeFunction = std::function<std::shared_ptr<Resource>(uint32_t uuid, const FileData& file_data)>;
+
+	template<typename T>
+	std::shared_ptr<T> LoadFile(uint32_t uuid)
+	{
+		FileData exported_file_data;
+		if (!TakePrefetchedFileData(uuid, exported_file_data))
+		{
+			std::string resource_library_file = MetafileManager::GetUUIDExportedFile(uuid);
+			if (!App->filesystem->Exists(resource_library_file))
+			{
+				RESOURCES_LOG_ERROR("Error loading Resource %u. File %s doesn't exist", uuid, resource_library_file.c_str());
+				return nullptr;
+			}
+
+			Path* resource_exported_file_path = App->filesystem->GetPath(resource_library_file);
+			exported_file_data = resource_exported_file_path->GetFile()->Load();
+		}
+
+		// Headless runtime has no GL context, GPU uploads are deferred the same way as async loads and never happen
+		std::shared_ptr<Resource> loaded_resource = ResourceManagement::Load<T>(uuid, exported_file_data, App->IsHeadless());
+		//IMPORTANT IF TEXTURE THIS MUST BE DELETED
+		delete[] exported_file_data.buffer;
+
+		// A loader worker can load the same resource meanwhile, whichever is cached first is the one used
+		loaded_resource = AddToCache(loaded_resource, exported_file_data.size);
+
+		RESOURCES_LOG_INFO("Resource %u loaded correctly.", uuid);
+		return std::static_pointer_cast<T>(loaded_resource);
+	}
+
+	// Decodes the resource on a loader worker, or right away without workers. Safe to call from any thread
+	std::shared_ptr<AsyncLoad> StartAsyncLoad(uint32_t uuid, float priority, DecodeFunction decode);
+	bool UsesLoadGraph() const;
 
 	void StartThread();
+	void FinishDecodedLoads();
 	uint32_t InternalImport(Path& file_path, bool force = false) const;
-	void RefreshResourceCache();
+	std::shared_ptr<Resource> AddToCache(const std::shared_ptr<Resource>& resource, size_t file_size) const;
+	ResourceType GetResourceType(uint32_t uuid) const;
+	bool TakePrefetchedFileData(uint32_t uuid, FileData& file_data) const;
+	void StorePrefetchedFileData(uint32_t uuid, const FileData& file_data) const;
 
 
 public:
@@ -200,27 +238,47 @@ public:
 
 	std::vector<std::shared_ptr<Prefab>> prefabs_to_reassign;
 
-	ThreadSafeQueue<LoadingJob> loading_resources_queue;
-	ThreadSafeQueue<LoadingJob> processing_resources_queue;
+	mutable ResourceCache resource_cache;
+
+	ResourceLoader resource_loader;
+	size_t num_loader_threads = 2;
+
+	// Estimated cost of finishing a decoded load on the main thread, learnt per resource type from previous loads
+	struct FinishCost
+	{
+		float ms_per_megabyte = 1.f;
+		float ms_per_load = 0.1f;
+	};
+
+	struct FinishStats
+	{
+		size_t backlog = 0;
+		size_t loads = 0;
+		size_t uploaded_bytes = 0;
+		float time_ms = 0.f;
+		float max_time_ms = 0.f;
+		size_t total_loads = 0;
+		size_t split_loads = 0;
+	};
 
+	float finish_budget_ms = 2.f; // Main thread time finishing decoded loads per frame
+	std::map<ResourceType, FinishCost> finish_costs;
+	FinishStats finish_stats;
+
+	float streaming_priority_scale = 10.f; // Priority of what fills the screen, such as the UI
+	size_t cancelled_async_loads = 0;
+
+	ResourceLoadGraph::Stats load_graph_stats; // Of the last load graph
+
+	// Progress of the loads requested while loading a scene, the loading screen stays until they are finished
 	struct LoadingTexturesThreadCommunication
 	{
 		std::atomic_bool loading = false;
 		std::atomic<int> total_number_of_resources_to_load = 0;
 		std::atomic<int> current_number_of_resources_loaded = 0;
 
-		//Asyncronous loading variables
-		int max_threads = 1;
-		std::atomic<bool> loading_threads_active = true;
-		std::vector<std::thread> loader_threads;
-		bool normal_loading_flag = false;
 		bool load_scene_asyncronously = true;
 		bool restore_time_scale = false;
-		//We change this value to the component that calls Load for textures
-		Component* current_component_loading = nullptr;
-		ResourceType current_type = ResourceType::TEXTURE;
-		//Texture Type 
-		unsigned texture_type = 0;
 
 		//Debugging variables
 		int number_of_textures_loaded = 0;
@@ -233,6 +291,7 @@ public:
 	std::unique_ptr<MeshImporter> mesh_importer;
 	std::unique_ptr<ModelImporter> model_importer;
 	std::unique_ptr<PrefabImporter> prefab_importer;
+	std::unique_ptr<SceneImporter> scene_importer;
 	std::unique_ptr<SkeletonImporter> skeleton_importer;
 	std::unique_ptr<StateMachineImporter> state_machine_importer;
 	std::unique_ptr<TextureImporter> texture_importer;
@@ -248,14 +307,20 @@ private:
 	float last_imported_time = 0;
 	std::thread importing_thread;
 	std::unique_ptr<Timer> thread_timer = std::make_unique<Timer>();
-	
-	float cache_time = 0;
-	const size_t cache_interval_millis = 15* 1000 ;
-	mutable std::vector<std::shared_ptr<Resource>> resource_cache;
+
+
+	std::unordered_map<uint32_t, std::shared_ptr<AsyncLoad>> async_loads; // Loads that are not finished yet
+	std::shared_ptr<AsyncLoad> finishing_load; // Decoded load whose upload was split, it goes on next frame
+	size_t finishing_load_steps = 0;
+	mutable std::mutex async_loads_mutex;
+
+	mutable std::unordered_map<uint32_t, FileData> prefetched_file_data;
+	mutable std::mutex prefetched_file_data_mutex;
 
 	Timer timer = Timer();
 
 	friend class MaterialImporter;
+	friend class ResourceLoadGraph;
 };
 
 #endif // _MODULERESOURCEMANAGER_H_
\ No newline at end of file
@@ -1,10 +1,21 @@
 #include "ModuleScene.h"
 
+#include "Component/ComponentAnimation.h"
+#include "Component/ComponentAudioListener.h"
+#include "Component/ComponentAudioSource.h"
+#include "Component/ComponentBillboard.h"
+#include "Component/ComponentButton.h"
 #include "Component/ComponentCamera.h"
+#include "Component/ComponentEventSystem.h"
+#include "Component/ComponentMeshRenderer.h"
+#include "Component/ComponentParticleSystem.h"
+#include "Component/ComponentText.h"
+#include "Component/ComponentTrail.h"
 #include "EditorUI/Panel/PanelHierarchy.h"
 #include "Filesystem/PathAtlas.h"
 #include "Helper/BuildOptions.h"
 #include "Helper/Config.h"
+#include "Helper/JobSystem.h"
 #include "Log/EngineLog.h"
 
 #include "Main/Application.h"
@@ -12,6 +23,7 @@
 #include "ModuleAnimation.h"
 #include "ModuleCamera.h"
 #include "ModuleEditor.h"
+#include "ModulePhysics.h"
 #include "ModuleRender.h"
 #include "ModuleResourceManager.h"
 #include "ModuleScriptManager.h"
@@ -22,6 +34,7 @@
 #include "ResourceManagement/Metafile/Metafile.h"
 #include "ResourceManagement/Metafile/MetafileManager.h"
 #include "ResourceManagement/Manager/SceneManager.h"
+#include "ResourceManagement/Resources/Prefab.h"
 #include "ResourceManagement/Resources/Scene.h"
 
 #include <algorithm>
@@ -34,6 +47,7 @@
 bool ModuleScene::Init()
 {
 	root = new GameObject(0);
+	transform_hierarchy.MarkTopologyDirty();
 	build_options = std::make_unique<BuildOptions>();
 	build_options->LoadOptions();
 
@@ -49,12 +63,13 @@ bool ModuleScene::Init()
 	return true;
 }
 
+// Components are updated type by type, only the types that override the update phase are visited. Scripts are updated by ModuleScriptManager.
 update_status ModuleScene::PreUpdate()
 {
 	BROFILER_CATEGORY("Module Scene PreUpdate", Profiler::Color::Crimson);
-	for (const auto& game_object : game_objects_ownership)
+	if (!scene_loader.IsLoading())
 	{
-		game_object->PreUpdate();
+		UpdateWorldPartition();
 	}
 	return update_status::UPDATE_CONTINUE;
 }
@@ -62,26 +77,122 @@ update_status ModuleScene::PreUpdate()
 update_status ModuleScene::Update()
 {
 	BROFILER_CATEGORY("Module Scene Update", Profiler::Color::IndianRed);
-	for (const auto&  game_object : game_objects_ownership)
+	// The UI keeps updating while a scene loads, the loading screen is made of it
+	UpdateComponents<ComponentText>(Component::ComponentType::UI_TEXT, [](ComponentText& text) { text.ComponentText::Update(); });
+	UpdateComponents<ComponentEventSystem>(Component::ComponentType::EVENT_SYSTEM, [](ComponentEventSystem& event_system) { event_system.ComponentEventSystem::Update(); });
+
+	// A scene that is still loading is not updated until it is activated
+	if (scene_loader.IsLoading())
 	{
-		game_object->Update();
-		App->space_partitioning->UpdateAABBTree(game_object.get());
+		return update_status::UPDATE_CONTINUE;
 	}
+
+	UpdateComponents<ComponentAnimation>(Component::ComponentType::ANIMATION, [](ComponentAnimation& animation) { animation.ComponentAnimation::Update(); });
+	UpdateComponents<ComponentCamera>(Component::ComponentType::CAMERA, [](ComponentCamera& camera) { camera.ComponentCamera::Update(); });
+	UpdateComponents<ComponentParticleSystem>(Component::ComponentType::PARTICLE_SYSTEM, [](ComponentParticleSystem& particle_system) { particle_system.ComponentParticleSystem::Update(); });
+	// Billboards only touch their own animation state, the rest read transforms, which resolve lazily, or shared engine state
+	UpdateComponents<ComponentBillboard>(Component::ComponentType::BILLBOARD, [](ComponentBillboard& billboard) { billboard.ComponentBillboard::Update(); }, true);
+	UpdateComponents<ComponentTrail>(Component::ComponentType::TRAIL, [](ComponentTrail& trail) { trail.ComponentTrail::Update(); });
+	UpdateComponents<ComponentAudioSource>(Component::ComponentType::AUDIO_SOURCE, [](ComponentAudioSource& audio_source) { audio_source.ComponentAudioSource::Update(); });
+	UpdateComponents<ComponentAudioListener>(Component::ComponentType::AUDIO_LISTENER, [](ComponentAudioListener& audio_listener) { audio_listener.ComponentAudioListener::Update(); });
+
+	// Only game objects with a mesh are in the AABB tree
+	UpdateComponents<ComponentMeshRenderer>(Component::ComponentType::MESH_RENDERER, [](ComponentMeshRenderer& mesh_renderer) { App->space_partitioning->UpdateAABBTree(mesh_renderer.owner); });
 	return update_status::UPDATE_CONTINUE;
 }
 
 update_status ModuleScene::PostUpdate()
 {
 	BROFILER_CATEGORY("Module Scene PostUpdate", Profiler::Color::DarkRed);
+	UpdateComponents<ComponentButton>(Component::ComponentType::UI_BUTTON, [](ComponentButton& button) { button.ComponentButton::PostUpdate(); });
+	return update_status::UPDATE_CONTINUE;
+}
+
+template<typename T, typename Function>
+void ModuleScene::UpdateComponents(Component::ComponentType type, Function update_function, bool parallel) const
+{
+	// Components created while updating are appended, so the size is read every iteration
+	const std::vector<Component*>& components = scene_index.GetComponents(type);
+	if (parallel && components.size() >= MIN_PARALLEL_COMPONENTS)
+	{
+		App->job_system->ParallelFor(components.size(), PARALLEL_BATCH_SIZE, [&components, &update_function](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				update_function(*static_cast<T*>(components[i]));
+			}
+		});
+		return;
+	}
+
+	for (size_t i = 0; i < components.size(); ++i)
+	{
+		update_function(*static_cast<T*>(components[i]));
+	}
+}
+
+void ModuleScene::UpdateTransforms()
+{
+	BROFILER_CATEGORY("Update Transforms", Profiler::Color::Lavender);
+	if (root == nullptr)
+	{
+		return;
+	}
+
+	if (transform_hierarchy.IsTopologyDirty())
+	{
+		transform_hierarchy.Build(root);
+	}
+	transform_hierarchy.Update();
+}
+
+void ModuleScene::UpdateBoundingBoxes() const
+{
+	BROFILER_CATEGORY("Update Bounding Boxes", Profiler::Color::Lavender);
+	std::vector<ComponentAABB*> invalidated_bounding_boxes;
 	for (const auto& game_object : game_objects_ownership)
 	{
-		game_object->PostUpdate();
+		if (game_object->aabb.IsDirty())
+		{
+			game_object->aabb.GenerateLocalBoundingBox();
+			game_object->aabb.InvalidateGlobalBoundingBox(invalidated_bounding_boxes);
+		}
+	}
+	GenerateGlobalBoundingBoxes(invalidated_bounding_boxes);
+}
+
+// Only the given game objects are checked, for callers that know which ones changed
+void ModuleScene::UpdateBoundingBoxes(const std::vector<GameObject*>& game_objects) const
+{
+	BROFILER_CATEGORY("Update Bounding Boxes", Profiler::Color::Lavender);
+	std::vector<ComponentAABB*> invalidated_bounding_boxes;
+	for (const auto& game_object : game_objects)
+	{
+		if (game_object->aabb.IsDirty())
+		{
+			game_object->aabb.GenerateLocalBoundingBox();
+			game_object->aabb.InvalidateGlobalBoundingBox(invalidated_bounding_boxes);
+		}
+	}
+	GenerateGlobalBoundingBoxes(invalidated_bounding_boxes);
+}
+
+void ModuleScene::GenerateGlobalBoundingBoxes(std::vector<ComponentAABB*>& invalidated_bounding_boxes) const
+{
+	// Deepest first, so every global box is generated after the ones of its children
+	std::sort(invalidated_bounding_boxes.begin(), invalidated_bounding_boxes.end(), [](const ComponentAABB* lhs, const ComponentAABB* rhs)
+	{
+		return lhs->owner->GetHierarchyDepth() > rhs->owner->GetHierarchyDepth();
+	});
+	for (const auto& bounding_box : invalidated_bounding_boxes)
+	{
+		bounding_box->GenerateGlobalBoundingBox();
 	}
-	return update_status::UPDATE_CONTINUE;
 }
 
 bool ModuleScene::CleanUp()
 {
+	scene_loader.Cancel();
 	DeleteCurrentScene();
 	return true;
 }
@@ -94,6 +205,7 @@ GameObject* ModuleScene::CreateGameObject()
 
 	GameObject * created_game_object_ptr = created_game_object.get();
 	game_objects_ownership.emplace_back(std::move(created_game_object));
+	scene_index.Index(created_game_object_ptr);
 	return created_game_object_ptr;
 }
 
@@ -110,19 +222,150 @@ GameObject* ModuleScene::CreateChildGameObject(GameObject *parent)
 
 void ModuleScene::RemoveGameObject(GameObject * game_object_to_remove)
 {
-	const auto it = std::find_if(game_objects_ownership.begin(), game_objects_ownership.end(), [game_object_to_remove](auto const& game_object)
+	DestroyGameObject(game_object_to_remove);
+	DestroyPendingGameObjects();
+}
+
+void ModuleScene::DestroyGameObject(GameObject* game_object_to_destroy)
+{
+	std::lock_guard<std::mutex> lock(game_objects_to_destroy_mutex);
+	if (game_object_to_destroy == nullptr || game_object_to_destroy->marked_for_destruction)
 	{
-		return game_object_to_remove == game_object.get();
-	});
-	if (it != game_objects_ownership.end() || game_object_to_remove == root)
+		return;
+	}
+
+	// Every game object the scene owns is indexed
+	if (game_object_to_destroy != root && !scene_index.IsIndexed(game_object_to_destroy))
+	{
+		return;
+	}
+
+	game_object_to_destroy->marked_for_destruction = true;
+	game_objects_to_destroy.push_back(game_object_to_destroy);
+}
+
+void ModuleScene::DestroyPendingGameObjects()
+{
+	std::vector<GameObject*> marked_game_objects;
 	{
-		std::vector<GameObject*> children_to_remove;
-		game_object_to_remove->Delete(children_to_remove);
-		game_objects_ownership.erase(std::remove_if(begin(game_objects_ownership), end(game_objects_ownership), [&children_to_remove](auto const&  game_object)
+		std::lock_guard<std::mutex> lock(game_objects_to_destroy_mutex);
+		marked_game_objects.swap(game_objects_to_destroy);
+	}
+	if (marked_game_objects.empty())
+	{
+		return;
+	}
+
+	BROFILER_CATEGORY("Destroy GameObjects", Profiler::Color::DarkRed);
+
+	// Marked game objects below another marked one are destroyed with its subtree
+	std::vector<GameObject*> destroyed_game_objects;
+	std::vector<GameObject*> detached_parents;
+	for (const auto& marked_game_object : marked_game_objects)
+	{
+		bool has_marked_ancestor = false;
+		for (GameObject* ancestor = marked_game_object->parent; ancestor != nullptr && !has_marked_ancestor; ancestor = ancestor->parent)
+		{
+			has_marked_ancestor = ancestor->marked_for_destruction;
+		}
+		if (has_marked_ancestor)
+		{
+			continue;
+		}
+
+		if (marked_game_object->parent != nullptr)
+		{
+			detached_parents.push_back(marked_game_object->parent);
+		}
+
+		std::stack<GameObject*> subtree;
+		subtree.push(marked_game_object);
+		while (!subtree.empty())
 		{
-			return std::find(begin(children_to_remove), end(children_to_remove), game_object.get()) != end(children_to_remove);
+			GameObject* game_object = subtree.top();
+			subtree.pop();
+			game_object->marked_for_destruction = true;
+			destroyed_game_objects.push_back(game_object);
+			for (const auto& child : game_object->children)
+			{
+				subtree.push(child);
+			}
 		}
-		), end(game_objects_ownership));
+	}
+
+	// One pass per parent, however many of its children are destroyed
+	std::sort(detached_parents.begin(), detached_parents.end());
+	detached_parents.erase(std::unique(detached_parents.begin(), detached_parents.end()), detached_parents.end());
+	for (const auto& parent : detached_parents)
+	{
+		parent->children.erase(std::remove_if(parent->children.begin(), parent->children.end(), [](const GameObject* child)
+		{
+			return child->marked_for_destruction;
+		}), parent->children.end());
+	}
+
+	App->space_partitioning->RemoveAABBTree(destroyed_game_objects);
+	App->space_partitioning->RemoveStatic(destroyed_game_objects);
+
+	std::vector<ComponentCollider*> colliders_to_remove;
+	std::vector<ComponentMeshRenderer*> meshes_to_remove;
+	std::vector<const void*> async_load_requesters;
+	for (const auto& game_object : destroyed_game_objects)
+	{
+		scene_index.Unindex(game_object);
+		for (int i = (game_object->components.size() - 1); i >= 0; --i)
+		{
+			Component* component = game_object->components[i];
+			switch (component->GetType())
+			{
+			case Component::ComponentType::COLLIDER:
+				colliders_to_remove.push_back(static_cast<ComponentCollider*>(component));
+				break;
+
+			case Component::ComponentType::MESH_RENDERER:
+				meshes_to_remove.push_back(static_cast<ComponentMeshRenderer*>(component));
+				async_load_requesters.push_back(component);
+				break;
+
+			default:
+				component->Delete();
+				break;
+			}
+		}
+		game_object->components.clear();
+		game_object->UpdateComponentSlots();
+
+		if (game_object->is_prefab_parent)
+		{
+			game_object->prefab_reference->RemoveInstance(game_object);
+			const auto prefab_pool = prefab_pools.find(game_object->prefab_reference->GetUUID());
+			if (prefab_pool != prefab_pools.end())
+			{
+				prefab_pool->second->Forget(game_object);
+			}
+		}
+	}
+	// Batched components skip Delete, their pending Then callbacks must go before the pools free them
+	App->resources->CancelAsyncLoads(async_load_requesters);
+	App->physics->RemoveComponentColliders(colliders_to_remove);
+	App->renderer->RemoveComponentMeshes(meshes_to_remove);
+
+	for (const auto& game_object : destroyed_game_objects)
+	{
+		game_object->parent = nullptr;
+		game_object->children.clear();
+	}
+	transform_hierarchy.MarkTopologyDirty();
+
+	game_objects_ownership.erase(std::remove_if(game_objects_ownership.begin(), game_objects_ownership.end(), [](const std::unique_ptr<GameObject>& game_object)
+	{
+		return game_object->marked_for_destruction;
+	}), game_objects_ownership.end());
+
+	// The root is not owned by the scene, it survives without children until the next scene replaces it
+	if (root != nullptr)
+	{
+		root->marked_for_destruction = false;
 	}
 }
 
@@ -131,6 +374,7 @@ GameObject* ModuleScene::AddGameObject(std::unique_ptr<GameObject>& game_object_
 {
 	game_objects_ownership.emplace_back(std::move(game_object_to_add));
 	GameObject * game_object = game_objects_ownership.back().get();
+	scene_index.Index(game_object);
 	game_object->SetParent(root);
 	if (!game_object->IsStatic())
 	{
@@ -208,7 +452,7 @@ GameObject* ModuleScene::DuplicateGO(GameObject* game_object, GameObject* parent
 	std::unique_ptr<GameObject> aux_copy_pointer = std::make_unique<GameObject>();
 	GameObject* duplicated_go = App->scene->AddGameObject(aux_copy_pointer);
 	duplicated_go->Duplicate(*game_object, parent_go);
-	duplicated_go->name += "(1)";
+	duplicated_go->SetName(duplicated_go->name + "(1)");
 
 	if (game_object->is_prefab_parent)
 	{
@@ -262,61 +506,22 @@ GameObject* ModuleScene::GetGameObject(uint64_t UUID) const
 	{
 		return root;
 	}
-
-	APP_LOG_INFO("Getting game object %u", UUID)
-	APP_LOG_INFO("%d", game_objects_ownership.size())
-
-	for (auto& game_object : game_objects_ownership)
-	{		
-		if (game_object->UUID == UUID) 
-		{
-			return game_object.get();
-		}
-	}
-
-	return nullptr;
+	return scene_index.GetGameObject(UUID);
 }
 
 GameObject* ModuleScene::GetGameObjectByName(const std::string& go_name) const
 {
-	APP_LOG_INFO("Getting game object %s", go_name.c_str());
-	APP_LOG_INFO("%d", game_objects_ownership.size())
-
-	for (auto& game_object : game_objects_ownership)
-	{
-		if (game_object->name == go_name)
-		{
-			return game_object.get();
-		}
-	}
-
-	return nullptr;
+	return scene_index.GetGameObjectByName(go_name);
 }
 
 GameObject* ModuleScene::GetGameObjectWithTag(const std::string& tag) const
 {
-	for (auto& game_object : game_objects_ownership)
-	{
-		if (game_object->tag == tag)
-		{
-			return game_object.get();
-		}
-	}
-
-	return nullptr;
+	return scene_index.GetGameObjectWithTag(tag);
 }
 
 std::vector<GameObject*> ModuleScene::GetGameObjectsWithTag(const std::string& tag) const
 {
-	std::vector<GameObject*> returned_game_objects;
-	for (auto& game_object : game_objects_ownership)
-	{
-		if (game_object->tag == tag)
-		{
-			returned_game_objects.push_back(game_object.get());
-		}
-	}
-	return returned_game_objects;
+	return scene_index.GetGameObjectsWithTag(tag);
 }
 
 std::vector<GameObject*> ModuleScene::GetGameObjectsWithComponent(const Component::ComponentType component_type) const
@@ -338,18 +543,22 @@ std::vector<GameObject*> ModuleScene::GetGameObjectsWithComponent(const Componen
 
 Component* ModuleScene::GetComponent(uint64_t UUID) const
 {
-	for (auto& game_object : game_objects_ownership)
-	{
-		for(auto& component : game_object->components)
-		{
-			if(component->UUID == UUID)
-			{
-				return component;
-			}
-		}
-	}
+	return scene_index.GetComponent(UUID);
+}
 
-	return nullptr;
+void ModuleScene::ReindexGameObject(GameObject* game_object)
+{
+	scene_index.Reindex(game_object);
+}
+
+void ModuleScene::IndexComponent(Component* component)
+{
+	scene_index.IndexComponent(component);
+}
+
+void ModuleScene::UnindexComponent(const Component* component)
+{
+	scene_index.UnindexComponent(component);
 }
 
 void ModuleScene::SortGameObjectChilds(GameObject *go) const
@@ -389,11 +598,32 @@ void ModuleScene::OpenPendingScene()
 	pending_scene_uuid = 0;
 }
 
+void ModuleScene::UpdateSceneLoading()
+{
+	if (scene_loader.IsLoading() && scene_loader.Update(scene_loading_budget_ms))
+	{
+		ActivateScene();
+	}
+}
+
+bool ModuleScene::IsLoadingScene() const
+{
+	return scene_loader.IsLoading();
+}
+
+float ModuleScene::GetSceneLoadingProgress() const
+{
+	return scene_loader.GetProgress();
+}
+
 void ModuleScene::DeleteCurrentScene()
 {
 	//UndoRedo
 	App->actions->ClearUndoRedoStacks();
+	world_partition.Clear();
 	RemoveGameObject(root);
+	prefab_pools.clear();
+	scene_index.Clear();
 	App->space_partitioning->ResetAABBTree();
 	App->scripts->scripts.clear();
 	App->editor->selected_game_object = nullptr;
@@ -401,19 +631,30 @@ void ModuleScene::DeleteCurrentScene()
 
 void ModuleScene::OpenScene()
 {
+	scene_loader.Cancel();
 	App->animations->CleanTweens();
 	DeleteCurrentScene();
-	root = new GameObject(0);	
-	
+	root = new GameObject(0);
+	transform_hierarchy.MarkTopologyDirty();
 
 	LoadSceneResource();
+}
+
+// Runs once the loaded scene is fully prepared, it is updated, simulated and drawn from the next frame on
+void ModuleScene::ActivateScene()
+{
+	if (loading_build_scene)
+	{
+		current_scene = scene_loader.GetScene();
+		App->resources->loading_thread_communication.load_scene_asyncronously = true;
+		loading_build_scene = false;
+	}
+	scene_loader.Cancel();
 
 	if (App->time->isGameRunning())
 	{
 		App->animations->PlayAnimations();
 	}
-	App->space_partitioning->GenerateQuadTree();
-	App->space_partitioning->GenerateOctTree();
 	App->actions->ClearUndoStack();
 	App->time->ResetInitFrame();
 }
@@ -423,28 +664,29 @@ inline void ModuleScene::LoadSceneResource()
 	std::string uuid_string = std::to_string(pending_scene_uuid);
 	bool exists = App->filesystem->Exists(std::string(LIBRARY_METADATA_PATH) + "/" + uuid_string.substr(0,2)+"/"+uuid_string);
 	uint32_t default_uuid = GetSceneUUIDFromPath(DEFAULT_SCENE_PATH);
+	loading_build_scene = false;
 	if (pending_scene_uuid == tmp_scene->GetUUID())
 	{
-		tmp_scene.get()->Load();
+		scene_loader.Start(tmp_scene);
 		current_scene = last_scene;
 	}
 	else if (pending_scene_uuid == default_uuid || !exists)
 	{
 		current_scene = nullptr;
-		App->resources->Load<Scene>(default_uuid).get()->Load();
+		scene_loader.Start(default_uuid);
 	}
 	else
 	{
-		if(MULTITHREADING && App->time->isGameRunning())
+		if(MULTITHREADING && App->time->isGameRunning() && !App->IsHeadless())
 		{
 			timer.Start();
 			LoadLoadingScreen();
 		}
 			
-		current_scene = App->resources->Load<Scene>(pending_scene_uuid);
-		current_scene.get()->Load();
-
-		App->resources->loading_thread_communication.load_scene_asyncronously = true;
+		// Becomes the current scene when it is activated
+		current_scene = nullptr;
+		loading_build_scene = true;
+		scene_loader.Start(pending_scene_uuid);
 	}
 }
 
@@ -489,6 +731,13 @@ void ModuleScene::SaveScene(uint32_t scene_uuid)
 		return;
 	}
 
+	// Cells that are not loaded would be saved empty
+	if (!world_partition.IsFullyLoaded())
+	{
+		APP_LOG_INFO("You must wait until every world partition cell is loaded to save scene.");
+		return;
+	}
+
 	if (scene_uuid == 0) // Save current scene in its own resource
 	{
 		assert(current_scene != nullptr);
@@ -512,9 +761,42 @@ void ModuleScene::SaveTmpScene()
 	last_scene = current_scene;
 }
 
+void ModuleScene::SavePlayModeSnapshot()
+{
+	play_mode_snapshot.Save(root);
+	last_scene = current_scene;
+}
+
+// Only game objects spawned or destroyed while playing are recreated, the rest get their saved state back in place
+void ModuleScene::RestorePlayModeSnapshot()
+{
+	BROFILER_CATEGORY("Restore Play Mode", Profiler::Color::Brown);
+	timer.Start();
+
+	scene_loader.Cancel();
+	pending_scene_uuid = 0;
+	App->animations->CleanTweens();
+	App->actions->ClearUndoRedoStacks();
+	App->editor->selected_game_object = nullptr;
+
+	if (!play_mode_snapshot.Restore(root))
+	{
+		APP_LOG_ERROR("There is no play mode snapshot to restore.");
+		return;
+	}
+	current_scene = last_scene;
+	world_partition.SyncLoadedCells();
+	prefab_pools.clear(); // Instances spawned while playing are gone with the snapshot
+
+	App->space_partitioning->GenerateQuadTree();
+	App->space_partitioning->GenerateOctTree();
+	App->time->ResetInitFrame();
+	App->physics->UpdateAllDimensions();
+	APP_LOG_INFO("Time restoring scene: %.3f ms", timer.Stop());
+}
+
 void ModuleScene::LoadLoadingScreen()
 {
-	App->resources->loading_thread_communication.normal_loading_flag = true;
 	App->resources->Load<Scene>(GetSceneUUIDFromPath(LOADING_SCREEN_PATH)).get()->Load();
 	loading_screen_canvas = GetGameObjectByName("Canvas");
 	GameObject* light = GetGameObjectByName("Light");
@@ -529,8 +811,6 @@ void ModuleScene::LoadLoadingScreen()
 		RemoveGameObject(main_camera);
 	}
 
-	App->resources->loading_thread_communication.normal_loading_flag = false;
-
 	App->resources->loading_thread_communication.loading = true;
 	App->time->time_scale = 0.f;
 }
@@ -560,6 +840,84 @@ bool ModuleScene::CurrentSceneIsSaved() const
 	return current_scene != nullptr;
 }
 
+void ModuleScene::SetStreamingFocusPoints(const std::vector<float3>& focus_points)
+{
+	streaming_focus_points = focus_points;
+}
+
+WorldPartition& ModuleScene::GetWorldPartition()
+{
+	return world_partition;
+}
+
+void ModuleScene::WarmupPrefabPool(uint32_t prefab_uuid, size_t warmup_count)
+{
+	PrefabPool* prefab_pool = GetPrefabPool(prefab_uuid);
+	if (prefab_pool != nullptr)
+	{
+		prefab_pool->Warmup(warmup_count);
+	}
+}
+
+GameObject* ModuleScene::SpawnPrefab(uint32_t prefab_uuid, GameObject* parent, const float3& translation, const Quat& rotation)
+{
+	PrefabPool* prefab_pool = GetPrefabPool(prefab_uuid);
+	if (prefab_pool == nullptr)
+	{
+		return nullptr;
+	}
+	return prefab_pool->Spawn(parent != nullptr ? parent : root, translation, rotation);
+}
+
+// Game objects that are not prefab instances are destroyed
+void ModuleScene::DespawnPrefab(GameObject* instance)
+{
+	if (instance == nullptr)
+	{
+		return;
+	}
+
+	PrefabPool* prefab_pool = nullptr;
+	if (instance->is_prefab_parent && instance->prefab_reference != nullptr)
+	{
+		prefab_pool = GetPrefabPool(instance->prefab_reference->GetUUID());
+	}
+	if (prefab_pool == nullptr || !prefab_pool->Despawn(instance))
+	{
+		DestroyGameObject(instance);
+	}
+}
+
+PrefabPool* ModuleScene::GetPrefabPool(uint32_t prefab_uuid)
+{
+	const auto it = prefab_pools.find(prefab_uuid);
+	if (it != prefab_pools.end())
+	{
+		return it->second.get();
+	}
+
+	std::shared_ptr<Prefab> prefab = App->resources->Load<Prefab>(prefab_uuid);
+	if (prefab == nullptr)
+	{
+		APP_LOG_ERROR("Prefab %u cannot be pooled, it does not exist.", prefab_uuid);
+		return nullptr;
+	}
+	return prefab_pools.emplace(prefab_uuid, std::make_unique<PrefabPool>(prefab)).first->second.get();
+}
+
+// Outside play mode, or without anything to stream around, every cell is kept loaded
+void ModuleScene::UpdateWorldPartition()
+{
+	std::vector<float3> focus_points = streaming_focus_points;
+	if (focus_points.empty() && App->cameras->main_camera != nullptr)
+	{
+		focus_points.push_back(App->cameras->main_camera->owner->transform.GetGlobalTranslation());
+	}
+
+	bool streaming = App->time->isGameRunning() && !focus_points.empty();
+	world_partition.Update(focus_points, streaming);
+}
+
 void ModuleScene::StopSceneTimer()
 {
 	APP_LOG_INFO("TOTAL TIME LOADING SCENE: %.3f", timer.Stop());
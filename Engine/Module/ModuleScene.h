@@ -9,9 +9,16 @@
 #include "Helper/BuildOptions.h"
 #include "Main/Globals.h"
 #include "Main/GameObject.h"
+#include "Main/PlayModeSnapshot.h"
+#include "Main/PrefabPool.h"
+#include "Main/SceneIndex.h"
+#include "Main/SceneLoader.h"
+#include "Main/TransformHierarchy.h"
+#include "Main/WorldPartition.h"
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 class Scene;
 
@@ -30,6 +37,8 @@ public:
 	ENGINE_API GameObject* CreateGameObject();
 	ENGINE_API GameObject* CreateChildGameObject(GameObject* parent);
 	void RemoveGameObject(GameObject* game_object_to_remove);
+	ENGINE_API void DestroyGameObject(GameObject* game_object_to_destroy);
+	void DestroyPendingGameObjects();
 	GameObject* AddGameObject(std::unique_ptr<GameObject> & game_object_to_add);
 	ENGINE_API GameObject* DuplicateGameObject(GameObject* game_object, GameObject* parent_go);
 	void DuplicateGameObjectList(std::vector<GameObject*> game_objects);
@@ -46,9 +55,20 @@ public:
 	ENGINE_API std::vector<GameObject*> GetGameObjectsWithComponent(const Component::ComponentType component_type) const;
 
 	Component* GetComponent(uint64_t UUID) const;
+
+	void ReindexGameObject(GameObject* game_object);
+	void IndexComponent(Component* component);
+	void UnindexComponent(const Component* component);
 	void SortGameObjectChilds(GameObject* go) const;
 
+	void UpdateTransforms();
+	void UpdateBoundingBoxes() const;
+	void UpdateBoundingBoxes(const std::vector<GameObject*>& game_objects) const;
+
 	void OpenPendingScene();
+	void UpdateSceneLoading();
+	ENGINE_API bool IsLoadingScene() const;
+	ENGINE_API float GetSceneLoadingProgress() const;
 	void DeleteCurrentScene();
 
 
@@ -61,6 +81,9 @@ public:
 	void LoadTmpScene();
 	void SaveTmpScene();
 
+	void SavePlayModeSnapshot();
+	void RestorePlayModeSnapshot();
+
 	void LoadLoadingScreen();
 	void DeleteLoadingScreen();
 
@@ -69,6 +92,15 @@ public:
 
 	void StopSceneTimer();
 
+	// Streaming cells load around these points while playing, the main camera is used when there are none
+	ENGINE_API void SetStreamingFocusPoints(const std::vector<float3>& focus_points);
+	WorldPartition& GetWorldPartition();
+
+	// Prefab instances recycled through a pool per prefab, despawning an instance parks it in the pool of its prefab
+	ENGINE_API void WarmupPrefabPool(uint32_t prefab_uuid, size_t warmup_count);
+	ENGINE_API GameObject* SpawnPrefab(uint32_t prefab_uuid, GameObject* parent, const float3& translation, const Quat& rotation = Quat::identity);
+	ENGINE_API void DespawnPrefab(GameObject* instance);
+
 	//Multiselection
 	bool HasParent(GameObject* go) const;
 	bool BelongsToList(GameObject* go) const;
@@ -76,21 +108,46 @@ public:
 private:
 	void OpenScene();
 	inline void LoadSceneResource();
+	void ActivateScene();
+	void GenerateGlobalBoundingBoxes(std::vector<ComponentAABB*>& invalidated_bounding_boxes) const;
+	void UpdateWorldPartition();
+	PrefabPool* GetPrefabPool(uint32_t prefab_uuid);
 	uint32_t GetSceneUUIDFromPath(const std::string& path);
 
 	//Don't use this function use the public one
 	GameObject* DuplicateGO(GameObject* game_object, GameObject* parent_go);
 
+	template<typename T, typename Function>
+	void UpdateComponents(Component::ComponentType type, Function update_function, bool parallel = false) const;
+
 
 private:
+	static const size_t MIN_PARALLEL_COMPONENTS = 1024;
+	static const size_t PARALLEL_BATCH_SIZE = 256;
+
 	GameObject* root = nullptr;
 	std::vector<std::unique_ptr<GameObject>> game_objects_ownership;
+	SceneIndex scene_index; // Authoritative, game object fields are written through setters or followed by ReindexGameObject
+	TransformHierarchy transform_hierarchy;
+
+	std::vector<GameObject*> game_objects_to_destroy; // Marked for destruction, flushed once per frame by DestroyPendingGameObjects
+	std::mutex game_objects_to_destroy_mutex;
 
 	std::shared_ptr<Scene> current_scene = nullptr;
 	uint32_t pending_scene_uuid = 0;
 
+	SceneLoader scene_loader;
+	float scene_loading_budget_ms = 8.f; // Spent instantiating the loading scene every frame
+	bool loading_build_scene = false;
+
 	std::shared_ptr<Scene> tmp_scene = nullptr;
 	std::shared_ptr<Scene> last_scene = 0;
+	PlayModeSnapshot play_mode_snapshot;
+
+	WorldPartition world_partition;
+	std::vector<float3> streaming_focus_points;
+
+	std::unordered_map<uint32_t, std::unique_ptr<PrefabPool>> prefab_pools; // By prefab UUID, parked instances belong to the scene
 
 	std::unique_ptr<BuildOptions> build_options = nullptr;
 
@@ -98,6 +155,7 @@ private:
 
 	Timer timer;
 
+	friend class PanelConfiguration;
 	friend class PanelScene;
 	friend class PanelBuildOptions;
 	friend class ModuleDebugDraw;
@@ -9,6 +9,7 @@
 #include "Main/Application.h"
 #include "Main/GameObject.h"
 #include "Module/ModuleFileSystem.h"
+#include "Module/ModuleScene.h"
 #include "Module/ModuleTime.h"
 
 #include "Script/Script.h"
@@ -31,7 +32,7 @@ bool ModuleScriptManager::Init()
 update_status ModuleScriptManager::Update()
 {
 	BROFILER_CATEGORY("Module Script Update", Profiler::Color::Navy);
-	if (App->time->isGameRunning()) 
+	if (App->time->isGameRunning() && !App->scene->IsLoadingScene()) 
 	{
 		for (size_t i = 0; i < scripts.size(); ++i)
 		{
@@ -239,6 +240,26 @@ void ModuleScriptManager::ReLink()
 	}
 }
 
+void ModuleScriptManager::ReLink(const std::vector<GameObject*>& game_objects)
+{
+	for (const auto& game_object : game_objects)
+	{
+		for (const auto& component : game_object->components)
+		{
+			if (component->type != Component::ComponentType::SCRIPT)
+			{
+				continue;
+			}
+
+			ComponentScript* component_script = static_cast<ComponentScript*>(component);
+			if (component_script->script)
+			{
+				component_script->script->Link();
+			}
+		}
+	}
+}
+
 void ModuleScriptManager::SaveVariables(std::unordered_map<uint64_t, Config>& config_list)
 {
 	for (const auto& component_script : scripts)
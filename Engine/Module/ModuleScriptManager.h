@@ -52,6 +52,7 @@ private:
 public:
 	void Refresh();
 	void ReLink();
+	void ReLink(const std::vector<GameObject*>& game_objects);
 
 	void SaveVariables(std::unordered_map<uint64_t, Config>& config_list);
 	void LoadVariables(std::unordered_map<uint64_t, Config> config_list);
@@ -9,6 +9,7 @@
 #include "Component/ComponentMeshRenderer.h"
 
 #include <algorithm>
+#include <unordered_set>
 #include <assimp/scene.h>
 #include <MathGeoLib.h>
 #include <Brofiler/Brofiler.h>
@@ -26,8 +27,14 @@ void ModuleSpacePartitioning::GenerateQuadTree()
 {
 
 	BROFILER_CATEGORY("Generate QuadTree", Profiler::Color::Lavender);
+	App->scene->UpdateBoundingBoxes();
+
 	AABB2D global_AABB;
 	global_AABB.SetNegativeInfinity();
+	if (static_limits.IsFinite())
+	{
+		global_AABB = AABB2D(float2(static_limits.MinX(), static_limits.MinZ()), float2(static_limits.MaxX(), static_limits.MaxZ()));
+	}
 
 	for (const auto& mesh_renderer : App->renderer->mesh_renderers)
 	{
@@ -51,8 +58,14 @@ void ModuleSpacePartitioning::GenerateOctTree()
 {
 
 	BROFILER_CATEGORY("Generate OctTree", Profiler::Color::Lavender);
+	App->scene->UpdateBoundingBoxes();
+
 	AABB global_AABB;
 	global_AABB.SetNegativeInfinity();
+	if (static_limits.IsFinite())
+	{
+		global_AABB = static_limits;
+	}
 
 	for (const auto& mesh_renderer : App->renderer->mesh_renderers)
 	{
@@ -75,6 +88,87 @@ void ModuleSpacePartitioning::GenerateOctTree()
 	}
 }
 
+// Trees are only generated again when a game object falls outside of them
+void ModuleSpacePartitioning::InsertStatic(const std::vector<GameObject*>& game_objects)
+{
+	BROFILER_CATEGORY("Insert Static", Profiler::Color::Lavender);
+	App->scene->UpdateBoundingBoxes(game_objects);
+
+	std::vector<GameObject*> static_game_objects;
+	for (const auto& game_object : game_objects)
+	{
+		if (game_object->IsStatic() && game_object->GetComponent(Component::ComponentType::MESH_RENDERER) != nullptr)
+		{
+			static_game_objects.push_back(game_object);
+		}
+	}
+
+	bool quadtree_fits = true;
+	bool octtree_fits = true;
+	for (const auto& game_object : static_game_objects)
+	{
+		quadtree_fits = quadtree_fits && ol_quadtree->Contains(game_object->aabb.bounding_box2D);
+		octtree_fits = octtree_fits && ol_octtree->Contains(game_object->aabb.bounding_box);
+	}
+
+	if (!quadtree_fits)
+	{
+		GenerateQuadTree();
+	}
+	if (!octtree_fits)
+	{
+		GenerateOctTree();
+	}
+
+	for (const auto& game_object : static_game_objects)
+	{
+		if (quadtree_fits)
+		{
+			ol_quadtree->Insert(*game_object);
+		}
+		if (octtree_fits)
+		{
+			ol_octtree->Insert(*game_object);
+		}
+	}
+}
+
+void ModuleSpacePartitioning::RemoveStatic(const std::vector<GameObject*>& game_objects)
+{
+	BROFILER_CATEGORY("Remove Static", Profiler::Color::Lavender);
+	std::unordered_set<const GameObject*> static_game_objects;
+	for (const auto& game_object : game_objects)
+	{
+		if (game_object->IsStatic() && game_object->GetComponent(Component::ComponentType::MESH_RENDERER) != nullptr)
+		{
+			static_game_objects.insert(game_object);
+		}
+	}
+
+	if (!static_game_objects.empty())
+	{
+		ol_quadtree->Remove(static_game_objects);
+		ol_octtree->Remove(static_game_objects);
+	}
+}
+
+void ModuleSpacePartitioning::SetStaticLimits(const AABB& limits)
+{
+	static_limits = limits;
+}
+
+void ModuleSpacePartitioning::CreateStaticTrees(const AABB& limits)
+{
+	AABB tree_limits = limits;
+	if (static_limits.IsFinite())
+	{
+		tree_limits.Enclose(static_limits);
+	}
+
+	ol_quadtree->Create(AABB2D(float2(tree_limits.MinX(), tree_limits.MinZ()), float2(tree_limits.MaxX(), tree_limits.MaxZ())));
+	ol_octtree->Create(tree_limits);
+}
+
 void ModuleSpacePartitioning::InsertAABBTree(GameObject* game_object)
 {
 	ComponentMeshRenderer* object_mesh = static_cast<ComponentMeshRenderer*>(game_object->GetComponent(Component::ComponentType::MESH_RENDERER));
@@ -93,6 +187,18 @@ void ModuleSpacePartitioning::RemoveAABBTree(GameObject* game_object)
 	}
 }
 
+void ModuleSpacePartitioning::RemoveAABBTree(const std::vector<GameObject*>& game_objects)
+{
+	BROFILER_CATEGORY("Remove AABBTree", Profiler::Color::Lavender);
+	for (const auto& game_object : game_objects)
+	{
+		if (!game_object->IsStatic())
+		{
+			RemoveAABBTree(game_object);
+		}
+	}
+}
+
 void ModuleSpacePartitioning::UpdateAABBTree(GameObject * game_object)
 {
 	BROFILER_CATEGORY("Update AABBTree", Profiler::Color::Lavender);
@@ -39,8 +39,18 @@ public:
 
 	void GenerateQuadTree();
 	void GenerateOctTree();
+
+	// Static game objects streamed in or out are added to or removed from the quadtree and octree without generating them again
+	void InsertStatic(const std::vector<GameObject*>& game_objects);
+	void RemoveStatic(const std::vector<GameObject*>& game_objects);
+	// Trees are generated at least this big, so what streams in later fits without generating them again
+	void SetStaticLimits(const AABB& limits);
+	// Empty trees enclosing the limits, for loaders that insert the static game objects a chunk at a time
+	void CreateStaticTrees(const AABB& limits);
+
 	void InsertAABBTree(GameObject* game_object);
 	void RemoveAABBTree(GameObject* game_object);
+	void RemoveAABBTree(const std::vector<GameObject*>& game_objects);
 	void UpdateAABBTree(GameObject* game_object);
 
 	void ResetAABBTree();
@@ -57,6 +67,8 @@ private:
 	std::unique_ptr<OLOctTree> ol_octtree = nullptr;
 	std::unique_ptr<OLAABBTree> ol_abbtree = nullptr;
 
+	AABB static_limits = AABB(float3::inf, -float3::inf);
+
 	friend class ModuleDebugDraw;
 	friend class PanelConfiguration;
 	friend class PanelScene;
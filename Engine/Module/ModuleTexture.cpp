@@ -19,6 +19,11 @@
 bool ModuleTexture::Init()
 {
 	APP_LOG_SECTION("************ Module Texture Init ************");
+	if (App->IsHeadless())
+	{
+		return true;
+	}
+
 	GenerateTexture(checkerboard_texture_id, PATRON::CHECKBOARD);
 	GenerateTexture(whitefall_texture_id, PATRON::WHITE);
 	GenerateTexture(blackfall_texture_id, PATRON::BLACK);
@@ -28,6 +33,11 @@ bool ModuleTexture::Init()
 // Called before quitting
 bool ModuleTexture::CleanUp()
 {
+	if (App->IsHeadless())
+	{
+		return true;
+	}
+
 	glDeleteTextures(1, &checkerboard_texture_id);
 	glDeleteTextures(1, &whitefall_texture_id);
 	glDeleteTextures(1, &blackfall_texture_id);
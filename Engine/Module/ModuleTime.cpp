@@ -35,6 +35,13 @@ bool ModuleTime::Init()
 	game_time_clock->Start();
 #endif
 
+	if (App->IsHeadless())
+	{
+		// Headless simulation runs in play mode and as fast as possible
+		game_time_clock->Start();
+		limit_fps = false;
+	}
+
 	APP_LOG_INFO("Engine clocks initialized correctly");
 
 	return true;
@@ -74,6 +81,11 @@ void ModuleTime::EndFrame()
 	delta_time = (game_time - frame_start_time) * time_scale;
 	frame_start_time = game_time;
 
+	if (fixed_delta_time > 0.f && game_time_clock->Started() && !game_time_clock->IsPaused())
+	{
+		delta_time = fixed_delta_time * time_scale;
+	}
+
 	time += delta_time;
 	real_time_since_startup += real_time_delta_time;
 
@@ -112,7 +124,7 @@ void ModuleTime::Play()
 {
 	if (!game_time_clock->Started())
 	{
-		App->scene->SaveTmpScene();
+		App->scene->SavePlayModeSnapshot();
 		game_time_clock->Start();
 		SetTimeScale(1.f);
 		frame_start_time = game_time_clock->Read();
@@ -121,7 +133,7 @@ void ModuleTime::Play()
 	else
 	{
 		game_time_clock->Stop();
-		App->scene->LoadTmpScene();
+		App->scene->RestorePlayModeSnapshot();
 	}
 }
 
@@ -156,6 +168,11 @@ void ModuleTime::StepFrame()
 	stepping_frame = true;
 }
 
+void ModuleTime::SetFixedDeltaTime(float fixed_delta_time)
+{
+	this->fixed_delta_time = fixed_delta_time;
+}
+
 void ModuleTime::SetTimeScale(float time_scale)
 {
 	this->time_scale = time_scale;
@@ -25,6 +25,7 @@ public:
 	ENGINE_API float GetFPS() const;
 	void SetMaxFPS(int fps);
 	void SetTimeScale(float time_scale);
+	void SetFixedDeltaTime(float fixed_delta_time);
 	void ResetInitFrame();
 
 	ENGINE_API bool isGameRunning();
@@ -55,6 +56,7 @@ private:
 
 	bool limit_fps = true;
 	float last_frame_delay = 0.f;
+	float fixed_delta_time = 0.f; // In ms. When set, game time advances this amount every frame regardless of the real frame time
 
 	int max_fps = 60;
 	float current_fps = 0.f;
@@ -10,6 +10,7 @@
 
 
 #include "Log/EngineLog.h"
+#include "Main/Application.h"
 #include "Main/Globals.h"
 #include "Main/GameObject.h"
 
@@ -22,6 +23,11 @@
 bool ModuleUI::Init()
 {
 	APP_LOG_SECTION("************ Module UI Init ************");
+	if (App->IsHeadless())
+	{
+		return true;
+	}
+
 	quad = std::make_unique<Quad>();
 	quad->InitQuadUI();
 	return true;
@@ -118,7 +118,7 @@ void LightFrustum::UpdateMeshRenderersAABB()
 	mesh_renderers_enclosing_aabb.SetNegativeInfinity();
 	std::vector<ComponentMeshRenderer*> culled_meshes = App->space_partitioning->GetCullingMeshes(
 		sub_perspective_frustum,
-		App->renderer->mesh_renderers, 
+		App->renderer->mesh_renderers.GetComponents(), 
 		ComponentMeshRenderer::MeshProperties::SHADOW_CASTER
 	);
 	for (auto& mesh_renderer : culled_meshes)
@@ -12,6 +12,7 @@
 #include "Module/ModuleEditor.h"
 #include "Module/ModuleProgram.h"
 #include "Module/ModuleRender.h"
+#include "Module/ModuleScene.h"
 #include "Module/ModuleUI.h"
 #include "Module/ModuleSpacePartitioning.h"
 #include "Helper/Utils.h"
@@ -61,16 +62,25 @@ void Viewport::Render(ComponentCamera* camera)
 {
 	this->camera = camera;
 	camera->SetAspectRatio(width / height);
-	culled_mesh_renderers = App->space_partitioning->GetCullingMeshes(camera, App->renderer->mesh_renderers);
 
-	LightCameraPass();
+	// A scene that is still loading is not drawn until it is activated, only the UI of the loading screen is
+	bool scene_loading = App->scene->IsLoadingScene();
+	culled_mesh_renderers.clear();
+	if (!scene_loading)
+	{
+		culled_mesh_renderers = App->space_partitioning->GetCullingMeshes(camera, App->renderer->mesh_renderers.GetComponents());
+		LightCameraPass();
+	}
 	App->lights->BindLightFrustumsMatrices();
 
 	BindCameraFrustumMatrices(camera->camera_frustum);
 	glViewport(0, 0, width, height);
 
 	MeshRenderPass();
-	EffectsRenderPass();
+	if (!scene_loading)
+	{
+		EffectsRenderPass();
+	}
 	DebugPass();
 	EditorDrawPass();
 	DebugDrawPass();
@@ -323,7 +333,7 @@ void Viewport::DepthMapPass(LightFrustum* light_frustum, FrameBuffer* depth_fbo,
 
 	std::vector<ComponentMeshRenderer*> culled_shadow_casters = App->space_partitioning->GetCullingMeshes(
 		App->cameras->main_camera,
-		App->renderer->mesh_renderers,
+		App->renderer->mesh_renderers.GetComponents(),
 		ComponentMeshRenderer::MeshProperties::SHADOW_CASTER
 	);
 
@@ -148,7 +148,9 @@ FileData MeshImporter::CreateBinary(std::vector<Mesh::Vertex> && vertices, std::
 	uint32_t num_vertices = vertices.size();
 	uint32_t ranges[2] = { num_indices, num_vertices };
 
-	uint32_t size = sizeof(ranges) + sizeof(uint32_t) * num_indices + sizeof(Mesh::Vertex) * num_vertices + sizeof(uint32_t);
+	AABB bounding_box = Mesh::ComputeBoundingBox(vertices);
+
+	uint32_t size = sizeof(ranges) + sizeof(uint32_t) * num_indices + sizeof(Mesh::Vertex) * num_vertices + sizeof(float3) * 2;
 
 	char* data = new char[size]; // Allocate
 	char* cursor = data;
@@ -163,6 +165,10 @@ FileData MeshImporter::CreateBinary(std::vector<Mesh::Vertex> && vertices, std::
 	bytes = sizeof(Mesh::Vertex) * num_vertices;
 	memcpy(cursor, &vertices.front(), bytes);
 
+	cursor += bytes; // Store bounding box
+	memcpy(cursor, &bounding_box.minPoint, sizeof(float3));
+	memcpy(cursor + sizeof(float3), &bounding_box.maxPoint, sizeof(float3));
+
 	FileData mesh_data {data, size};
 	return mesh_data;
 }
\ No newline at end of file
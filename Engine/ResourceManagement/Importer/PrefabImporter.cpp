@@ -4,6 +4,7 @@
 #include "Component/ComponentMeshRenderer.h"
 #include "Component/ComponentTransform.h"
 #include "Helper/Config.h"
+#include "Helper/ConfigWriter.h"
 
 #include "Main/Application.h"
 #include "Module/ModuleFileSystem.h"
@@ -54,7 +55,9 @@ FileData PrefabImporter::ExtractFromModel(const Config& model_config, const Mode
 
 FileData PrefabImporter::ExtractFromGameObject(GameObject* gameobject, bool overwritable) const
 {
-	std::vector<Config> gameobjects_config;
+	ConfigWriter prefab_writer;
+	prefab_writer.StartArray("GameObjects");
+
 	std::queue<GameObject*> pending_gameobjects;
 	pending_gameobjects.push(gameobject);
 
@@ -65,7 +68,7 @@ FileData PrefabImporter::ExtractFromGameObject(GameObject* gameobject, bool over
 
 		Config current_gameobject_config;
 		current_gameobject->Save(current_gameobject_config);
-		gameobjects_config.push_back(current_gameobject_config);
+		prefab_writer.Add(current_gameobject_config);
 
 		for (auto& child_gameobject : current_gameobject->children)
 		{
@@ -73,18 +76,9 @@ FileData PrefabImporter::ExtractFromGameObject(GameObject* gameobject, bool over
 		}
 	}
 
-	Config prefab_config;
-	prefab_config.AddChildrenConfig(gameobjects_config, "GameObjects");
-
-	std::string serialized_prefab_string;
-	prefab_config.AddBool(overwritable, "Overwritable");
-	prefab_config.GetSerializedString(serialized_prefab_string);
-
-	char* prefab_bytes = new char[serialized_prefab_string.size() + 1];
-	memcpy(prefab_bytes, serialized_prefab_string.c_str(), serialized_prefab_string.size() + 1);
-
-	FileData prefab_data{ prefab_bytes, serialized_prefab_string.size() + 1 };
-	return prefab_data;
+	prefab_writer.EndArray();
+	prefab_writer.AddBool(overwritable, "Overwritable");
+	return prefab_writer.Finish();
 }
 
 void PrefabImporter::ExtractGameObjectFromNode
@@ -143,7 +137,7 @@ void PrefabImporter::ExtractMeshComponent(
 	GameObject* node_game_object
 ) {
 	mesh_renderer_components.emplace_back(std::make_unique<ComponentMeshRenderer>(node_game_object));
-	node_game_object->components.push_back(mesh_renderer_components.back().get());
+	node_game_object->AddComponent(mesh_renderer_components.back().get());
 
 	mesh_renderer_components.back()->mesh_uuid = mesh_uuid;
 	mesh_renderer_components.back()->material_uuid = material_uuid;
@@ -157,7 +151,7 @@ void PrefabImporter::ExtractAnimationComponent(GameObject* node_game_object, con
 	if (animation_config.size() > 0)
 	{
 		ComponentAnimation * component_animation = new ComponentAnimation();
-		node_game_object->components.push_back(component_animation);
 		component_animation->owner = node_game_object;
+		node_game_object->AddComponent(component_animation);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,16 @@
+#include "SceneImporter.h"
+
+#include "Filesystem/Path.h"
+#include "Main/WorldPartition.h"
+#include "ResourceManagement/Manager/SceneManager.h"
+#include "ResourceManagement/Metafile/Metafile.h"
+#include "ResourceManagement/Resources/Scene.h"
+
+// The scene is exported as it is, along with the world partition cells written next to it
+FileData SceneImporter::ExtractData(Path& assets_file_path, const Metafile& metafile) const
+{
+	FileData scene_data = assets_file_path.GetFile()->Load();
+	std::shared_ptr<Scene> scene = SceneManager::Load(metafile.uuid, scene_data);
+	WorldPartition::ExportCells(*scene, assets_file_path.GetFullPath());
+	return scene_data;
+}
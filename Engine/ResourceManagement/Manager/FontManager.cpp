@@ -38,8 +38,12 @@ std::shared_ptr<Font> FontManager::Load(uint32_t uuid, const FileData& resource_
 	//FT_Set_Pixel_Sizes(face, 0, 16);
 	FT_Set_Pixel_Sizes(face, 0, 64);
 
-	// Disable byte-alignment restriction
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	bool upload_glyphs = !App->IsHeadless(); // Headless runtime keeps the glyph metrics so text layout still works
+	if (upload_glyphs)
+	{
+		// Disable byte-alignment restriction
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	}
 	
 	for (GLubyte character = 0; character < 128; character++)
 	{
@@ -49,25 +53,29 @@ std::shared_ptr<Font> FontManager::Load(uint32_t uuid, const FileData& resource_
 			continue;
 		}
 
-		GLuint glyph_texture;
-		glGenTextures(1, &glyph_texture);
-		glBindTexture(GL_TEXTURE_2D, glyph_texture);
-		glTexImage2D(
-			GL_TEXTURE_2D,
-			0,
-			GL_RED,
-			face->glyph->bitmap.width,
-			face->glyph->bitmap.rows,
-			0,
-			GL_RED,
-			GL_UNSIGNED_BYTE,
-			face->glyph->bitmap.buffer
-		);
+		GLuint glyph_texture = 0;
+		if (upload_glyphs)
+		{
+			glGenTextures(1, &glyph_texture);
+			glBindTexture(GL_TEXTURE_2D, glyph_texture);
+			glTexImage2D(
+				GL_TEXTURE_2D,
+				0,
+				GL_RED,
+				face->glyph->bitmap.width,
+				face->glyph->bitmap.rows,
+				0,
+				GL_RED,
+				GL_UNSIGNED_BYTE,
+				face->glyph->bitmap.buffer
+			);
 
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glBindTexture(GL_TEXTURE_2D, 0);
+		}
 
 		Font::Character loaded_character
 		{
@@ -77,7 +85,6 @@ std::shared_ptr<Font> FontManager::Load(uint32_t uuid, const FileData& resource_
 			face->glyph->advance.x
 		};
 		font_characters.insert(std::pair<GLchar, Font::Character>(character, loaded_character));
-		glBindTexture(GL_TEXTURE_2D, 0);
 	}
 
 	std::shared_ptr<Font> loaded_font = std::make_shared<Font>(uuid, font_characters);
@@ -0,0 +1,160 @@
+#include "GameObjectDescriptor.h"
+
+#include "ResourceManagement/Manager/SceneBinary.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+void GameObjectDescriptor::Parse(const Config& config)
+{
+	UUID = config.GetUInt("UUID", 0);
+	parent_UUID = config.GetUInt("ParentUUID", 0);
+
+	config.GetString("Name", name, "GameObject");
+	config.GetString("Tag", tag, "");
+	is_static = config.GetBool("IsStatic", false);
+	active = config.GetBool("Active", true);
+
+	Config transform_config;
+	config.GetChildConfig("Transform", transform_config);
+	transform_UUID = transform_config.GetUInt("UUID", 0);
+	transform_active = transform_config.GetBool("Active", true);
+	transform_config.GetFloat3("Translation", translation, float3::zero);
+	transform_config.GetFloat3("Rotation", rotation, float3::zero);
+	transform_config.GetFloat3("Scale", scale, float3::one);
+
+	config.GetChildConfig("Transform2D", transform_2d_config);
+	transform_2d_enabled = config.GetBool("Transform2DEnabled", false);
+
+	std::vector<Config> components_config;
+	config.GetChildrenConfig("Components", components_config);
+	components.clear();
+	components.reserve(components_config.size());
+	resources.clear();
+	for (auto& component_config : components_config)
+	{
+		ComponentDescriptor component;
+		component.type = static_cast<Component::ComponentType>(component_config.GetUInt("ComponentType", 0));
+		component.UUID = component_config.GetUInt("UUID", 0);
+		component.active = component_config.GetBool("Active", true);
+		component.collider_type = component_config.GetUInt32("ColliderType", 0);
+		GatherResources(component_config.GetValue(), resources);
+		component.config = std::move(component_config);
+		components.push_back(std::move(component));
+	}
+}
+
+bool GameObjectDescriptor::Parse(const SceneBinary& scene_binary, size_t game_object_index)
+{
+	const SceneBinary::GameObjectRecord& game_object_record = scene_binary.GetGameObject(game_object_index);
+	UUID = game_object_record.UUID;
+	parent_UUID = game_object_record.parent_UUID;
+
+	name = scene_binary.GetString(game_object_record.name);
+	tag = scene_binary.GetString(game_object_record.tag);
+	is_static = game_object_record.is_static != 0;
+	active = game_object_record.active != 0;
+
+	transform_UUID = game_object_record.transform_UUID;
+	transform_active = game_object_record.transform_active != 0;
+	translation = float3(game_object_record.translation);
+	rotation = float3(game_object_record.rotation);
+	scale = float3(game_object_record.scale);
+
+	if (!scene_binary.ReadConfig(game_object_record.transform_2d, transform_2d_config))
+	{
+		return false;
+	}
+	transform_2d_enabled = game_object_record.transform_2d_enabled != 0;
+
+	components.clear();
+	components.resize(game_object_record.num_components);
+	resources.clear();
+	for (uint32_t i = 0; i < game_object_record.num_components; ++i)
+	{
+		const SceneBinary::ComponentRecord& component_record = scene_binary.GetComponent(game_object_record.first_component + i);
+		ComponentDescriptor& component = components[i];
+		component.type = static_cast<Component::ComponentType>(component_record.type);
+		component.UUID = component_record.UUID;
+		component.collider_type = component_record.collider_type;
+		component.active = component_record.active != 0;
+		component.from_record = component_record.data == SceneBinary::NONE && component.type == Component::ComponentType::MESH_RENDERER;
+		if (component.from_record)
+		{
+			component.mesh_renderer = component_record.mesh_renderer;
+			for (uint32_t resource_uuid : { component.mesh_renderer.mesh_uuid, component.mesh_renderer.material_uuid, component.mesh_renderer.skeleton_uuid })
+			{
+				if (resource_uuid != 0)
+				{
+					resources.push_back(resource_uuid);
+				}
+			}
+			continue;
+		}
+
+		if (!scene_binary.ReadConfig(component_record.data, component.config))
+		{
+			return false;
+		}
+		GatherResources(component.config.GetValue(), resources);
+	}
+	return true;
+}
+
+// Compares the saved state of a live component with the descriptor, members of a fixed record are compared one by one
+bool GameObjectDescriptor::ComponentDescriptor::Matches(const Config& component_config) const
+{
+	if (!from_record)
+	{
+		return component_config.GetValue() == config.GetValue();
+	}
+
+	return component_config.GetValue().MemberCount() == 7
+		&& component_config.GetUInt("UUID", 0) == UUID
+		&& component_config.GetUInt("ComponentType", 0) == static_cast<uint64_t>(type)
+		&& component_config.GetBool("Active", true) == active
+		&& component_config.GetUInt32("Mesh", 0) == mesh_renderer.mesh_uuid
+		&& component_config.GetUInt32("Material", 0) == mesh_renderer.material_uuid
+		&& component_config.GetUInt32("Skeleton", 0) == mesh_renderer.skeleton_uuid
+		&& component_config.GetInt("Properties", 0) == mesh_renderer.properties;
+}
+
+// Resources are referenced by 32 bit UUIDs stored in members named like "MeshUUID" or "TextureUUID",
+// older components name them after the resource instead
+void GameObjectDescriptor::GatherResources(const rapidjson::Value& value, std::vector<uint32_t>& resources)
+{
+	static const std::string_view resource_members[] = { "Mesh", "Material", "Skeleton", "Skybox", "StateMachineResource", "SoundBank" };
+
+	if (value.IsArray())
+	{
+		for (const auto& element : value.GetArray())
+		{
+			GatherResources(element, resources);
+		}
+		return;
+	}
+
+	if (!value.IsObject())
+	{
+		return;
+	}
+
+	const std::string_view uuid_suffix = "UUID";
+	for (const auto& member : value.GetObject())
+	{
+		std::string_view member_name(member.name.GetString(), member.name.GetStringLength());
+		bool is_resource = (member_name.size() > uuid_suffix.size()
+			&& member_name.compare(member_name.size() - uuid_suffix.size(), uuid_suffix.size(), uuid_suffix) == 0
+			&& member_name != "ParentUUID")
+			|| std::find(std::begin(resource_members), std::end(resource_members), member_name) != std::end(resource_members);
+		if (is_resource && member.value.IsUint64() && member.value.GetUint64() != 0 && member.value.GetUint64() <= UINT32_MAX)
+		{
+			resources.push_back(static_cast<uint32_t>(member.value.GetUint64()));
+		}
+		else if (member.value.IsObject() || member.value.IsArray())
+		{
+			GatherResources(member.value, resources);
+		}
+	}
+}
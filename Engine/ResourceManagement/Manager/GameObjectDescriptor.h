@@ -0,0 +1,63 @@
+#ifndef _GAMEOBJECTDESCRIPTOR_H_
+#define _GAMEOBJECTDESCRIPTOR_H_
+
+#include "Component/Component.h"
+#include "Helper/Config.h"
+#include "ResourceManagement/Manager/SceneBinary.h"
+
+#include <MathGeoLib.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+	A saved game object parsed into plain data, without touching the scene.
+	Parse only reads its input, so every game object of a scene can be parsed in parallel.
+	Components are created and loaded from their Config, or from their fixed record for binary mesh renderers,
+	once the game object is linked into the scene, see GameObject::Load.
+*/
+struct GameObjectDescriptor
+{
+	static const size_t NO_PARENT = SIZE_MAX;
+
+	struct ComponentDescriptor
+	{
+		bool Matches(const Config& component_config) const;
+
+		Component::ComponentType type{};
+		uint64_t UUID = 0;
+		uint32_t collider_type = 0;
+		bool active = true;
+		bool from_record = false; // Loaded from mesh_renderer, config is empty
+		SceneBinary::MeshRendererRecord mesh_renderer;
+		Config config;
+	};
+
+	void Parse(const Config& config);
+	bool Parse(const SceneBinary& scene_binary, size_t game_object_index); // False when a value tree of the game object is out of range
+
+	static void GatherResources(const rapidjson::Value& value, std::vector<uint32_t>& resources);
+
+	uint64_t UUID = 0;
+	uint64_t parent_UUID = 0;
+	size_t parent_index = NO_PARENT; // Position of the parent among the descriptors of the same scene
+
+	std::string name;
+	std::string tag;
+	bool is_static = false;
+	bool active = true;
+
+	uint64_t transform_UUID = 0;
+	bool transform_active = true;
+	float3 translation = float3::zero;
+	float3 rotation = float3::zero; // Degrees
+	float3 scale = float3::one;
+
+	bool transform_2d_enabled = false;
+	Config transform_2d_config;
+
+	std::vector<ComponentDescriptor> components;
+	std::vector<uint32_t> resources; // Resources the components reference, candidates for prefetching
+};
+
+#endif // _GAMEOBJECTDESCRIPTOR_H_
@@ -26,15 +26,11 @@ FileData MaterialManager::Binarize(Material* material)
 	return material_data;
 }
 
-std::shared_ptr<Material> MaterialManager::Load(uint32_t uuid, const FileData& resource_data)
+std::shared_ptr<Material> MaterialManager::Load(uint32_t uuid, const FileData& resource_data, bool load_textures)
 {
-	char* material_file_data = (char*)resource_data.buffer;
-
-	std::string serialized_material_string = std::string(material_file_data, resource_data.size);
-
-	Config material_config(serialized_material_string);
+	Config material_config(static_cast<const char*>(resource_data.buffer), resource_data.size);
 	std::shared_ptr<Material> new_material = std::make_shared<Material>(uuid);
-	new_material->Load(material_config);
+	new_material->Load(material_config, load_textures);
 
 	return new_material;
 }
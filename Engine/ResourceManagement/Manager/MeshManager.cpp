@@ -40,7 +40,20 @@ std::shared_ptr<Mesh> MeshManager::Load(uint32_t uuid, const FileData& resource_
 	bytes = sizeof(Mesh::Vertex) * ranges[1];
 	memcpy(&vertices.front(), cursor, bytes);
 
-	std::shared_ptr<Mesh> new_mesh = std::make_shared<Mesh>(uuid, std::move(vertices), std::move(indices), async);
+	cursor += bytes; // Get bounding box. Binaries imported before it was stored need to compute it
+	AABB bounding_box;
+	bytes = sizeof(float3) * 2;
+	if (static_cast<size_t>(cursor - data) + bytes <= resource_data.size)
+	{
+		memcpy(&bounding_box.minPoint, cursor, sizeof(float3));
+		memcpy(&bounding_box.maxPoint, cursor + sizeof(float3), sizeof(float3));
+	}
+	else
+	{
+		bounding_box = Mesh::ComputeBoundingBox(vertices);
+	}
+
+	std::shared_ptr<Mesh> new_mesh = std::make_shared<Mesh>(uuid, std::move(vertices), std::move(indices), bounding_box, async);
 
 	float time = timer.Stop();
 	App->resources->time_loading_meshes += time;
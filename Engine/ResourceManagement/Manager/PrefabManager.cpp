@@ -44,10 +44,7 @@ FileData PrefabManager::Binarize(Prefab* prefab)
 
 std::shared_ptr<Prefab> PrefabManager::Load(uint32_t uuid, const FileData& resource_data)
 {
-	char* prefab_file_data = (char*)resource_data.buffer;
-
-	std::string serialized_prefab_string = prefab_file_data;
-	Config scene_config(serialized_prefab_string);
+	Config scene_config(static_cast<const char*>(resource_data.buffer), resource_data.size);
 
 	std::vector<Config> game_objects_config;
 	scene_config.GetChildrenConfig("GameObjects", game_objects_config);
@@ -56,7 +53,7 @@ std::shared_ptr<Prefab> PrefabManager::Load(uint32_t uuid, const FileData& resou
 	gameObjects.reserve(game_objects_config.size());	
 	
 	bool overwritable = true;
-	if (scene_config.config_document.HasMember("Overwritable"))
+	if (scene_config.HasMember("Overwritable"))
 	{
 		overwritable = scene_config.GetBool("Overwritable", true);
 	}
@@ -215,7 +212,7 @@ void PrefabManager::CreateComponents(const Config& config, std::unique_ptr<GameO
 			created_component->owner = loaded_gameObject.get();
 			created_component->Init();
 			created_component->Load(gameobject_components_config[i]);
-			loaded_gameObject->components.push_back(created_component);
+			loaded_gameObject->AddComponent(created_component);
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,673 @@
+#include "SceneBinary.h"
+
+#include "Component/Component.h"
+#include "Helper/Config.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+namespace
+{
+	const size_t SECTION_ALIGNMENT = 8;
+
+	size_t Align(size_t position)
+	{
+		return (position + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+	}
+
+	const rapidjson::Value* FindMember(const rapidjson::Value& object_value, const char* name)
+	{
+		if (!object_value.IsObject())
+		{
+			return nullptr;
+		}
+		auto member = object_value.FindMember(name);
+		return member == object_value.MemberEnd() ? nullptr : &member->value;
+	}
+
+	uint64_t GetUInt(const rapidjson::Value& object_value, const char* name, uint64_t opt_value)
+	{
+		const rapidjson::Value* value = FindMember(object_value, name);
+		return value != nullptr && value->IsUint64() ? value->GetUint64() : opt_value;
+	}
+
+	bool GetBool(const rapidjson::Value& object_value, const char* name, bool opt_value)
+	{
+		const rapidjson::Value* value = FindMember(object_value, name);
+		return value != nullptr && value->IsBool() ? value->GetBool() : opt_value;
+	}
+
+	void GetFloats(const rapidjson::Value& object_value, const char* name, float* return_value, size_t count)
+	{
+		const rapidjson::Value* value = FindMember(object_value, name);
+		if (value == nullptr || !value->IsArray() || value->Size() < count)
+		{
+			return;
+		}
+		for (size_t i = 0; i < count; ++i)
+		{
+			return_value[i] = (*value)[static_cast<rapidjson::SizeType>(i)].GetFloat();
+		}
+	}
+}
+
+SceneBinary::SceneBinary(const char* buffer, size_t size) : buffer(buffer), size(size)
+{
+	valid = IsBinaryScene(buffer, size) && Validate();
+}
+
+bool SceneBinary::IsBinaryScene(const void* buffer, size_t size)
+{
+	if (buffer == nullptr || size < sizeof(Header))
+	{
+		return false;
+	}
+
+	const Header* header = static_cast<const Header*>(buffer);
+	return header->magic == MAGIC && header->version == VERSION;
+}
+
+FileData SceneBinary::Convert(const Config& scene_config)
+{
+	Writer writer;
+	for (const auto& array_name : { "Prefabs", "PrefabsComponents", "GameObjects" })
+	{
+		if (!scene_config.HasMember(array_name))
+		{
+			continue;
+		}
+
+		std::vector<Config> elements_config;
+		scene_config.GetChildrenConfig(array_name, elements_config);
+		writer.StartArray(array_name);
+		for (const auto& element_config : elements_config)
+		{
+			writer.Add(element_config);
+		}
+		writer.EndArray();
+	}
+	writer.AddMembers(scene_config);
+	return writer.Finish();
+}
+
+bool SceneBinary::IsValid() const
+{
+	return valid;
+}
+
+const SceneBinary::Header& SceneBinary::GetHeader() const
+{
+	return *reinterpret_cast<const Header*>(buffer);
+}
+
+size_t SceneBinary::GetNumGameObjects() const
+{
+	return GetHeader().num_game_objects;
+}
+
+// Records are read with plain indexing afterwards, so every index and offset they hold is checked here
+bool SceneBinary::Validate() const
+{
+	const Header& header = GetHeader();
+	if (header.size > size
+		|| !IsValidRange(header.strings_offset, header.num_strings, sizeof(String))
+		|| !IsValidRange(header.game_objects_offset, header.num_game_objects, sizeof(GameObjectRecord))
+		|| !IsValidRange(header.components_offset, header.num_components, sizeof(ComponentRecord))
+		|| !IsValidRange(header.values_offset, header.values_size, 1))
+	{
+		return false;
+	}
+
+	const String* strings = reinterpret_cast<const String*>(buffer + header.strings_offset);
+	for (uint32_t i = 0; i < header.num_strings; ++i)
+	{
+		if (!IsValidRange(strings[i].offset, static_cast<uint64_t>(strings[i].size) + 1, 1) || buffer[strings[i].offset + strings[i].size] != '\0')
+		{
+			return false;
+		}
+	}
+
+	const GameObjectRecord* game_objects = reinterpret_cast<const GameObjectRecord*>(buffer + header.game_objects_offset);
+	for (uint32_t i = 0; i < header.num_game_objects; ++i)
+	{
+		const GameObjectRecord& game_object = game_objects[i];
+		if (game_object.name >= header.num_strings || game_object.tag >= header.num_strings
+			|| static_cast<uint64_t>(game_object.first_component) + game_object.num_components > header.num_components
+			|| !IsValidValueOffset(game_object.transform_2d))
+		{
+			return false;
+		}
+	}
+
+	const ComponentRecord* components = reinterpret_cast<const ComponentRecord*>(buffer + header.components_offset);
+	for (uint32_t i = 0; i < header.num_components; ++i)
+	{
+		if (!IsValidValueOffset(components[i].data))
+		{
+			return false;
+		}
+	}
+
+	return IsValidValueOffset(header.prefabs) && IsValidValueOffset(header.prefabs_components)
+		&& IsValidValueOffset(header.dependencies) && IsValidValueOffset(header.world_partition);
+}
+
+bool SceneBinary::IsValidValueOffset(uint32_t value_offset) const
+{
+	return value_offset == NONE || (value_offset % alignof(Value) == 0 && static_cast<uint64_t>(value_offset) + sizeof(Value) <= GetHeader().values_size);
+}
+
+bool SceneBinary::IsValidRange(uint64_t offset, uint64_t count, size_t element_size) const
+{
+	return count <= size / element_size && offset <= size - count * element_size;
+}
+
+bool SceneBinary::IsValidElements(const Value& value, size_t element_size) const
+{
+	const uint64_t values_size = GetHeader().values_size;
+	return value.offset % alignof(Value) == 0 && value.offset <= values_size && value.size * static_cast<uint64_t>(element_size) <= values_size - value.offset;
+}
+
+const SceneBinary::GameObjectRecord& SceneBinary::GetGameObject(size_t index) const
+{
+	return reinterpret_cast<const GameObjectRecord*>(buffer + GetHeader().game_objects_offset)[index];
+}
+
+const SceneBinary::ComponentRecord& SceneBinary::GetComponent(size_t index) const
+{
+	return reinterpret_cast<const ComponentRecord*>(buffer + GetHeader().components_offset)[index];
+}
+
+const char* SceneBinary::GetString(uint32_t index) const
+{
+	if (index >= GetHeader().num_strings)
+	{
+		return "";
+	}
+	const String& string = reinterpret_cast<const String*>(buffer + GetHeader().strings_offset)[index];
+	return buffer + string.offset;
+}
+
+bool SceneBinary::ReadConfig(uint32_t value_offset, Config& config) const
+{
+	config = Config();
+	if (value_offset == NONE)
+	{
+		return true;
+	}
+
+	const Value* value = GetValue(value_offset);
+	return value != nullptr && ReadValue(*value, config.config_document, config.GetAllocator(), 0);
+}
+
+bool SceneBinary::ReadConfigs(uint32_t value_offset, std::vector<Config>& configs) const
+{
+	configs.clear();
+	if (value_offset == NONE)
+	{
+		return true;
+	}
+
+	const Value* array_value = GetValue(value_offset);
+	if (array_value == nullptr || array_value->type != ValueType::ARRAY || !IsValidElements(*array_value, sizeof(Value)))
+	{
+		return false;
+	}
+
+	configs = std::vector<Config>(array_value->size);
+	const Value* elements = reinterpret_cast<const Value*>(buffer + GetHeader().values_offset + array_value->offset);
+	for (uint32_t i = 0; i < array_value->size; ++i)
+	{
+		if (!ReadValue(elements[i], configs[i].config_document, configs[i].GetAllocator(), 1))
+		{
+			configs.clear();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool SceneBinary::ReadUInts(uint32_t value_offset, std::vector<uint32_t>& uints) const
+{
+	uints.clear();
+	if (value_offset == NONE)
+	{
+		return true;
+	}
+
+	const Value* array_value = GetValue(value_offset);
+	if (array_value == nullptr || array_value->type != ValueType::ARRAY || !IsValidElements(*array_value, sizeof(Value)))
+	{
+		return false;
+	}
+
+	uints.reserve(array_value->size);
+	const Value* elements = reinterpret_cast<const Value*>(buffer + GetHeader().values_offset + array_value->offset);
+	for (uint32_t i = 0; i < array_value->size; ++i)
+	{
+		if (elements[i].type != ValueType::UINT || elements[i].uint_value > UINT32_MAX)
+		{
+			uints.clear();
+			return false;
+		}
+		uints.push_back(static_cast<uint32_t>(elements[i].uint_value));
+	}
+	return true;
+}
+
+const SceneBinary::Value* SceneBinary::GetValue(uint32_t value_offset) const
+{
+	if (value_offset == NONE || !IsValidValueOffset(value_offset))
+	{
+		return nullptr;
+	}
+	return reinterpret_cast<const Value*>(buffer + GetHeader().values_offset + value_offset);
+}
+
+bool SceneBinary::ReadValue(const Value& value, rapidjson::Value& read_value, rapidjson::Document::AllocatorType& allocator, size_t depth) const
+{
+	const Header& header = GetHeader();
+	const String* strings = reinterpret_cast<const String*>(buffer + header.strings_offset);
+	switch (value.type)
+	{
+	case ValueType::NULL_VALUE:
+		read_value.SetNull();
+		return true;
+
+	case ValueType::FALSE_VALUE:
+		read_value.SetBool(false);
+		return true;
+
+	case ValueType::TRUE_VALUE:
+		read_value.SetBool(true);
+		return true;
+
+	case ValueType::INT:
+		read_value.SetInt64(value.int_value);
+		return true;
+
+	case ValueType::UINT:
+		read_value.SetUint64(value.uint_value);
+		return true;
+
+	case ValueType::DOUBLE:
+		read_value.SetDouble(value.double_value);
+		return true;
+
+	case ValueType::STRING:
+		if (value.size >= header.num_strings)
+		{
+			return false;
+		}
+		read_value.SetString(buffer + strings[value.size].offset, strings[value.size].size, allocator);
+		return true;
+
+	case ValueType::ARRAY:
+	{
+		if (depth >= MAX_VALUE_DEPTH || !IsValidElements(value, sizeof(Value)))
+		{
+			return false;
+		}
+
+		read_value.SetArray();
+		read_value.Reserve(value.size, allocator);
+		const Value* elements = reinterpret_cast<const Value*>(buffer + header.values_offset + value.offset);
+		for (uint32_t i = 0; i < value.size; ++i)
+		{
+			rapidjson::Value element;
+			if (!ReadValue(elements[i], element, allocator, depth + 1))
+			{
+				return false;
+			}
+			read_value.PushBack(element, allocator);
+		}
+		return true;
+	}
+
+	case ValueType::OBJECT:
+	{
+		if (depth >= MAX_VALUE_DEPTH || !IsValidElements(value, sizeof(Member)))
+		{
+			return false;
+		}
+
+		read_value.SetObject();
+		const Member* members = reinterpret_cast<const Member*>(buffer + header.values_offset + value.offset);
+		for (uint32_t i = 0; i < value.size; ++i)
+		{
+			if (members[i].name >= header.num_strings)
+			{
+				return false;
+			}
+			const String& name = strings[members[i].name];
+			rapidjson::Value member_name(buffer + name.offset, name.size, allocator);
+			rapidjson::Value member_value;
+			if (!ReadValue(members[i].value, member_value, allocator, depth + 1))
+			{
+				return false;
+			}
+			read_value.AddMember(member_name, member_value, allocator);
+		}
+		return true;
+	}
+
+	default:
+		return false;
+	}
+}
+
+SceneBinary::Writer::Writer()
+{
+	array_document.SetArray();
+}
+
+void SceneBinary::Writer::StartArray(const std::string& name)
+{
+	assert(current_array == Array::NONE);
+	if (name == "Prefabs")
+	{
+		current_array = Array::PREFABS;
+	}
+	else if (name == "PrefabsComponents")
+	{
+		current_array = Array::PREFABS_COMPONENTS;
+	}
+	else
+	{
+		assert(name == "GameObjects");
+		current_array = Array::GAME_OBJECTS;
+	}
+}
+
+void SceneBinary::Writer::Add(const Config& element)
+{
+	if (current_array == Array::GAME_OBJECTS)
+	{
+		AddGameObject(element.GetValue());
+		return;
+	}
+
+	rapidjson::Value element_value(element.GetValue(), array_document.GetAllocator());
+	array_document.PushBack(element_value, array_document.GetAllocator());
+}
+
+void SceneBinary::Writer::EndArray()
+{
+	if (current_array == Array::PREFABS)
+	{
+		header.prefabs = AddValue(array_document);
+	}
+	else if (current_array == Array::PREFABS_COMPONENTS)
+	{
+		header.prefabs_components = AddValue(array_document);
+	}
+
+	array_document.SetArray();
+	current_array = Array::NONE;
+}
+
+void SceneBinary::Writer::AddMembers(const Config& config)
+{
+	const rapidjson::Value& scene_value = config.GetValue();
+
+	const rapidjson::Value* dependencies_value = FindMember(scene_value, "Dependencies");
+	if (dependencies_value != nullptr && dependencies_value->IsArray())
+	{
+		header.dependencies = AddValue(*dependencies_value);
+	}
+
+	const rapidjson::Value* world_partition_value = FindMember(scene_value, "WorldPartition");
+	if (world_partition_value != nullptr && world_partition_value->IsObject())
+	{
+		header.world_partition = AddValue(*world_partition_value);
+	}
+
+	SettingsRecord& settings = header.settings;
+	settings.ambient_light_intensity = config.GetFloat("Ambiental Light Intensity", 1.f);
+	GetFloats(scene_value, "Ambiental Light Color", settings.ambient_light_color, 4);
+	settings.shadows = config.GetBool("Shadows", true);
+	settings.hdr = config.GetBool("HDR", true);
+	settings.bloom = config.GetBool("Bloom", true);
+	settings.amount_of_blur = config.GetInt("Amount of Blur", 10);
+	settings.exposure = config.GetFloat("Exposure", 1.f);
+	settings.fog = config.GetBool("Fog", false);
+	settings.fog_density = config.GetFloat("Fog Density", 1.f);
+	GetFloats(scene_value, "Fog Color", settings.fog_color, 4);
+}
+
+FileData SceneBinary::Writer::Finish()
+{
+	assert(current_array == Array::NONE);
+
+	size_t file_size = Align(sizeof(Header));
+	header.game_objects_offset = static_cast<uint32_t>(file_size);
+	header.num_game_objects = static_cast<uint32_t>(game_objects.size());
+	file_size = Align(file_size + game_objects.size() * sizeof(GameObjectRecord));
+
+	header.components_offset = static_cast<uint32_t>(file_size);
+	header.num_components = static_cast<uint32_t>(components.size());
+	file_size = Align(file_size + components.size() * sizeof(ComponentRecord));
+
+	header.strings_offset = static_cast<uint32_t>(file_size);
+	header.num_strings = static_cast<uint32_t>(strings.size());
+	file_size += strings.size() * sizeof(String);
+	size_t string_data_offset = file_size;
+	for (const auto& string : strings)
+	{
+		file_size += string.size() + 1;
+	}
+	file_size = Align(file_size);
+
+	header.values_offset = static_cast<uint32_t>(file_size);
+	header.values_size = static_cast<uint32_t>(values.size());
+	file_size += values.size();
+	header.size = static_cast<uint32_t>(file_size);
+
+	char* scene_bytes = new char[file_size];
+	memset(scene_bytes, 0, file_size);
+	memcpy(scene_bytes, &header, sizeof(Header));
+	if (!game_objects.empty())
+	{
+		memcpy(scene_bytes + header.game_objects_offset, game_objects.data(), game_objects.size() * sizeof(GameObjectRecord));
+	}
+	if (!components.empty())
+	{
+		memcpy(scene_bytes + header.components_offset, components.data(), components.size() * sizeof(ComponentRecord));
+	}
+
+	String* string_records = reinterpret_cast<String*>(scene_bytes + header.strings_offset);
+	for (size_t i = 0; i < strings.size(); ++i)
+	{
+		string_records[i].offset = static_cast<uint32_t>(string_data_offset);
+		string_records[i].size = static_cast<uint32_t>(strings[i].size());
+		memcpy(scene_bytes + string_data_offset, strings[i].c_str(), strings[i].size() + 1);
+		string_data_offset += strings[i].size() + 1;
+	}
+
+	if (!values.empty())
+	{
+		memcpy(scene_bytes + header.values_offset, values.data(), values.size());
+	}
+
+	return FileData{ scene_bytes, static_cast<unsigned int>(file_size) };
+}
+
+uint32_t SceneBinary::Writer::AddString(const std::string& string)
+{
+	auto found = string_indices.find(string);
+	if (found != string_indices.end())
+	{
+		return found->second;
+	}
+
+	uint32_t index = static_cast<uint32_t>(strings.size());
+	strings.push_back(string);
+	string_indices[string] = index;
+	return index;
+}
+
+uint32_t SceneBinary::Writer::AddValue(const rapidjson::Value& value)
+{
+	size_t value_position = Allocate(sizeof(Value));
+	WriteValue(value, value_position);
+	return static_cast<uint32_t>(value_position);
+}
+
+void SceneBinary::Writer::WriteValue(const rapidjson::Value& value, size_t value_position)
+{
+	Value written_value;
+	if (value.IsNull())
+	{
+		written_value.type = ValueType::NULL_VALUE;
+	}
+	else if (value.IsBool())
+	{
+		written_value.type = value.GetBool() ? ValueType::TRUE_VALUE : ValueType::FALSE_VALUE;
+	}
+	else if (value.IsDouble())
+	{
+		written_value.type = ValueType::DOUBLE;
+		written_value.double_value = value.GetDouble();
+	}
+	else if (value.IsUint64())
+	{
+		written_value.type = ValueType::UINT;
+		written_value.uint_value = value.GetUint64();
+	}
+	else if (value.IsInt64())
+	{
+		written_value.type = ValueType::INT;
+		written_value.int_value = value.GetInt64();
+	}
+	else if (value.IsString())
+	{
+		written_value.type = ValueType::STRING;
+		written_value.size = AddString(std::string(value.GetString(), value.GetStringLength()));
+	}
+	else if (value.IsArray())
+	{
+		written_value.type = ValueType::ARRAY;
+		written_value.size = value.Size();
+		written_value.offset = Allocate(value.Size() * sizeof(Value));
+	}
+	else
+	{
+		written_value.type = ValueType::OBJECT;
+		written_value.size = value.MemberCount();
+		written_value.offset = Allocate(value.MemberCount() * sizeof(Member));
+	}
+
+	// Children are written after their parent, allocating them may move the values buffer
+	memcpy(values.data() + value_position, &written_value, sizeof(Value));
+	if (written_value.type == ValueType::ARRAY)
+	{
+		size_t element_position = static_cast<size_t>(written_value.offset);
+		for (const auto& element : value.GetArray())
+		{
+			WriteValue(element, element_position);
+			element_position += sizeof(Value);
+		}
+	}
+	else if (written_value.type == ValueType::OBJECT)
+	{
+		size_t member_position = static_cast<size_t>(written_value.offset);
+		for (const auto& member : value.GetObject())
+		{
+			Member written_member;
+			written_member.name = AddString(std::string(member.name.GetString(), member.name.GetStringLength()));
+			memcpy(values.data() + member_position, &written_member, sizeof(Member));
+			WriteValue(member.value, member_position + offsetof(Member, value));
+			member_position += sizeof(Member);
+		}
+	}
+}
+
+size_t SceneBinary::Writer::Allocate(size_t size)
+{
+	size_t position = values.size();
+	values.resize(Align(position + size));
+	return position;
+}
+
+void SceneBinary::Writer::AddGameObject(const rapidjson::Value& game_object_value)
+{
+	GameObjectRecord game_object;
+	game_object.UUID = GetUInt(game_object_value, "UUID", 0);
+	game_object.parent_UUID = GetUInt(game_object_value, "ParentUUID", 0);
+
+	const rapidjson::Value* name_value = FindMember(game_object_value, "Name");
+	game_object.name = AddString(name_value != nullptr && name_value->IsString() ? name_value->GetString() : "GameObject");
+	const rapidjson::Value* tag_value = FindMember(game_object_value, "Tag");
+	game_object.tag = AddString(tag_value != nullptr && tag_value->IsString() ? tag_value->GetString() : "");
+
+	game_object.is_static = GetBool(game_object_value, "IsStatic", false);
+	game_object.active = GetBool(game_object_value, "Active", true);
+	game_object.transform_2d_enabled = GetBool(game_object_value, "Transform2DEnabled", false);
+
+	const rapidjson::Value* transform_value = FindMember(game_object_value, "Transform");
+	if (transform_value != nullptr)
+	{
+		game_object.transform_UUID = GetUInt(*transform_value, "UUID", 0);
+		game_object.transform_active = GetBool(*transform_value, "Active", true);
+		GetFloats(*transform_value, "Translation", game_object.translation, 3);
+		GetFloats(*transform_value, "Rotation", game_object.rotation, 3);
+		GetFloats(*transform_value, "Scale", game_object.scale, 3);
+	}
+
+	const rapidjson::Value* transform_2d_value = FindMember(game_object_value, "Transform2D");
+	game_object.transform_2d = transform_2d_value != nullptr ? AddValue(*transform_2d_value) : NONE;
+
+	game_object.first_component = static_cast<uint32_t>(components.size());
+	const rapidjson::Value* components_value = FindMember(game_object_value, "Components");
+	if (components_value != nullptr && components_value->IsArray())
+	{
+		for (const auto& component_value : components_value->GetArray())
+		{
+			ComponentRecord component;
+			component.UUID = GetUInt(component_value, "UUID", 0);
+			component.type = static_cast<uint32_t>(GetUInt(component_value, "ComponentType", 0));
+			component.collider_type = static_cast<uint32_t>(GetUInt(component_value, "ColliderType", 0));
+			component.active = GetBool(component_value, "Active", true);
+			bool fixed_record = component.type == static_cast<uint32_t>(Component::ComponentType::MESH_RENDERER) && AddMeshRenderer(component_value, component);
+			component.data = fixed_record ? NONE : AddValue(component_value);
+			components.push_back(component);
+		}
+	}
+	game_object.num_components = static_cast<uint32_t>(components.size()) - game_object.first_component;
+
+	game_objects.push_back(game_object);
+}
+
+// Only mesh renderers saved with exactly the members ComponentMeshRenderer writes go to the record, anything else keeps its value tree
+bool SceneBinary::Writer::AddMeshRenderer(const rapidjson::Value& component_value, ComponentRecord& component)
+{
+	if (!component_value.IsObject() || component_value.MemberCount() != 7)
+	{
+		return false;
+	}
+
+	const rapidjson::Value* UUID_value = FindMember(component_value, "UUID");
+	const rapidjson::Value* type_value = FindMember(component_value, "ComponentType");
+	const rapidjson::Value* active_value = FindMember(component_value, "Active");
+	const rapidjson::Value* properties_value = FindMember(component_value, "Properties");
+	if (UUID_value == nullptr || !UUID_value->IsUint64() || type_value == nullptr || !type_value->IsUint64()
+		|| active_value == nullptr || !active_value->IsBool() || properties_value == nullptr || !properties_value->IsInt())
+	{
+		return false;
+	}
+
+	uint32_t* resource_uuids[] = { &component.mesh_renderer.mesh_uuid, &component.mesh_renderer.material_uuid, &component.mesh_renderer.skeleton_uuid };
+	const char* resource_names[] = { "Mesh", "Material", "Skeleton" };
+	for (size_t i = 0; i < 3; ++i)
+	{
+		const rapidjson::Value* resource_value = FindMember(component_value, resource_names[i]);
+		if (resource_value == nullptr || !resource_value->IsUint())
+		{
+			return false;
+		}
+		*resource_uuids[i] = resource_value->GetUint();
+	}
+	component.mesh_renderer.properties = properties_value->GetInt();
+	return true;
+}
@@ -0,0 +1,224 @@
+#ifndef _SCENEBINARY_H_
+#define _SCENEBINARY_H_
+
+#include "Filesystem/File.h"
+
+#include <rapidjson/document.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Config;
+
+/*
+	Binary scene format, converted from the JSON scene at build time by SceneBinary::Convert. JSON stays the editor format.
+	Game objects, their transforms, component headers and mesh renderers are fixed layout records, strings live in a string table
+	and the remaining component data is a typed value tree. Section offsets are relative to the start of the file and value
+	offsets to the values section, so a loaded or mapped buffer is read in place, without parsing it first.
+	Records are checked against the sections once the buffer is opened, value trees as they are read. Nothing is trusted.
+*/
+class SceneBinary
+{
+public:
+	static const uint32_t MAGIC = 0x42534F4C; // "LOSB"
+	static const uint32_t VERSION = 4;
+	static const uint32_t NONE = UINT32_MAX;
+
+	enum class ValueType : uint8_t
+	{
+		NULL_VALUE,
+		FALSE_VALUE,
+		TRUE_VALUE,
+		INT,
+		UINT,
+		DOUBLE,
+		STRING,
+		ARRAY,
+		OBJECT
+	};
+
+	struct Value
+	{
+		ValueType type = ValueType::NULL_VALUE;
+		uint8_t padding[3] = {};
+		uint32_t size = 0; // String index, or number of elements or members
+		union
+		{
+			int64_t int_value = 0;
+			uint64_t uint_value;
+			double double_value;
+			uint64_t offset; // Elements (Value) or members (Member) of arrays and objects, relative to the values section
+		};
+	};
+
+	struct Member
+	{
+		uint32_t name = 0;
+		uint32_t padding = 0;
+		Value value;
+	};
+
+	struct String
+	{
+		uint32_t offset = 0;
+		uint32_t size = 0;
+	};
+
+	struct SettingsRecord
+	{
+		float ambient_light_intensity = 1.f;
+		float ambient_light_color[4] = { 1.f, 1.f, 1.f, 1.f };
+		float exposure = 1.f;
+		float fog_density = 1.f;
+		float fog_color[4] = { 0.f, 0.f, 0.f, 0.f };
+		int32_t amount_of_blur = 10;
+		uint8_t shadows = 1;
+		uint8_t hdr = 1;
+		uint8_t bloom = 1;
+		uint8_t fog = 0;
+	};
+
+	struct GameObjectRecord
+	{
+		uint64_t UUID = 0;
+		uint64_t parent_UUID = 0;
+		uint32_t name = 0;
+		uint32_t tag = 0;
+		uint8_t is_static = 0;
+		uint8_t active = 1;
+		uint8_t transform_active = 1;
+		uint8_t transform_2d_enabled = 0;
+		uint32_t transform_2d = NONE; // Object value
+		uint64_t transform_UUID = 0;
+		float translation[3] = { 0.f, 0.f, 0.f };
+		float rotation[3] = { 0.f, 0.f, 0.f }; // Degrees, as the JSON scene
+		float scale[3] = { 1.f, 1.f, 1.f };
+		uint32_t first_component = 0;
+		uint32_t num_components = 0;
+	};
+
+	struct MeshRendererRecord
+	{
+		uint32_t mesh_uuid = 0;
+		uint32_t material_uuid = 0;
+		uint32_t skeleton_uuid = 0;
+		int32_t properties = 0;
+	};
+
+	struct ComponentRecord
+	{
+		uint64_t UUID = 0;
+		uint32_t type = 0;
+		uint32_t collider_type = 0;
+		uint32_t data = NONE; // Object value with everything Component::Load reads, NONE for components kept in a fixed record
+		uint8_t active = 1;
+		uint8_t padding[3] = {};
+		MeshRendererRecord mesh_renderer; // Mesh renderers are most of the components of a scene, they are read without a DOM
+	};
+
+	struct Header
+	{
+		uint32_t magic = MAGIC;
+		uint32_t version = VERSION;
+		uint32_t size = 0;
+		uint32_t num_strings = 0;
+		uint32_t strings_offset = 0;
+		uint32_t num_game_objects = 0;
+		uint32_t game_objects_offset = 0;
+		uint32_t num_components = 0;
+		uint32_t components_offset = 0;
+		uint32_t values_offset = 0;
+		uint32_t values_size = 0;
+		uint32_t prefabs = NONE; // Array values, loaded through Config by the prefab code
+		uint32_t prefabs_components = NONE;
+		uint32_t dependencies = NONE; // Array of resource UUIDs, prefetched before the game objects are parsed
+		uint32_t world_partition = NONE; // Object value with the streaming cells, see WorldPartition
+		uint32_t padding = 0;
+		SettingsRecord settings;
+	};
+
+	SceneBinary() = default;
+	SceneBinary(const char* buffer, size_t size);
+	~SceneBinary() = default;
+
+	static bool IsBinaryScene(const void* buffer, size_t size);
+	static FileData Convert(const Config& scene_config);
+
+	bool IsValid() const;
+	const Header& GetHeader() const;
+
+	size_t GetNumGameObjects() const;
+	const GameObjectRecord& GetGameObject(size_t index) const;
+	const ComponentRecord& GetComponent(size_t index) const;
+	const char* GetString(uint32_t index) const;
+
+	// Return false when the value tree does not fit in the values section or refers to missing strings
+	bool ReadConfig(uint32_t value_offset, Config& config) const;
+	bool ReadConfigs(uint32_t value_offset, std::vector<Config>& configs) const;
+	bool ReadUInts(uint32_t value_offset, std::vector<uint32_t>& uints) const;
+
+	/*
+		Streams the records of a scene into the binary format, in the order of the JSON scene: the "Prefabs", "PrefabsComponents"
+		and "GameObjects" arrays, then the "Dependencies" manifest, the "WorldPartition" cells and the settings. Game objects are written as they are added, no scene document is built.
+	*/
+	class Writer
+	{
+	public:
+		Writer();
+		~Writer() = default;
+
+		void StartArray(const std::string& name);
+		void Add(const Config& element);
+		void EndArray();
+
+		void AddMembers(const Config& config);
+
+		// The caller owns the returned buffer
+		FileData Finish();
+
+	private:
+		uint32_t AddString(const std::string& string);
+		uint32_t AddValue(const rapidjson::Value& value);
+		void WriteValue(const rapidjson::Value& value, size_t value_position);
+		size_t Allocate(size_t size);
+		void AddGameObject(const rapidjson::Value& game_object_value);
+		static bool AddMeshRenderer(const rapidjson::Value& component_value, ComponentRecord& component);
+
+	private:
+		enum class Array
+		{
+			NONE,
+			PREFABS,
+			PREFABS_COMPONENTS,
+			GAME_OBJECTS
+		};
+
+		Header header;
+		Array current_array = Array::NONE;
+		rapidjson::Document array_document; // Prefab records are few and small, they are gathered and written as one array value
+
+		std::vector<GameObjectRecord> game_objects;
+		std::vector<ComponentRecord> components;
+		std::vector<std::string> strings;
+		std::unordered_map<std::string, uint32_t> string_indices;
+		std::vector<char> values;
+	};
+
+private:
+	bool Validate() const;
+	bool IsValidValueOffset(uint32_t value_offset) const;
+	bool IsValidRange(uint64_t offset, uint64_t count, size_t element_size) const;
+	bool IsValidElements(const Value& value, size_t element_size) const;
+	const Value* GetValue(uint32_t value_offset) const;
+	bool ReadValue(const Value& value, rapidjson::Value& read_value, rapidjson::Document::AllocatorType& allocator, size_t depth) const;
+
+private:
+	static const size_t MAX_VALUE_DEPTH = 64;
+
+	const char* buffer = nullptr;
+	size_t size = 0;
+	bool valid = false;
+};
+
+#endif // _SCENEBINARY_H_
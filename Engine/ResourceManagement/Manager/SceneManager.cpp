@@ -1,31 +1,33 @@
 #include "SceneManager.h"
 
 #include "Helper/Config.h"
+#include "Log/EngineLog.h"
 #include "Main/Application.h"
+#include "Main/WorldPartition.h"
 #include "Module/ModuleFileSystem.h"
 #include "Module/ModuleScene.h"
 #include "Module/ModuleResourceManager.h"
+#include "ResourceManagement/Manager/SceneBinary.h"
 #include "ResourceManagement/Metafile/Metafile.h"
 #include "ResourceManagement/Resources/Scene.h"
 
 FileData SceneManager::Binarize(Scene* scene)
 {
-	scene->Save(App->scene->GetRoot());
-	std::string serialized_scene_string = scene->GetSerializedConfig();
-
-	char* scene_bytes = new char[serialized_scene_string.size() + 1];
-	memcpy(scene_bytes, serialized_scene_string.c_str(), serialized_scene_string.size() + 1);
-
-	return FileData{scene_bytes, serialized_scene_string.size() + 1 }; 
+	return scene->Save(App->scene->GetRoot());
 }
 
 std::shared_ptr<Scene> SceneManager::Load(uint32_t uuid, const FileData& resource_data)
 {
 	char* scene_file_data = (char*)resource_data.buffer;
-	std::string serialized_scene_string = std::string(scene_file_data, resource_data.size);
+	if (SceneBinary::IsBinaryScene(scene_file_data, resource_data.size))
+	{
+		// The resource manager frees the file buffer after loading, the scene keeps its own copy to read in place
+		std::vector<char> scene_binary_data(scene_file_data, scene_file_data + resource_data.size);
+		return std::make_shared<Scene>(uuid, std::move(scene_binary_data));
+	}
 
-	Config scene_config(serialized_scene_string);
-	return std::make_shared<Scene>(uuid, scene_config);
+	Config scene_config(scene_file_data, resource_data.size);
+	return std::make_shared<Scene>(uuid, std::move(scene_config));
 }
 
 uint32_t SceneManager::Create(const std::string& new_scene_path)
@@ -33,3 +35,26 @@ uint32_t SceneManager::Create(const std::string& new_scene_path)
 	Scene scene;
 	return App->resources->CreateFromData(Binarize(&scene) , new_scene_path);
 }
+
+bool SceneManager::ConvertToBinary(const std::string& exported_file_path)
+{
+	Path* scene_path = App->filesystem->GetPath(exported_file_path);
+	if (scene_path == nullptr)
+	{
+		RESOURCES_LOG_ERROR("Missing exported scene %s", exported_file_path.c_str());
+		return false;
+	}
+
+	// World partition cells are binary already, a build only needs them exported next to the scene
+	FileData scene_data = scene_path->GetFile()->Load();
+	uint32_t scene_uuid = std::stoul(scene_path->GetFilenameWithoutExtension());
+	bool cells_exported = WorldPartition::HasExportedCells(*Load(scene_uuid, scene_data));
+	if (SceneBinary::IsBinaryScene(scene_data.buffer, scene_data.size))
+	{
+		delete[] scene_data.buffer;
+		return cells_exported;
+	}
+
+	Config scene_config(scene_data);
+	return App->filesystem->Save(exported_file_path, SceneBinary::Convert(scene_config)) != nullptr && cells_exported;
+}
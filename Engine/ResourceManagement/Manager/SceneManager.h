@@ -21,6 +21,7 @@ public:
 	static FileData Binarize(Scene* material);
 	static std::shared_ptr<Scene> Load(uint32_t uuid, const FileData& resource_data);
 	static uint32_t Create(const std::string& new_scene_path);
+	static bool ConvertToBinary(const std::string& exported_file_path);
 };
 
 #endif
\ No newline at end of file
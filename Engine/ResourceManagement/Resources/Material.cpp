@@ -100,17 +100,29 @@ void Material::Save(Config& config) const
 	config.AddColor(float4(specular_color[0], specular_color[1], specular_color[2], 1.0f), "specularColor");
 }
 
-void Material::Load(const Config& config)
+void Material::Load(const Config& config, bool load_textures)
 {
-	SetMaterialTexture(MaterialTextureType::DIFFUSE, config.GetUInt32("Diffuse", 0));
-	SetMaterialTexture(MaterialTextureType::SPECULAR, config.GetUInt32("Specular", 0));
-	SetMaterialTexture(MaterialTextureType::OCCLUSION, config.GetUInt32("Occlusion", 0));
-	SetMaterialTexture(MaterialTextureType::EMISSIVE, config.GetUInt32("Emissive", 0));
-	SetMaterialTexture(MaterialTextureType::NORMAL, config.GetUInt32("Normal", 0));
-	SetMaterialTexture(MaterialTextureType::LIGHTMAP, config.GetUInt32("Lightmap", 0));
-	SetMaterialTexture(MaterialTextureType::DISSOLVED_DIFFUSE, config.GetUInt32("Dissolved Diffuse", 0));
-	SetMaterialTexture(MaterialTextureType::DISSOLVED_EMISSIVE, config.GetUInt32("Dissolved Emissive", 0));
-	SetMaterialTexture(MaterialTextureType::NOISE, config.GetUInt32("Noise", 0));
+	auto load_texture = [this, load_textures](MaterialTextureType type, uint32_t texture_uuid)
+	{
+		if (load_textures)
+		{
+			SetMaterialTexture(type, texture_uuid);
+		}
+		else
+		{
+			textures_uuid[type] = texture_uuid;
+		}
+	};
+
+	load_texture(MaterialTextureType::DIFFUSE, config.GetUInt32("Diffuse", 0));
+	load_texture(MaterialTextureType::SPECULAR, config.GetUInt32("Specular", 0));
+	load_texture(MaterialTextureType::OCCLUSION, config.GetUInt32("Occlusion", 0));
+	load_texture(MaterialTextureType::EMISSIVE, config.GetUInt32("Emissive", 0));
+	load_texture(MaterialTextureType::NORMAL, config.GetUInt32("Normal", 0));
+	load_texture(MaterialTextureType::LIGHTMAP, config.GetUInt32("Lightmap", 0));
+	load_texture(MaterialTextureType::DISSOLVED_DIFFUSE, config.GetUInt32("Dissolved Diffuse", 0));
+	load_texture(MaterialTextureType::DISSOLVED_EMISSIVE, config.GetUInt32("Dissolved Emissive", 0));
+	load_texture(MaterialTextureType::NOISE, config.GetUInt32("Noise", 0));
 
 	show_checkerboard_texture = config.GetBool("Checkboard", true);
 	config.GetString("ShaderProgram", shader_program, "Blinn phong");
@@ -154,41 +166,6 @@ void Material::Load(const Config& config)
 
 }
 
-void Material::LoadResource(uint32_t uuid, unsigned texture_type)
-{
-	MaterialTextureType type = static_cast<MaterialTextureType>(texture_type);
-	textures[type] = std::static_pointer_cast<Texture>(App->resources->RetrieveFromCacheIfExist(uuid));
-
-
-	if (textures[type])
-	{
-		return;
-	}
-
-	FileData file_data;
-	bool succes = App->resources->RetrieveFileDataByUUID(uuid, file_data);
-	if (succes)
-	{
-		//THINK WHAT TO DO IF IS IN CACHE
-		textures[type] = ResourceManagement::Load<Texture>(uuid, file_data, true);
-
-		//Delete file data buffer
-		delete[] file_data.buffer;
-		App->resources->AddResourceToCache(textures[type]);
-
-	}
-
-}
-
-void Material::InitResource(uint32_t uuid, unsigned texture_type)
-{
-	MaterialTextureType type = static_cast<MaterialTextureType>(texture_type);
-	if (textures[type] && !textures[type].get()->initialized)
-	{
-		textures[type].get()->LoadInMemory();
-	}
-}
-
 void Material::RemoveMaterialTexture(MaterialTextureType type)
 {
 	textures[type] = nullptr;
@@ -200,9 +177,24 @@ void Material::SetMaterialTexture(MaterialTextureType type, uint32_t texture_uui
 
 	if (textures_uuid[type] != 0)
 	{
-		App->resources->loading_thread_communication.texture_type = type;
-		App->resources->loading_thread_communication.current_type = ResourceType::TEXTURE;
-		textures[type] = App->resources->Load<Texture>(texture_uuid);
+		// Only materials owned by a shared pointer can be sure to still exist once the texture is loaded
+		std::weak_ptr<Material> material = weak_from_this();
+		if (App->resources->LoadsAsynchronously() && !material.expired())
+		{
+			textures[type] = nullptr;
+			App->resources->LoadAsync<Texture>(texture_uuid).Then(this, [material, type](const std::shared_ptr<Texture>& texture)
+			{
+				std::shared_ptr<Material> loading_material = material.lock();
+				if (loading_material != nullptr && loading_material->textures_uuid[type] == texture->GetUUID())
+				{
+					loading_material->textures[type] = texture;
+				}
+			});
+		}
+		else
+		{
+			textures[type] = App->resources->Load<Texture>(texture_uuid);
+		}
 	}
 }
 
@@ -211,6 +203,28 @@ const std::shared_ptr<Texture>& Material::GetMaterialTexture(MaterialTextureType
 	return textures[type];
 }
 
+void Material::GetDependencies(std::vector<uint32_t>& dependencies) const
+{
+	for (const auto& texture_uuid : textures_uuid)
+	{
+		if (texture_uuid != 0)
+		{
+			dependencies.push_back(texture_uuid);
+		}
+	}
+}
+
+void Material::LinkDependencies()
+{
+	for (size_t i = 0; i < textures_uuid.size(); ++i)
+	{
+		if (textures_uuid[i] != 0 && textures[i] == nullptr)
+		{
+			textures[i] = App->resources->Load<Texture>(textures_uuid[i]);
+		}
+	}
+}
+
 bool Material::UseLightmap() const
 {
 	return  textures[MaterialTextureType::LIGHTMAP] != nullptr;
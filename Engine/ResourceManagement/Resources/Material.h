@@ -9,9 +9,10 @@
 
 #include <GL/glew.h>
 #include <MathGeoLib.h>
+#include <memory>
 #include <vector>
 
-class Material : public Resource
+class Material : public Resource, public std::enable_shared_from_this<Material>
 {
 public:
 	enum class MaterialType
@@ -43,15 +44,15 @@ public:
 	~Material() = default;
 
 	void Save(Config& config) const;
-	void Load(const Config& config);
+	// Without textures only their UUIDs are read, LinkDependencies loads them
+	void Load(const Config& config, bool load_textures = true);
 
 	void SetMaterialTexture(MaterialTextureType type, uint32_t texture_id);
 	const std::shared_ptr<Texture>& GetMaterialTexture(MaterialTextureType type) const;
 	bool UseLightmap() const;
 
-	//Asyncronous loading
-	void LoadResource(uint32_t uuid, unsigned texture_type);
-	void InitResource(uint32_t uuid, unsigned texture_type);
+	void GetDependencies(std::vector<uint32_t>& dependencies) const override;
+	void LinkDependencies() override;
 
 	void RemoveMaterialTexture(MaterialTextureType type);
 
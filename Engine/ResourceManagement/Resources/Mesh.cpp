@@ -2,9 +2,12 @@
 
 #include "ResourceManagement/Metafile/Metafile.h"
 
-Mesh::Mesh(uint32_t uuid, std::vector<Vertex> && vertices, std::vector<uint32_t> && indices, bool async)
+#include <limits>
+
+Mesh::Mesh(uint32_t uuid, std::vector<Vertex> && vertices, std::vector<uint32_t> && indices, const AABB& bounding_box, bool async)
 	: vertices(vertices)
 	, indices(indices)
+	, bounding_box(bounding_box)
 	, Resource(uuid)
 {
 	if(!async)
@@ -56,57 +59,109 @@ std::vector<Triangle> Mesh::GetTriangles() const
 	return triangles;
 }
 
+// Vertices and indices stay in memory after being uploaded, async meshes are counted as uploaded already
+size_t Mesh::GetMemorySize() const
+{
+	size_t buffers_size = vertices.size() * sizeof(Mesh::Vertex) + indices.size() * sizeof(uint32_t);
+	return 2 * buffers_size;
+}
+
+AABB Mesh::ComputeBoundingBox(const std::vector<Vertex>& vertices)
+{
+	AABB bounding_box;
+	bounding_box.SetNegativeInfinity();
+	for (const auto& vertex : vertices)
+	{
+		bounding_box.Enclose(vertex.position);
+	}
+	return bounding_box;
+}
+
 void Mesh::LoadInMemory()
 {
+	size_t uploaded_bytes = 0;
+	LoadInMemoryStep(std::numeric_limits<size_t>::max(), uploaded_bytes);
+}
 
-	glGenVertexArrays(1, &vao);
-	glGenBuffers(1, &vbo);
-	glGenBuffers(1, &ebo);
+// Buffers are allocated first and filled in chunks, vertices before indices
+bool Mesh::LoadInMemoryStep(size_t max_bytes, size_t& uploaded_bytes)
+{
+	uploaded_bytes = 0;
+	if (initialized)
+	{
+		return true;
+	}
 
-	glBindVertexArray(vao);
-	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	size_t vertices_size = vertices.size() * sizeof(Mesh::Vertex);
+	size_t indices_size = indices.size() * sizeof(uint32_t);
+	if (vao == 0)
+	{
+		glGenVertexArrays(1, &vao);
+		glGenBuffers(1, &vbo);
+		glGenBuffers(1, &ebo);
 
-	glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Mesh::Vertex), vertices.data(), GL_STATIC_DRAW);
+		glBindVertexArray(vao);
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, vertices_size, nullptr, GL_STATIC_DRAW);
 
-	// VERTEX POSITION
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices_size, nullptr, GL_STATIC_DRAW);
 
-	// VERTEX UV 0
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, tex_coords[0]));
+		// VERTEX POSITION
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)0);
 
-	// VERTEX NORMALS
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, normals));
+		// VERTEX UV 0
+		glEnableVertexAttribArray(1);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, tex_coords[0]));
 
-	// VERTEX TANGENT
-	glEnableVertexAttribArray(3);
-	glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, tangent));
+		// VERTEX NORMALS
+		glEnableVertexAttribArray(2);
+		glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, normals));
 
-	// VERTEX JOINTS
-	glEnableVertexAttribArray(4);
-	glVertexAttribIPointer(4, 4, GL_UNSIGNED_INT, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, joints));
+		// VERTEX TANGENT
+		glEnableVertexAttribArray(3);
+		glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, tangent));
 
-	// VERTEX WEIGHTS
-	glEnableVertexAttribArray(5);
-	glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, weights));
+		// VERTEX JOINTS
+		glEnableVertexAttribArray(4);
+		glVertexAttribIPointer(4, 4, GL_UNSIGNED_INT, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, joints));
 
-	// NUM JOINTS
-	glEnableVertexAttribArray(6);
-	glVertexAttribIPointer(6, 1, GL_UNSIGNED_INT, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, num_joints));
+		// VERTEX WEIGHTS
+		glEnableVertexAttribArray(5);
+		glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, weights));
 
-	// VERTEX UV 1
-	glEnableVertexAttribArray(7);
-	glVertexAttribPointer(7, 2, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, tex_coords[1]));
-	glBindVertexArray(0);
+		// NUM JOINTS
+		glEnableVertexAttribArray(6);
+		glVertexAttribIPointer(6, 1, GL_UNSIGNED_INT, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, num_joints));
 
+		// VERTEX UV 1
+		glEnableVertexAttribArray(7);
+		glVertexAttribPointer(7, 2, GL_FLOAT, GL_FALSE, sizeof(Mesh::Vertex), (void*)offsetof(Mesh::Vertex, tex_coords[1]));
+		glBindVertexArray(0);
+	}
 
+	glBindVertexArray(vao);
+	if (uploaded_buffers_size < vertices_size)
+	{
+		size_t chunk_size = vertices_size - uploaded_buffers_size < max_bytes ? vertices_size - uploaded_buffers_size : max_bytes;
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		glBufferSubData(GL_ARRAY_BUFFER, uploaded_buffers_size, chunk_size, reinterpret_cast<const char*>(vertices.data()) + uploaded_buffers_size);
+		uploaded_buffers_size += chunk_size;
+		uploaded_bytes += chunk_size;
+	}
+	if (uploaded_buffers_size >= vertices_size && uploaded_bytes < max_bytes && uploaded_buffers_size < vertices_size + indices_size)
+	{
+		size_t indices_offset = uploaded_buffers_size - vertices_size;
+		size_t chunk_size = indices_size - indices_offset < max_bytes - uploaded_bytes ? indices_size - indices_offset : max_bytes - uploaded_bytes;
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indices_offset, chunk_size, reinterpret_cast<const char*>(indices.data()) + indices_offset);
+		uploaded_buffers_size += chunk_size;
+		uploaded_bytes += chunk_size;
+	}
 	glBindVertexArray(0);
 
-	initialized = true;
+	initialized = uploaded_buffers_size == vertices_size + indices_size;
+	return initialized;
 }
-
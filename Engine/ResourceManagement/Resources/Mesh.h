@@ -33,7 +33,7 @@ public:
 		uint32_t num_joints = 0;
 	};
 
-	Mesh(uint32_t uuid, std::vector<Vertex> && vertices, std::vector<uint32_t> && indices, bool async = false);
+	Mesh(uint32_t uuid, std::vector<Vertex> && vertices, std::vector<uint32_t> && indices, const AABB& bounding_box, bool async = false);
 	~Mesh();
 
 	GLuint GetVAO() const;
@@ -42,18 +42,23 @@ public:
 	int GetNumVerts() const;
 	std::vector<Triangle> GetTriangles() const;
 
-	void LoadInMemory();
+	void LoadInMemory() override;
+	bool LoadInMemoryStep(size_t max_bytes, size_t& uploaded_bytes) override;
 
+	size_t GetMemorySize() const override;
 
+	static AABB ComputeBoundingBox(const std::vector<Vertex>& vertices);
 
 public:
 	std::vector<Vertex> vertices;
 	std::vector<uint32_t> indices;
+	AABB bounding_box; // Local space bounds, stored in the binary so they are never computed at runtime
 
 private:
 	GLuint vao = 0;
 	GLuint vbo = 0;
 	GLuint ebo = 0;
+	size_t uploaded_buffers_size = 0; // Vertices first, then indices
 };
 
 namespace ResourceManagement
@@ -6,12 +6,15 @@
 #include "Module/ModuleScene.h"
 #include "Module/ModuleResourceManager.h"
 #include "Module/ModuleScriptManager.h"
+#include "Module/ModuleSpacePartitioning.h"
 
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
 #include "ResourceManagement/Manager/PrefabManager.h"
 #include "ResourceManagement/Metafile/Metafile.h"
 #include "Component/ComponentParticleSystem.h"
 #include "Component/ComponentBillboard.h"
 
+#include <Brofiler/Brofiler.h>
 #include <algorithm>
 
 Prefab::Prefab(uint32_t uuid, std::vector<std::unique_ptr<GameObject>> && gameObjects, bool overwritable) : Resource(uuid), prefab(std::move(gameObjects)), overwritable(overwritable)
@@ -32,44 +35,137 @@ Prefab::~Prefab()
 
 GameObject* Prefab::Instantiate(GameObject* prefab_parent, std::unordered_map<int64_t, int64_t>* UUIDS_pairs)
 {
-	std::unordered_map<uint64_t, GameObject*> original_gameObject_reference;
+	std::vector<GameObject*> created_game_objects;
+	GameObject* instance = InstantiateTemplate(prefab_parent, App->resources->Load<Prefab>(GetUUID()), UUIDS_pairs, created_game_objects);
+	LinkInstantiatedGameObjects(created_game_objects);
+	return instance;
+}
+
+std::vector<GameObject*> Prefab::InstantiateBatch(GameObject* prefab_parent, size_t count, const std::vector<float4x4>& transforms)
+{
+	BROFILER_CATEGORY("Instantiate Prefab Batch", Profiler::Color::Brown);
+	const std::shared_ptr<Prefab> prefab_reference = App->resources->Load<Prefab>(GetUUID());
 
-	GameObject* parent_prefab;
-	for (const auto& gameObject : prefab)
+	std::vector<GameObject*> created_instances;
+	created_instances.reserve(count);
+	std::vector<GameObject*> created_game_objects;
+	created_game_objects.reserve(count * GetTemplate().size());
+	instances.reserve(instances.size() + count);
+	for (size_t i = 0; i < count; ++i)
 	{
-		if (UUIDS_pairs != nullptr && UUIDS_pairs->find(gameObject->UUID) == UUIDS_pairs->end())
+		GameObject* instance = InstantiateTemplate(prefab_parent, prefab_reference, nullptr, created_game_objects);
+		if (i < transforms.size())
 		{
-			continue;
+			float3 translation;
+			Quat rotation;
+			float3 scale;
+			transforms[i].Decompose(translation, rotation, scale);
+			instance->transform.SetTranslation(translation);
+			instance->transform.SetRotation(rotation);
+			instance->transform.SetScale(scale);
 		}
-		auto particles = gameObject->GetComponent(Component::ComponentType::PARTICLE_SYSTEM);
+		created_instances.push_back(instance);
+	}
+
+	LinkInstantiatedGameObjects(created_game_objects);
+	return created_instances;
+}
+
+const std::vector<Prefab::TemplateNode>& Prefab::GetTemplate()
+{
+	if (!template_dirty)
+	{
+		return flat_template;
+	}
+
+	flat_template.clear();
+	flat_template.reserve(prefab.size());
+	std::unordered_map<uint64_t, size_t> template_indices;
+	for (const auto& prefab_game_object : prefab)
+	{
+		auto particles = prefab_game_object->GetComponent(Component::ComponentType::PARTICLE_SYSTEM);
 		if (particles)
 		{
 			assert(static_cast<ComponentParticleSystem*>(particles)->billboard->emissive_intensity > -1);
 		}
-		GameObject* copy_in_scene = App->scene->AddGameObject(std::make_unique<GameObject>(*gameObject.get()));
-		original_gameObject_reference[gameObject->UUID] = copy_in_scene;
-		if (UUIDS_pairs != nullptr && UUIDS_pairs->find(gameObject->UUID) != UUIDS_pairs->end())
+
+		TemplateNode node;
+		node.game_object = prefab_game_object.get();
+		if (prefab_game_object->parent != nullptr)
+		{
+			const auto it = template_indices.find(prefab_game_object->parent->UUID);
+			if (it != template_indices.end())
+			{
+				node.parent_index = it->second;
+			}
+		}
+		template_indices[prefab_game_object->UUID] = flat_template.size();
+		flat_template.push_back(node);
+	}
+	template_dirty = false;
+
+	return flat_template;
+}
+
+// Game objects whose parent was left out of the instance become prefab parents under the scene root
+GameObject* Prefab::InstantiateTemplate(GameObject* prefab_parent, const std::shared_ptr<Prefab>& prefab_reference, std::unordered_map<int64_t, int64_t>* UUIDS_pairs, std::vector<GameObject*>& created_game_objects)
+{
+	const std::vector<TemplateNode>& prefab_template = GetTemplate();
+	std::vector<GameObject*> instance_game_objects(prefab_template.size(), nullptr);
+	for (size_t i = 0; i < prefab_template.size(); ++i)
+	{
+		const GameObject& prefab_game_object = *prefab_template[i].game_object;
+		if (UUIDS_pairs != nullptr && UUIDS_pairs->find(prefab_game_object.UUID) == UUIDS_pairs->end())
+		{
+			continue;
+		}
+
+		std::unique_ptr<GameObject> created_game_object = std::make_unique<GameObject>();
+		if (UUIDS_pairs != nullptr)
 		{
-			copy_in_scene->UUID = (*UUIDS_pairs)[gameObject->UUID];
+			created_game_object->UUID = (*UUIDS_pairs)[prefab_game_object.UUID];
 		}
-		
-		if (gameObject->parent != nullptr && original_gameObject_reference.find(gameObject->parent->UUID) != original_gameObject_reference.end())
+		created_game_object->CopyFromPrefab(prefab_game_object);
+		GameObject* copy_in_scene = App->scene->AddGameObject(created_game_object);
+		instance_game_objects[i] = copy_in_scene;
+		created_game_objects.push_back(copy_in_scene);
+
+		size_t parent_index = prefab_template[i].parent_index;
+		if (i != 0 && parent_index != TemplateNode::NO_PARENT && instance_game_objects[parent_index] != nullptr)
 		{
-			copy_in_scene->SetParent(original_gameObject_reference[gameObject->parent->UUID]);
+			copy_in_scene->SetParent(instance_game_objects[parent_index]);
 		}
 		else
 		{
+			if (i == 0)
+			{
+				copy_in_scene->SetParent(prefab_parent);
+			}
 			copy_in_scene->is_prefab_parent = true;
 			instances.push_back(copy_in_scene);
-			parent_prefab = copy_in_scene;
 		}
-		copy_in_scene->prefab_reference = App->resources->Load<Prefab>(GetUUID());
-		copy_in_scene->transform = gameObject->transform;
+		copy_in_scene->prefab_reference = prefab_reference;
+		copy_in_scene->transform = prefab_game_object.transform;
 	}
-	parent_prefab->SetParent(prefab_parent);
-	App->animations->UpdateAnimationMeshes();
-	App->scripts->ReLink();
-	return parent_prefab;
+
+	return instance_game_objects.front();
+}
+
+// Space partitioning trees are rebuilt once, animations and scripts outside the new game objects are left as they are
+void Prefab::LinkInstantiatedGameObjects(const std::vector<GameObject*>& created_game_objects)
+{
+	bool static_instantiated = std::any_of(created_game_objects.begin(), created_game_objects.end(), [](const GameObject* game_object)
+	{
+		return game_object->IsStatic();
+	});
+	if (static_instantiated)
+	{
+		App->space_partitioning->GenerateQuadTree();
+		App->space_partitioning->GenerateOctTree();
+	}
+
+	App->animations->UpdateAnimationMeshes(created_game_objects);
+	App->scripts->ReLink(created_game_objects);
 }
 
 void Prefab::Duplicate(GameObject* duplicated_instance)
@@ -86,6 +182,7 @@ void Prefab::Duplicate(GameObject* duplicated_instance)
 */
 void Prefab::Apply(GameObject* new_reference)
 {
+	template_dirty = true;
 	*prefab.front().get() << *new_reference;
 	RecursiveRewrite(prefab.front().get(), new_reference, true, false);
 	for (const auto& old_instance : instances)
@@ -106,6 +203,7 @@ void Prefab::Apply(GameObject* new_reference)
 
 void Prefab::Revert(GameObject * old_reference)
 {
+	template_dirty = true;
 
 	for (const auto& component : old_reference->components)
 	{
@@ -250,6 +348,19 @@ GameObject * Prefab::GetOriginalGameObject(int64_t UUID) const
 	return nullptr;
 }
 
+void Prefab::GetDependencies(std::vector<uint32_t>& dependencies) const
+{
+	for (const auto& prefab_gameobject : prefab)
+	{
+		for (const auto& component : prefab_gameobject->components)
+		{
+			Config component_config;
+			component->Save(component_config);
+			GameObjectDescriptor::GatherResources(component_config.GetValue(), dependencies);
+		}
+	}
+}
+
 bool Prefab::IsOverwritable() const
 {
 	return overwritable;
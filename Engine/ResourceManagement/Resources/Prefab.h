@@ -25,6 +25,9 @@ public:
 	~Prefab();
 
 	GameObject* Instantiate(GameObject* prefab_parent, std::unordered_map<int64_t, int64_t>* UUIDS_pairs = nullptr);
+
+	// Spawns count instances in one pass and links only them, the transforms are optional and local to the parent
+	std::vector<GameObject*> InstantiateBatch(GameObject* prefab_parent, size_t count, const std::vector<float4x4>& transforms = {});
 	void Duplicate(GameObject* instance);
 
 	void Apply(GameObject * new_reference);
@@ -37,16 +40,37 @@ public:
 	GameObject* GetRootGameObject() const;
 	GameObject* GetOriginalGameObject(int64_t UUID) const;
 
+	void GetDependencies(std::vector<uint32_t>& dependencies) const override;
+
 public:
 	std::vector<GameObject*> instances;
 
 private:
+	/*
+		Prefab game objects flattened parents first. Components are cloned straight from the prefab game objects,
+		so loaded resources are shared, and each instance finds its parent by index instead of by UUID.
+	*/
+	struct TemplateNode
+	{
+		static const size_t NO_PARENT = static_cast<size_t>(-1);
+
+		const GameObject* game_object = nullptr;
+		size_t parent_index = NO_PARENT;
+	};
+
+	const std::vector<TemplateNode>& GetTemplate();
+	GameObject* InstantiateTemplate(GameObject* prefab_parent, const std::shared_ptr<Prefab>& prefab_reference, std::unordered_map<int64_t, int64_t>* UUIDS_pairs, std::vector<GameObject*>& created_game_objects);
+	static void LinkInstantiatedGameObjects(const std::vector<GameObject*>& created_game_objects);
+
 	void RecursiveRewrite(GameObject * old_instance, GameObject * new_reference, bool original, bool revert);
 	void AddNewGameObjectToInstance(GameObject * old_instance, GameObject * new_reference, bool original, bool revert);
 	void RemoveGameObjectFromOriginalPrefab(GameObject * gameobject_to_remove);
 	std::vector<std::unique_ptr<GameObject>> prefab;
 	bool overwritable = true;
 
+	std::vector<TemplateNode> flat_template;
+	bool template_dirty = true; // Apply and Revert can add and remove prefab game objects
+
 	friend PanelHierarchy;
 	friend PanelScene;
 };
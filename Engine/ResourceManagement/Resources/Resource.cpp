@@ -16,6 +16,30 @@ bool Resource::IsCoreResource() const
 	return uuid < NUM_CORE_RESOURCES;
 }
 
+void Resource::GetDependencies(std::vector<uint32_t>& dependencies) const
+{
+}
+
+void Resource::LinkDependencies()
+{
+}
+
+void Resource::LoadInMemory()
+{
+}
+
+bool Resource::LoadInMemoryStep(size_t max_bytes, size_t& uploaded_bytes)
+{
+	LoadInMemory();
+	uploaded_bytes = 0;
+	return true;
+}
+
+size_t Resource::GetMemorySize() const
+{
+	return 0;
+}
+
 std::string Resource::GetResourceTypeName(ResourceType resource_type)
 {
 	switch (resource_type)
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 class Path;
 class Metafile;
@@ -42,6 +43,19 @@ public:
 
 	bool IsCoreResource() const;
 
+	// Resources loaded along with this one, the scene manifest prefetches them
+	virtual void GetDependencies(std::vector<uint32_t>& dependencies) const;
+	// Takes the dependencies of a resource decoded without them, once they are loaded. Main thread only
+	virtual void LinkDependencies();
+
+	// Uploads what a resource loaded asynchronously left for the main thread, usually to the GPU
+	virtual void LoadInMemory();
+	// Uploads about max_bytes more and returns whether everything is uploaded. Resources that cannot split their upload do it all at once
+	virtual bool LoadInMemoryStep(size_t max_bytes, size_t& uploaded_bytes);
+
+	// Bytes held in CPU and GPU memory, the resource cache budget is spent with them. Zero uses the size of the exported file
+	virtual size_t GetMemorySize() const;
+
 	static std::string GetResourceTypeName(ResourceType resource_type);
 
 public:
@@ -1,6 +1,7 @@
 #include "Scene.h"
 
 #include "Helper/Config.h"
+#include "Helper/ConfigWriter.h"
 #include "Log/EngineLog.h"
 
 #include "Main/Application.h"
@@ -15,102 +16,188 @@
 #include "Module/ModuleScriptManager.h"
 #include "Module/ModuleSpacePartitioning.h"
 
+#include "ResourceManagement/Manager/SceneBinary.h"
 #include "ResourceManagement/Resources/Prefab.h"
 #include "ResourceManagement/Resources/Scene.h"
 
+#include <Brofiler/Brofiler.h>
+#include <atomic>
+#include <chrono>
 #include <functional> 
+#include <limits>
 #include <queue>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 Scene::Scene() : Resource(0)
 {
 	scene_config = Config();
 }
 
-Scene::Scene(uint32_t uuid, const Config& config) : Resource(uuid)
+Scene::Scene(uint32_t uuid, Config&& config) : Resource(uuid), scene_config(std::move(config))
 {
-	scene_config = Config(config);
 	exported_file_path = MetafileManager::GetUUIDExportedFile(GetUUID());
 }
 
-void Scene::Save(GameObject* gameobject_to_save) const
+Scene::Scene(uint32_t uuid, std::vector<char>&& scene_binary_data) : Resource(uuid), scene_binary_data(std::move(scene_binary_data))
 {
+	exported_file_path = MetafileManager::GetUUIDExportedFile(GetUUID());
+}
+
+FileData Scene::Save(GameObject* gameobject_to_save) const
+{
+	BROFILER_CATEGORY("Save Scene", Profiler::Color::Brown);
+	ConfigWriter writer;
+	SaveRecords(gameobject_to_save, writer);
+	FileData scene_data = writer.Finish();
+
+	const char* scene_bytes = static_cast<const char*>(scene_data.buffer);
+	saved_scene_data.assign(scene_bytes, scene_bytes + scene_data.size);
 	scene_config = Config();
+	return scene_data;
+}
 
-	std::vector<Config> game_objects_config;
-	std::vector<Config> prefabs_config;
-	std::vector<Config> prefabs_components_config;
-	std::queue<GameObject*> pending_objects;
+FileData Scene::SaveBinary(GameObject* gameobject_to_save) const
+{
+	BROFILER_CATEGORY("Save Binary Scene", Profiler::Color::Brown);
+	SceneBinary::Writer writer;
+	SaveRecords(gameobject_to_save, writer);
+	return writer.Finish();
+}
 
+// Each record is written as soon as it is saved, game objects are visited once per array to keep the order of the scene file
+template<typename Writer>
+void Scene::SaveRecords(GameObject* gameobject_to_save, Writer& writer) const
+{
+	std::vector<GameObject*> game_objects;
+	std::queue<GameObject*> pending_objects;
 	for (auto& child_game_object : gameobject_to_save->children)
 	{
 		pending_objects.push(child_game_object);
 	}
-
 	while (!pending_objects.empty())
 	{
 		GameObject* current_game_object = pending_objects.front();
 		pending_objects.pop();
+		game_objects.push_back(current_game_object);
+
+		for (auto& child_game_object : current_game_object->children)
+		{
+			pending_objects.push(child_game_object);
+		}
+	}
 
+	// Static content of a partitioned scene is written to its cells, the scene only lists them
+	Config world_partition_config;
+	bool partitioned = GetUUID() != 0 && App->scene->GetWorldPartition().SaveCells(GetUUID(), gameobject_to_save, game_objects, world_partition_config);
 
+	std::vector<uint32_t> dependencies;
+	writer.StartArray("Prefabs");
+	for (const auto& current_game_object : game_objects)
+	{
 		if (current_game_object->is_prefab_parent)
 		{
 			Config current_prefab;
 			SavePrefab(current_prefab, current_game_object);
-			prefabs_config.push_back(current_prefab);
-		}
-		else if (!current_game_object->prefab_reference)
-		{
-			Config current_gameobject;
-			current_game_object->Save(current_gameobject);
-			game_objects_config.push_back(current_gameobject);
+			writer.Add(current_prefab);
+			dependencies.push_back(current_game_object->prefab_reference->GetUUID());
 		}
+	}
+	writer.EndArray();
 
+	writer.StartArray("PrefabsComponents");
+	for (const auto& current_game_object : game_objects)
+	{
 		if (current_game_object->prefab_reference)
 		{
 			Config current_prefab_modified_component;
 			bool modified = SaveModifiedPrefabComponents(current_prefab_modified_component, current_game_object);
-			if (modified) { prefabs_components_config.push_back(current_prefab_modified_component); };
+			if (modified) { writer.Add(current_prefab_modified_component); };
+			GameObjectDescriptor::GatherResources(current_prefab_modified_component.GetValue(), dependencies);
 		}
+	}
+	writer.EndArray();
 
-		for (auto& child_game_object : current_game_object->children)
+	writer.StartArray("GameObjects");
+	for (const auto& current_game_object : game_objects)
+	{
+		if (!current_game_object->is_prefab_parent && !current_game_object->prefab_reference)
 		{
-			pending_objects.push(child_game_object);
+			Config current_gameobject;
+			current_game_object->Save(current_gameobject);
+			writer.Add(current_gameobject);
+			GameObjectDescriptor::GatherResources(current_gameobject.GetValue(), dependencies);
 		}
 	}
-	scene_config.AddChildrenConfig(prefabs_config, "Prefabs");
-	scene_config.AddChildrenConfig(prefabs_components_config, "PrefabsComponents");
-	scene_config.AddChildrenConfig(game_objects_config, "GameObjects");
-
-	scene_config.AddFloat(App->lights->ambient_light_intensity, "Ambiental Light Intensity");
-	scene_config.AddColor(float4(App->lights->ambient_light_color), "Ambiental Light Color");
-	scene_config.AddBool(App->renderer->shadows_enabled, "Shadows");
-	scene_config.AddBool(App->renderer->hdr, "HDR");
-	scene_config.AddFloat(App->renderer->exposure, "Exposure");
-	scene_config.AddBool(App->renderer->bloom, "Bloom");
-	scene_config.AddInt(App->renderer->amount_of_blur, "Amount of Blur");
-	scene_config.AddBool(App->renderer->fog_enabled, "Fog");
-	scene_config.AddFloat(App->renderer->fog_density, "Fog Density");
-	scene_config.AddColor(App->renderer->fog_color, "Fog Color");
+	writer.EndArray();
+
+	// Manifest of everything the scene loads, read before any game object so the files are prefetched from the start
+	App->resources->GatherDependencies(dependencies);
+	Config scene_members_config;
+	scene_members_config.AddVector(dependencies, "Dependencies");
+	if (partitioned)
+	{
+		scene_members_config.AddChildConfig(world_partition_config, "WorldPartition");
+	}
+	SaveSettings(scene_members_config);
+	writer.AddMembers(scene_members_config);
 }
 
-void Scene::Load(bool from_file)
+void Scene::SaveSettings(Config& config)
 {
-	if(from_file)
-	{
-		Path* scene_path = App->filesystem->GetPath(exported_file_path);
-		FileData scene_data = scene_path->GetFile()->Load();
+	config.AddFloat(App->lights->ambient_light_intensity, "Ambiental Light Intensity");
+	config.AddColor(float4(App->lights->ambient_light_color), "Ambiental Light Color");
+	config.AddBool(App->renderer->shadows_enabled, "Shadows");
+	config.AddBool(App->renderer->hdr, "HDR");
+	config.AddFloat(App->renderer->exposure, "Exposure");
+	config.AddBool(App->renderer->bloom, "Bloom");
+	config.AddInt(App->renderer->amount_of_blur, "Amount of Blur");
+	config.AddBool(App->renderer->fog_enabled, "Fog");
+	config.AddFloat(App->renderer->fog_density, "Fog Density");
+	config.AddColor(App->renderer->fog_color, "Fog Color");
+}
 
-		size_t readed_bytes = scene_data.size;
-		char* scene_file_data = (char*)scene_data.buffer;
-		std::string serialized_scene_string = scene_file_data;
-		delete[] scene_file_data;
+void Scene::LoadSettings(const SceneBinary::SettingsRecord& settings)
+{
+	App->lights->ambient_light_intensity = settings.ambient_light_intensity;
+	memcpy(App->lights->ambient_light_color, settings.ambient_light_color, sizeof(settings.ambient_light_color));
+
+	App->renderer->SetShadows(settings.shadows != 0);
+	App->renderer->SetHDR(settings.hdr != 0);
+	App->renderer->SetBloom(settings.bloom != 0);
+	App->renderer->amount_of_blur = settings.amount_of_blur;
+	App->renderer->exposure = settings.exposure;
+	App->renderer->SetFog(settings.fog != 0);
+	App->renderer->fog_density = settings.fog_density;
+	App->renderer->fog_color = float4(settings.fog_color);
+}
 
-		Config scene_config(serialized_scene_string);
+void Scene::GetWorldPartitionConfig(Config& config) const
+{
+	if (!scene_binary_data.empty())
+	{
+		SceneBinary scene_binary(scene_binary_data.data(), scene_binary_data.size());
+		if (scene_binary.IsValid() && !scene_binary.ReadConfig(scene_binary.GetHeader().world_partition, config))
+		{
+			RESOURCES_LOG_ERROR("Invalid world partition in binary scene %s", exported_file_path.c_str());
+		}
+		return;
 	}
+	scene_config.GetChildConfig("WorldPartition", config);
+}
 
+void Scene::Load()
+{
+	BeginLoad();
+	while (!LoadStep(std::numeric_limits<float>::max()));
+	EndLoad();
+}
+
+void Scene::BeginLoad()
+{
 	timer.Start();
+	std::vector<uint32_t> dependencies;
 
 #if MULTITHREADING
 	App->resources->loading_thread_communication.number_of_textures_loaded = 0;
@@ -119,78 +206,288 @@ void Scene::Load(bool from_file)
 	App->resources->loading_thread_communication.loading = true;
 #endif
 
-	std::unordered_map<int64_t, std::vector<GameObject*>> prefab_parents;
-	std::vector<Config> prefabs_config;
-	scene_config.GetChildrenConfig("Prefabs", prefabs_config);
-	for (unsigned int i = 0; i < prefabs_config.size(); ++i)
+	CancelLoad();
+	prefetch_stats = PrefetchStats();
+	prefetch_read_time_us = 0;
+	if (!saved_scene_data.empty())
 	{
-		uint64_t parent_UUID = prefabs_config[i].GetUInt("ParentUUID", 0);
-		GameObject* loaded_gameobject = LoadPrefab(prefabs_config[i]);
-		if (parent_UUID != 0)
+		scene_config = Config(saved_scene_data.data(), saved_scene_data.size());
+		saved_scene_data = std::vector<char>();
+	}
+
+	if (!scene_binary_data.empty())
+	{
+		load_state.scene_binary = std::make_unique<SceneBinary>(scene_binary_data.data(), scene_binary_data.size());
+		if (!load_state.scene_binary->IsValid())
 		{
-			prefab_parents[parent_UUID].push_back(loaded_gameobject);
+			RESOURCES_LOG_ERROR("Invalid binary scene %s", exported_file_path.c_str());
+			load_state.scene_binary = nullptr;
+			return;
 		}
+		const SceneBinary::Header& header = load_state.scene_binary->GetHeader();
+		if (!load_state.scene_binary->ReadConfigs(header.prefabs, load_state.prefabs_config)
+			|| !load_state.scene_binary->ReadConfigs(header.prefabs_components, load_state.prefabs_modified_components)
+			|| !load_state.scene_binary->ReadUInts(header.dependencies, dependencies))
+		{
+			RESOURCES_LOG_ERROR("Invalid binary scene %s", exported_file_path.c_str());
+			CancelLoad();
+			return;
+		}
+	}
+	else
+	{
+		scene_config.GetChildrenConfig("Prefabs", load_state.prefabs_config);
+		scene_config.GetChildrenConfig("PrefabsComponents", load_state.prefabs_modified_components);
+		scene_config.GetChildrenConfig("GameObjects", load_state.game_objects_config);
+		scene_config.GetVector("Dependencies", dependencies, std::vector<uint32_t>());
 	}
 
+	// Game objects are parsed by LoadStep, a chunk at a time
+	size_t num_game_objects = load_state.scene_binary != nullptr ? load_state.scene_binary->GetNumGameObjects() : load_state.game_objects_config.size();
+	load_state.game_objects.resize(num_game_objects);
+	load_state.created_game_objects.reserve(num_game_objects);
+	load_state.game_object_indices.reserve(num_game_objects);
 
-	std::vector<Config> prefabs_modified_components;
-	scene_config.GetChildrenConfig("PrefabsComponents", prefabs_modified_components);
-	for (unsigned int i = 0; i < prefabs_modified_components.size(); ++i)
+	// With a manifest the files are read while the game objects are parsed, older scenes prefetch the components of every parsed chunk
+	prefetch_stats.from_manifest = !dependencies.empty();
+	if (prefetch_stats.from_manifest)
 	{
-		LoadPrefabModifiedComponents(prefabs_modified_components[i]);
+		PrefetchResources(dependencies);
 	}
-	std::vector<Config> game_objects_config;
-	scene_config.GetChildrenConfig("GameObjects", game_objects_config);
-	for (unsigned int i = 0; i < game_objects_config.size(); ++i)
+}
+
+// Phase 1, the game objects of a chunk are parsed into descriptors in parallel. Fails when a binary game object is out of range
+bool Scene::ParseGameObjects(size_t begin, size_t end)
+{
+	BROFILER_CATEGORY("Parse GameObjects", Profiler::Color::Brown);
+	std::vector<GameObjectDescriptor>& descriptors = load_state.game_objects;
+	if (load_state.scene_binary != nullptr)
 	{
-		GameObject* created_game_object = App->scene->CreateGameObject();
-		created_game_object->Load(game_objects_config[i]);
+		const SceneBinary& scene_binary = *load_state.scene_binary;
+		std::atomic<bool> parsed = true;
+		App->job_system->ParallelFor(end - begin, PARSE_BATCH_SIZE, [&descriptors, &scene_binary, &parsed, begin](size_t batch_begin, size_t batch_end)
+		{
+			for (size_t i = begin + batch_begin; i < begin + batch_end; ++i)
+			{
+				if (!descriptors[i].Parse(scene_binary, i))
+				{
+					parsed = false;
+				}
+			}
+		});
+		return parsed;
+	}
+
+	const std::vector<Config>& game_objects_config = load_state.game_objects_config;
+	App->job_system->ParallelFor(end - begin, PARSE_BATCH_SIZE, [&descriptors, &game_objects_config, begin](size_t batch_begin, size_t batch_end)
+	{
+		for (size_t i = begin + batch_begin; i < begin + batch_end; ++i)
+		{
+			descriptors[i].Parse(game_objects_config[i]);
+		}
+	});
+	return true;
+}
 
+// Phase 2, parents are resolved to descriptor positions through a UUID table, so linking never searches the scene.
+// Scenes are saved parents first, the parent of a parsed game object is already in the table
+void Scene::LinkGameObjects(size_t begin, size_t end)
+{
+	std::vector<GameObjectDescriptor>& descriptors = load_state.game_objects;
+	for (size_t i = begin; i < end; ++i)
+	{
+		GameObjectDescriptor& descriptor = descriptors[i];
+		load_state.game_object_indices.emplace(descriptor.UUID, i);
+
+		auto parent_index = load_state.game_object_indices.find(descriptor.parent_UUID);
+		if (descriptor.parent_UUID != 0 && parent_index != load_state.game_object_indices.end())
+		{
+			descriptor.parent_index = parent_index->second;
+		}
+	}
+}
+
+// The files of the resources the scene depends on are read by jobs while the game objects are parsed and instantiated
+void Scene::PrefetchResources(const std::vector<uint32_t>& resources_to_prefetch)
+{
+	// Jobs only run on the main thread when someone waits for them, prefetching would not overlap with anything
+	if (App->job_system->GetNumThreads() <= 1)
+	{
+		return;
+	}
+
+	for (const auto& resource_uuid : resources_to_prefetch)
+	{
+		if (!load_state.prefetched_resources.insert(resource_uuid).second || App->resources->resource_DB->GetEntry(resource_uuid) == nullptr || App->resources->IsCached(resource_uuid))
+		{
+			continue;
+		}
+
+		App->job_system->Schedule([this, resource_uuid]()
+		{
+			auto start = std::chrono::high_resolution_clock::now();
+			App->resources->PrefetchFileData(resource_uuid);
+			prefetch_read_time_us += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+		}, &prefetch_counter);
+		++prefetch_stats.resources;
+	}
+}
+
+bool Scene::LoadStep(float budget_ms)
+{
+	BROFILER_CATEGORY("Scene LoadStep", Profiler::Color::Brown);
+	auto start = std::chrono::high_resolution_clock::now();
+	auto has_budget = [start, budget_ms]()
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count() < budget_ms;
+	};
+
+	// Phases 1 and 2 run a chunk at a time, the parsing jobs block until the whole chunk is parsed
+	std::vector<GameObjectDescriptor>& descriptors = load_state.game_objects;
+	while (load_state.next_parsed_game_object < descriptors.size() && has_budget())
+	{
+		size_t begin = load_state.next_parsed_game_object;
+		size_t end = begin + PARSE_CHUNK_SIZE < descriptors.size() ? begin + PARSE_CHUNK_SIZE : descriptors.size();
+		if (!ParseGameObjects(begin, end))
+		{
+			RESOURCES_LOG_ERROR("Invalid binary scene %s", exported_file_path.c_str());
+			CancelLoad();
+			return true;
+		}
+		LinkGameObjects(begin, end);
+
+		if (!prefetch_stats.from_manifest)
+		{
+			std::vector<uint32_t> dependencies;
+			for (size_t i = begin; i < end; ++i)
+			{
+				dependencies.insert(dependencies.end(), descriptors[i].resources.begin(), descriptors[i].resources.end());
+			}
+			PrefetchResources(dependencies);
+		}
+		load_state.next_parsed_game_object = end;
+	}
+	if (load_state.next_parsed_game_object < descriptors.size())
+	{
+		return false;
+	}
+
+	// Prefab instances go first, the game objects they hang from look for them when they are loaded
+	for (; load_state.next_prefab < load_state.prefabs_config.size() && has_budget(); ++load_state.next_prefab)
+	{
+		const Config& prefab_config = load_state.prefabs_config[load_state.next_prefab];
+		uint64_t parent_UUID = prefab_config.GetUInt("ParentUUID", 0);
+		GameObject* loaded_gameobject = LoadPrefab(prefab_config);
+		if (parent_UUID != 0)
+		{
+			load_state.prefab_parents[parent_UUID].push_back(loaded_gameobject);
+		}
+	}
+
+	for (; load_state.next_prefab_component < load_state.prefabs_modified_components.size() && has_budget(); ++load_state.next_prefab_component)
+	{
+		LoadPrefabModifiedComponents(load_state.prefabs_modified_components[load_state.next_prefab_component]);
+	}
 
-		if (!created_game_object->IsStatic())
+	// Phase 4, game objects are created, linked to their parents and their components loaded, in file order
+	for (; load_state.next_game_object < load_state.game_objects.size() && has_budget(); ++load_state.next_game_object)
+	{
+		const GameObjectDescriptor& descriptor = load_state.game_objects[load_state.next_game_object];
+		GameObject* game_object_parent = nullptr;
+		if (descriptor.parent_index < load_state.created_game_objects.size())
 		{
-			App->space_partitioning->InsertAABBTree(created_game_object);
+			game_object_parent = load_state.created_game_objects[descriptor.parent_index];
 		}
-		if (prefab_parents.find(created_game_object->UUID) != prefab_parents.end())
+		else if (descriptor.parent_UUID != 0)
 		{
-			for (auto & prefab_child : prefab_parents[created_game_object->UUID])
+			game_object_parent = App->scene->GetGameObject(descriptor.parent_UUID);
+		}
+
+		GameObject* created_game_object = App->scene->CreateGameObject();
+		created_game_object->Load(descriptor, game_object_parent);
+		load_state.created_game_objects.push_back(created_game_object);
+
+		auto prefab_parent = load_state.prefab_parents.find(created_game_object->UUID);
+		if (prefab_parent != load_state.prefab_parents.end())
+		{
+			for (auto & prefab_child : prefab_parent->second)
 			{
 				ComponentTransform previous_transform = prefab_child->transform;
 				prefab_child->SetParent(created_game_object);
 				prefab_child->transform = previous_transform;
 			}
-
 		}
 	}
 
+	return GetLoadProgress() >= 1.f;
+}
+
+void Scene::EndLoad()
+{
+	// Reads still running are the only part of the prefetch left on the critical path
+	auto wait_start = std::chrono::high_resolution_clock::now();
+	App->job_system->Wait(prefetch_counter);
+	prefetch_stats.wait_time_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - wait_start).count();
+	prefetch_stats.read_time_ms = prefetch_read_time_us / 1000.f;
+	prefetch_stats.off_critical_path_ms = prefetch_stats.read_time_ms > prefetch_stats.wait_time_ms ? prefetch_stats.read_time_ms - prefetch_stats.wait_time_ms : 0.f;
+
 	float time_loading = timer.Stop();
+	prefetch_stats.load_time_ms = time_loading;
 	APP_LOG_INFO("Time loading scene: %.3f ms", time_loading);
+	APP_LOG_INFO("Prefetched %zu resources from the %s: %.3f ms of file reads off the main thread, %.3f ms waiting for them", prefetch_stats.resources, prefetch_stats.from_manifest ? "manifest" : "components", prefetch_stats.off_critical_path_ms, prefetch_stats.wait_time_ms);
+
+	if (load_state.scene_binary != nullptr)
+	{
+		LoadSettings(load_state.scene_binary->GetHeader().settings);
+	}
+	else if (scene_binary_data.empty())
+	{
+		App->lights->ambient_light_intensity = scene_config.GetFloat("Ambiental Light Intensity", 1.f);
+		float4 ambiental_light_color;
+		scene_config.GetColor("Ambiental Light Color", ambiental_light_color, float4::one);
+		App->lights->ambient_light_color[0] = ambiental_light_color.x;
+		App->lights->ambient_light_color[1] = ambiental_light_color.y;
+		App->lights->ambient_light_color[2] = ambiental_light_color.z;
+		App->lights->ambient_light_color[3] = ambiental_light_color.w;
+
+		App->renderer->SetShadows(scene_config.GetBool("Shadows", true));
+		App->renderer->SetHDR(scene_config.GetBool("HDR", true));
+		App->renderer->SetBloom(scene_config.GetBool("Bloom", true));
+		App->renderer->amount_of_blur = scene_config.GetInt("Amount of Blur", 10);
+		App->renderer->exposure = scene_config.GetFloat("Exposure", 1.f);
+		App->renderer->SetFog(scene_config.GetBool("Fog", false));
+		App->renderer->fog_density = scene_config.GetFloat("Fog Density", 1.0f);
+		scene_config.GetColor("Fog Color", App->renderer->fog_color, float4::zero);
+	}
+	CancelLoad();
 
-	App->lights->ambient_light_intensity = scene_config.GetFloat("Ambiental Light Intensity", 1.f);
-	float4 ambiental_light_color;
-	scene_config.GetColor("Ambiental Light Color", ambiental_light_color, float4::one);
-	App->lights->ambient_light_color[0] = ambiental_light_color.x;
-	App->lights->ambient_light_color[1] = ambiental_light_color.y;
-	App->lights->ambient_light_color[2] = ambiental_light_color.z;
-	App->lights->ambient_light_color[3] = ambiental_light_color.w;
-
-	App->renderer->SetShadows(scene_config.GetBool("Shadows", true));
-	App->renderer->SetHDR(scene_config.GetBool("HDR", true));
-	App->renderer->SetBloom(scene_config.GetBool("Bloom", true));
-	App->renderer->amount_of_blur = scene_config.GetInt("Amount of Blur", 10);
-	App->renderer->exposure = scene_config.GetFloat("Exposure", 1.f);
-	App->renderer->SetFog(scene_config.GetBool("Fog", false));
-	App->renderer->fog_density = scene_config.GetFloat("Fog Density", 1.0f);
-	scene_config.GetColor("Fog Color", App->renderer->fog_color, float4::zero);
 	App->scripts->ReLink();
 	App->animations->UpdateAnimationMeshes();
 }
 
-const std::string Scene::GetSerializedConfig() const
+void Scene::CancelLoad()
 {
-	std::string serialized_scene_string;
-	scene_config.GetSerializedString(serialized_scene_string);
-	return serialized_scene_string;
+	App->job_system->Wait(prefetch_counter);
+	App->resources->ClearPrefetchedFileData();
+	load_state = LoadState();
+}
+
+const Scene::PrefetchStats& Scene::GetPrefetchStats() const
+{
+	return prefetch_stats;
+}
+
+float Scene::GetLoadProgress() const
+{
+	// Every game object is parsed and then instantiated
+	size_t total = load_state.prefabs_config.size() + load_state.prefabs_modified_components.size() + 2 * load_state.game_objects.size();
+	if (total == 0)
+	{
+		return 1.f;
+	}
+
+	size_t loaded = load_state.next_prefab + load_state.next_prefab_component + load_state.next_parsed_game_object + load_state.next_game_object;
+	return static_cast<float>(loaded) / total;
 }
 
 void Scene::SavePrefab(Config & config, GameObject * gameobject_to_save) const
@@ -241,7 +538,7 @@ GameObject* Scene::LoadPrefab(const Config & config) const
 	if (prefab == nullptr)
 	{
 		GameObject * missing_prefab = App->scene->CreateGameObject();
-		missing_prefab->name = "Missing prefab";
+		missing_prefab->SetName("Missing prefab");
 		return missing_prefab;
 	}
 
@@ -323,7 +620,7 @@ void Scene::LoadPrefabModifiedComponents(const Config& config) const
 		RESOURCES_LOG_ERROR("Missing prefab");
 		return;
 	}
-	if (config.config_document.HasMember("Transform"))
+	if (config.HasMember("Transform"))
 	{
 		Config transform_config;
 		config.GetChildConfig("Transform", transform_config);
@@ -331,9 +628,11 @@ void Scene::LoadPrefabModifiedComponents(const Config& config) const
 		prefab_child->transform.Load(transform_config);
 		prefab_child->transform.modified_by_user = true;
 	}
-	if (config.config_document.HasMember("Name"))
+	if (config.HasMember("Name"))
 	{
-		config.GetString("Name", prefab_child->name, prefab_child->name);
+		std::string prefab_child_name;
+		config.GetString("Name", prefab_child_name, prefab_child->name);
+		prefab_child->SetName(prefab_child_name);
 		prefab_child->SetStatic(config.GetBool("Static", false));
 		prefab_child->SetEnabled(config.GetBool("Active", true));
 		prefab_child->modified_by_user = true;
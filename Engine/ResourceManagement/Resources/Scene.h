@@ -3,9 +3,16 @@
 
 #include "Resource.h"
 #include "Helper/Config.h"
+#include "Helper/JobSystem.h"
 #include "Helper/Timer.h"
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
+#include "ResourceManagement/Manager/SceneBinary.h"
 #include "ResourceManagement/Manager/SceneManager.h"
 #include <array>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class Metafile;
@@ -15,18 +22,47 @@ class Scene : public Resource
 
 public:
 	Scene();
-	Scene(uint32_t uuid, const Config& config);
+	Scene(uint32_t uuid, Config&& config);
+	Scene(uint32_t uuid, std::vector<char>&& scene_binary_data);
 	~Scene() = default;
 
-	void Save(GameObject* gameobject_to_save) const;
-	void Load(bool from_file = true);
+	// Saved records are streamed out, the caller owns the returned buffer
+	FileData Save(GameObject* gameobject_to_save) const;
+	FileData SaveBinary(GameObject* gameobject_to_save) const;
+	void Load();
+
+	// Resumable load, LoadStep parses and instantiates until the budget runs out and returns true once everything is loaded
+	void BeginLoad();
+	bool LoadStep(float budget_ms);
+	void EndLoad();
+	void CancelLoad();
+	float GetLoadProgress() const;
+
+	// How much of the last load was read ahead by the job system
+	struct PrefetchStats
+	{
+		bool from_manifest = false;
+		size_t resources = 0;
+		float read_time_ms = 0.f; // Summed over every job
+		float wait_time_ms = 0.f; // Main thread waiting for reads that had not finished when instantiation did
+		float off_critical_path_ms = 0.f; // Reads the main thread did not have to wait for
+		float load_time_ms = 0.f;
+	};
+	const PrefetchStats& GetPrefetchStats() const;
+
+	// Lighting and rendering settings, saved with every scene
+	static void SaveSettings(Config& config);
+	static void LoadSettings(const SceneBinary::SettingsRecord& settings);
+
+	void GetWorldPartitionConfig(Config& config) const;
 
-	const std::string GetSerializedConfig() const;
 	std::string GetName() const;
 	std::string GetExportedFile() const;
 
  
 private:
+	template<typename Writer>
+	void SaveRecords(GameObject* gameobject_to_save, Writer& writer) const;
 	void SavePrefab(Config& config, GameObject* gameobject_to_save) const;
 	void SavePrefabUUIDS(std::vector<Config>& config, GameObject* gameobject_to_save) const;
 	bool SaveModifiedPrefabComponents(Config& config, GameObject* gameobject_to_save) const;
@@ -34,11 +70,42 @@ private:
 	void LoadPrefabModifiedComponents(const Config& config) const;
 	bool ComputeNameScene(const std::string& assets_path);
 
+	bool ParseGameObjects(size_t begin, size_t end);
+	void LinkGameObjects(size_t begin, size_t end);
+	void PrefetchResources(const std::vector<uint32_t>& resources_to_prefetch);
+
 private:
+	struct LoadState
+	{
+		std::unique_ptr<SceneBinary> scene_binary;
+		std::vector<Config> prefabs_config;
+		std::vector<Config> prefabs_modified_components;
+		std::vector<Config> game_objects_config; // Only for JSON scenes
+		std::vector<GameObjectDescriptor> game_objects;
+		std::vector<GameObject*> created_game_objects; // Same order as the descriptors
+		std::unordered_map<int64_t, std::vector<GameObject*>> prefab_parents;
+		std::unordered_map<uint64_t, size_t> game_object_indices; // Descriptor position by UUID, filled as they are parsed
+		std::unordered_set<uint32_t> prefetched_resources;
+
+		size_t next_parsed_game_object = 0;
+		size_t next_prefab = 0;
+		size_t next_prefab_component = 0;
+		size_t next_game_object = 0;
+	};
+
+	static const size_t PARSE_BATCH_SIZE = 64;
+	static const size_t PARSE_CHUNK_SIZE = 1024; // Parsed by jobs in one go, the budget is checked between chunks
+
 	mutable Config scene_config;
+	mutable std::vector<char> saved_scene_data; // Last saved JSON, parsed into scene_config when the scene is loaded again
+	std::vector<char> scene_binary_data;
 	std::string exported_file_path;
 	std::string name;
 	Timer timer;
+	LoadState load_state;
+	JobCounter prefetch_counter;
+	std::atomic<uint64_t> prefetch_read_time_us{ 0 };
+	PrefetchStats prefetch_stats;
 
 };
 
@@ -22,6 +22,11 @@ Skybox::Skybox(uint32_t uuid) : Resource(uuid)
 
 Skybox::~Skybox()
 {
+	if (App->IsHeadless())
+	{
+		return;
+	}
+
 	glDeleteTextures(1, &cubemap);
 	glDeleteVertexArrays(1, &vao);
 	glDeleteBuffers(1, &vbo);
@@ -142,6 +147,11 @@ void Skybox::GenerateSkyboxCube()
 		 5.0f, -5.0f,  5.0f
 	};
 
+	if (App->IsHeadless())
+	{
+		return;
+	}
+
 	glGenVertexArrays(1, &vao);
 	glGenBuffers(1, &vbo);
 
@@ -158,10 +168,14 @@ void Skybox::GenerateSkyboxCube()
 
 void Skybox::GenerateSkyboxCubeMap()
 {
+	if (App->IsHeadless())
+	{
+		return;
+	}
+
 	glGenTextures(1, &cubemap);
 	glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap);
 
-	App->resources->loading_thread_communication.normal_loading_flag = true;
 	for (size_t i = 0; i <= (size_t)SkyboxFace::BACK; i++)
 	{
 		uint32_t texture_id = textures_id[i];
@@ -172,7 +186,6 @@ void Skybox::GenerateSkyboxCubeMap()
 			glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, texture->width, texture->height, 0, texture->data.size(), texture->data.data());
 		}
 	}
-	App->resources->loading_thread_communication.normal_loading_flag = false;
 
 	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -43,9 +43,9 @@ private:
 	std::array<uint32_t, 6> textures_id{};
 	std::array<std::shared_ptr<Texture>, 6> textures;
 
-	GLuint cubemap;
-	GLuint vao;
-	GLuint vbo;
+	GLuint cubemap = 0;
+	GLuint vao = 0;
+	GLuint vbo = 0;
 };
 
 namespace ResourceManagement
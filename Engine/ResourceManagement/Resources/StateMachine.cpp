@@ -573,3 +573,14 @@ void StateMachine::ResetVariables()
 		boolean.second = false;
 	}
 }
+
+void StateMachine::GetDependencies(std::vector<uint32_t>& dependencies) const
+{
+	for (const auto& clip : clips)
+	{
+		if (clip->animation != nullptr)
+		{
+			dependencies.push_back(clip->animation->GetUUID());
+		}
+	}
+}
\ No newline at end of file
@@ -122,6 +122,8 @@ public:
 	std::string GetNameOfVariable(uint64_t name_hash) const;
 	void ResetVariables();
 
+	void GetDependencies(std::vector<uint32_t>& dependencies) const override;
+
 private:
 	void RemoveState(const std::shared_ptr<State> & state);
 	void RemoveClip(const std::shared_ptr<Clip> & state);
@@ -6,6 +6,8 @@
 #include <IL/il.h>
 #include <IL/ilu.h>
 #include <IL/ilut.h>
+#include <cassert>
+#include <limits>
 
 Texture::Texture(uint32_t uuid, char* data, size_t image_size, int width, int height, int num_channels, TextureOptions& options, bool async)
 	: width(width), height(height), num_channels(num_channels)
@@ -29,35 +31,73 @@ Texture::Texture(uint32_t uuid, char* data, size_t image_size, int width, int he
 
 Texture::~Texture()
 {
-	glDeleteTextures(1, &opengl_texture);
+	if (opengl_texture != 0)
+	{
+		glDeleteTextures(1, &opengl_texture);
+	}
 }
 
 void Texture::LoadInMemory()
 {
+	size_t uploaded_bytes = 0;
+	LoadInMemoryStep(std::numeric_limits<size_t>::max(), uploaded_bytes);
+}
+
+// The texture is allocated first and filled in bands of rows, compressed ones in bands of 4x4 blocks.
+// DevIL rows are tightly packed, so bands start at multiples of the unpadded row size.
+bool Texture::LoadInMemoryStep(size_t max_bytes, size_t& uploaded_bytes)
+{
+	uploaded_bytes = 0;
 	if(initialized)
 	{
-		return;
+		return true;
 	}
 
+	bool compressed = texture_options.texture_type != TextureType::NORMAL;
+	GLint channels = num_channels > 3 ? GL_RGBA : GL_RGB;
+	size_t row_size = compressed ? static_cast<size_t>((width + 3) / 4) * 16 : static_cast<size_t>(width) * (channels == GL_RGBA ? 4 : 3);
+	int num_rows = compressed ? (height + 3) / 4 : height;
 
-	glGenTextures(1, &opengl_texture);
-	glBindTexture(GL_TEXTURE_2D, opengl_texture);
+	if (opengl_texture == 0)
+	{
+		glGenTextures(1, &opengl_texture);
+		glBindTexture(GL_TEXTURE_2D, opengl_texture);
 
-	// set the texture wrapping/filtering options (on the currently bound texture object)
-	SetWrap(texture_options.wrap_mode);
-	SetFilter(texture_options.filter_mode);
-	
-	GLint channels = num_channels > 3 ? GL_RGBA : GL_RGB;
-	if (texture_options.texture_type == TextureType::NORMAL)
+		// set the texture wrapping/filtering options (on the currently bound texture object)
+		SetWrap(texture_options.wrap_mode);
+		SetFilter(texture_options.filter_mode);
+		glTexImage2D(GL_TEXTURE_2D, 0, compressed ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : channels, width, height, 0, channels, GL_UNSIGNED_BYTE, nullptr);
+	}
+	else
 	{
-		glTexImage2D(GL_TEXTURE_2D, 0, channels, width, height, 0, channels, GL_UNSIGNED_BYTE, data.data());
+		glBindTexture(GL_TEXTURE_2D, opengl_texture);
 	}
-	else 
+
+	size_t max_rows = row_size > 0 ? max_bytes / row_size : 0;
+	int step_rows = static_cast<int>(max_rows < static_cast<size_t>(num_rows - uploaded_rows) ? max_rows : num_rows - uploaded_rows);
+	step_rows = step_rows > 0 ? step_rows : 1;
+	const char* step_data = data.data() + uploaded_rows * row_size;
+	assert(compressed || (uploaded_rows + step_rows) * row_size <= data.size());
+	if (compressed)
+	{
+		int y = uploaded_rows * 4;
+		int step_height = (uploaded_rows + step_rows == num_rows ? height : (uploaded_rows + step_rows) * 4) - y;
+		glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, width, step_height, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, step_rows * row_size, step_data);
+	}
+	else
 	{
-		glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, width, height, 0, data.size(), data.data());
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, uploaded_rows, width, step_rows, channels, GL_UNSIGNED_BYTE, step_data);
 	}
+	uploaded_rows += step_rows;
+	uploaded_bytes = step_rows * row_size;
 
 	glBindTexture(GL_TEXTURE_2D, 0);
+	if (uploaded_rows < num_rows)
+	{
+		return false;
+	}
+
 	if (texture_options.generate_mipmaps)
 	{
 		GenerateMipMap();
@@ -65,6 +105,14 @@ void Texture::LoadInMemory()
 
 	initialized = true;
 	++App->resources->loading_thread_communication.number_of_textures_loaded;
+	return true;
+}
+
+// Async textures are counted as uploaded already, they are cached before the main thread uploads them
+size_t Texture::GetMemorySize() const
+{
+	size_t gpu_size = texture_options.generate_mipmaps ? data.size() * 4 / 3 : data.size();
+	return data.capacity() + gpu_size;
 }
 
 void Texture::GenerateMipMap()
@@ -42,7 +42,10 @@ public:
 	char* GetFilter_C_Str() const;
 
 
-	void LoadInMemory();
+	void LoadInMemory() override;
+	bool LoadInMemoryStep(size_t max_bytes, size_t& uploaded_bytes) override;
+
+	size_t GetMemorySize() const override;
 
 private:
 	void GenerateMipMap();
@@ -61,6 +64,7 @@ private:
 	GLenum wrap;
 	GLenum filter;
 	std::vector<char> data;
+	int uploaded_rows = 0; // Rows of blocks for compressed textures
 
 	friend class Skybox;
 };
@@ -16,7 +16,10 @@ Video::Video(uint32_t uuid, bool async) : Resource(uuid)
 
 Video::~Video()
 {
-	video_capture->release();
+	if (video_capture != nullptr)
+	{
+		video_capture->release();
+	}
 
 }
 
@@ -42,6 +45,7 @@ void Video::LoadInMemory()
 	{
 		frame_time = 1.0f / video_capture->get(cv::CAP_PROP_FPS);
 	}
+	initialized = true;
 }
 
 GLuint Video::GenerateFrame()
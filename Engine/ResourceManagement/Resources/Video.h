@@ -16,7 +16,7 @@ public:
 	Video(uint32_t uuid, bool async = false);
 	~Video();
 
-	void LoadInMemory();
+	void LoadInMemory() override;
 
 	GLuint GenerateFrame();
 	void Stop();
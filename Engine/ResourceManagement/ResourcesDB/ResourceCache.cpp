@@ -0,0 +1,189 @@
+#include "ResourceCache.h"
+
+std::shared_ptr<Resource> ResourceCache::Get(uint32_t uuid)
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	auto entry = entries.find(uuid);
+	if (entry == entries.end())
+	{
+		++misses;
+		return nullptr;
+	}
+
+	++hits;
+	Touch(entry->second);
+	return entry->second.resource;
+}
+
+std::shared_ptr<Resource> ResourceCache::Find(uint32_t uuid) const
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	auto entry = entries.find(uuid);
+	return entry != entries.end() ? entry->second.resource : nullptr;
+}
+
+bool ResourceCache::Contains(uint32_t uuid) const
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	return entries.find(uuid) != entries.end();
+}
+
+std::shared_ptr<Resource> ResourceCache::Add(const std::shared_ptr<Resource>& resource, ResourceType type, size_t memory_size)
+{
+	if (resource == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	auto inserted = entries.emplace(resource->GetUUID(), Entry());
+	Entry& entry = inserted.first->second;
+	if (!inserted.second)
+	{
+		Touch(entry);
+		return entry.resource;
+	}
+
+	entry.resource = resource;
+	entry.type = type;
+	entry.memory_size = memory_size;
+	entry.lru_position = lru_order.insert(lru_order.end(), resource->GetUUID());
+
+	TypeStats& type_stats = types[type];
+	++type_stats.resources;
+	type_stats.memory += memory_size;
+	memory += memory_size;
+	return resource;
+}
+
+// Resources are destroyed once the lock is released, destroying one can release others
+bool ResourceCache::Remove(uint32_t uuid)
+{
+	std::shared_ptr<Resource> removed_resource;
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		auto entry = entries.find(uuid);
+		if (entry == entries.end())
+		{
+			return false;
+		}
+
+		removed_resource = std::move(entry->second.resource);
+		Erase(entry);
+	}
+	return true;
+}
+
+void ResourceCache::Clear()
+{
+	std::unordered_map<uint32_t, Entry> cleared_entries;
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+		cleared_entries.swap(entries);
+		lru_order.clear();
+		pinned_order.clear();
+		types.clear();
+		memory = 0;
+	}
+}
+
+// Resources still in use are pinned, they are evicted by a later trim once released if the cache is still over the budget
+size_t ResourceCache::Trim()
+{
+	std::vector<std::shared_ptr<Resource>> evicted_resources;
+	{
+		std::lock_guard<std::mutex> lock(cache_mutex);
+
+		// Released resources go back to the least recently used end, where they were when pinned
+		size_t pinned_checks = pinned_order.size() < PINNED_CHECKS_PER_TRIM ? pinned_order.size() : PINNED_CHECKS_PER_TRIM;
+		for (size_t i = 0; i < pinned_checks; ++i)
+		{
+			Entry& pinned_entry = entries.find(pinned_order.front())->second;
+			if (pinned_entry.resource.use_count() > 1)
+			{
+				pinned_order.splice(pinned_order.end(), pinned_order, pinned_entry.lru_position);
+			}
+			else
+			{
+				lru_order.splice(lru_order.begin(), pinned_order, pinned_entry.lru_position);
+				pinned_entry.pinned = false;
+			}
+		}
+
+		while (memory > budget && !lru_order.empty())
+		{
+			auto entry = entries.find(lru_order.front());
+			if (entry->second.resource.use_count() > 1)
+			{
+				pinned_order.splice(pinned_order.end(), lru_order, entry->second.lru_position);
+				entry->second.pinned = true;
+				continue;
+			}
+
+			++evictions;
+			evicted_memory += entry->second.memory_size;
+			evicted_resources.push_back(std::move(entry->second.resource));
+			Erase(entry);
+		}
+	}
+	return evicted_resources.size();
+}
+
+bool ResourceCache::IsOverBudget() const
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	return memory > budget;
+}
+
+void ResourceCache::SetBudget(size_t budget)
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	this->budget = budget;
+}
+
+size_t ResourceCache::GetBudget() const
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	return budget;
+}
+
+ResourceCache::Stats ResourceCache::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	Stats stats;
+	stats.resources = entries.size();
+	stats.memory = memory;
+	stats.hits = hits;
+	stats.misses = misses;
+	stats.evictions = evictions;
+	stats.evicted_memory = evicted_memory;
+	stats.types = types;
+	return stats;
+}
+
+void ResourceCache::ResetCounters()
+{
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	hits = 0;
+	misses = 0;
+	evictions = 0;
+	evicted_memory = 0;
+}
+
+// A used resource is the most recently used one, also when it was pinned
+void ResourceCache::Touch(Entry& entry)
+{
+	lru_order.splice(lru_order.end(), entry.pinned ? pinned_order : lru_order, entry.lru_position);
+	entry.pinned = false;
+}
+
+void ResourceCache::Erase(std::unordered_map<uint32_t, Entry>::iterator entry)
+{
+	TypeStats& type_stats = types[entry->second.type];
+	--type_stats.resources;
+	type_stats.memory -= entry->second.memory_size;
+	memory -= entry->second.memory_size;
+
+	(entry->second.pinned ? pinned_order : lru_order).erase(entry->second.lru_position);
+	entries.erase(entry);
+}
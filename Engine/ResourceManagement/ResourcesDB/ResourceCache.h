@@ -0,0 +1,98 @@
+#ifndef _RESOURCECACHE_H_
+#define _RESOURCECACHE_H_
+
+#include "ResourceManagement/Resources/Resource.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*
+	Loaded resources by UUID, in the order they were last used. Memory is accounted to the type of each resource.
+	Trimming a cache over the budget evicts the least recently used resources, a resource is only evicted when the cache
+	is the last one holding it. Resources found in use are pinned out of the eviction order until they are used again
+	or a later trim finds them released, so trimming never walks the same resources in use every frame.
+	Safe to use from any thread, except Trim and Clear, which destroy resources that can own GPU objects.
+*/
+class ResourceCache
+{
+public:
+	struct TypeStats
+	{
+		size_t resources = 0;
+		size_t memory = 0;
+	};
+
+	struct Stats
+	{
+		size_t resources = 0;
+		size_t memory = 0;
+		size_t hits = 0;
+		size_t misses = 0;
+		size_t evictions = 0;
+		size_t evicted_memory = 0;
+		std::map<ResourceType, TypeStats> types;
+	};
+
+	ResourceCache() = default;
+	~ResourceCache() = default;
+
+	ResourceCache(const ResourceCache& resource_cache_to_copy) = delete;
+	ResourceCache& operator=(const ResourceCache& resource_cache_to_copy) = delete;
+
+	// Counts a hit or a miss, a hit becomes the most recently used resource
+	std::shared_ptr<Resource> Get(uint32_t uuid);
+
+	// Neither counted nor used, for code that only checks what is loaded
+	std::shared_ptr<Resource> Find(uint32_t uuid) const;
+	bool Contains(uint32_t uuid) const;
+
+	// Returns the cached resource, which is the one already there when the UUID was cached before
+	std::shared_ptr<Resource> Add(const std::shared_ptr<Resource>& resource, ResourceType type, size_t memory_size);
+	bool Remove(uint32_t uuid);
+	void Clear();
+
+	// Does nothing under the budget, returns the number of evicted resources
+	size_t Trim();
+	bool IsOverBudget() const;
+
+	void SetBudget(size_t budget);
+	size_t GetBudget() const;
+	Stats GetStats() const;
+	void ResetCounters();
+
+private:
+	struct Entry
+	{
+		std::shared_ptr<Resource> resource;
+		ResourceType type = ResourceType::UNKNOWN;
+		size_t memory_size = 0;
+		std::list<uint32_t>::iterator lru_position; // In pinned_order when pinned
+		bool pinned = false;
+	};
+
+	void Touch(Entry& entry);
+	void Erase(std::unordered_map<uint32_t, Entry>::iterator entry);
+
+private:
+	mutable std::mutex cache_mutex;
+	std::unordered_map<uint32_t, Entry> entries;
+	std::list<uint32_t> lru_order; // Least recently used first, pinned resources are not in it
+	std::list<uint32_t> pinned_order; // Checked again a few at a time, the least recently checked first
+	std::map<ResourceType, TypeStats> types;
+
+	static const size_t PINNED_CHECKS_PER_TRIM = 16;
+
+	size_t budget = 512 * 1024 * 1024;
+	size_t memory = 0;
+
+	size_t hits = 0;
+	size_t misses = 0;
+	size_t evictions = 0;
+	size_t evicted_memory = 0;
+};
+
+#endif // _RESOURCECACHE_H_
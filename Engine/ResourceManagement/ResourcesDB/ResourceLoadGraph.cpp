@@ -0,0 +1,196 @@
+#include "ResourceLoadGraph.h"
+
+#include "Helper/Config.h"
+#include "Log/EngineLog.h"
+#include "Main/Application.h"
+#include "Module/ModuleResourceManager.h"
+
+#include "ResourceManagement/Manager/GameObjectDescriptor.h"
+#include "ResourceManagement/Manager/MaterialManager.h"
+
+#include <Brofiler/Brofiler.h>
+#include <chrono>
+#include <limits>
+
+namespace
+{
+	// The main thread is blocked on the graph, its loads go before every streaming load
+	const float BLOCKING_PRIORITY = std::numeric_limits<float>::max();
+}
+
+// Resolving a resource waits for it to be decoded, the resources found before it are decoding meanwhile
+std::shared_ptr<Resource> ResourceLoadGraph::Load(uint32_t uuid)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	auto elapsed_ms = [start]()
+	{
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+	};
+
+	AddNode(uuid);
+	for (size_t i = 0; i < found_nodes.size(); ++i)
+	{
+		Node& node = nodes[found_nodes[i]];
+		Resolve(node);
+		for (const auto& dependency : node.dependencies)
+		{
+			++stats.dependencies;
+			if (nodes.find(dependency) != nodes.end())
+			{
+				++stats.shared_dependencies;
+				continue;
+			}
+			AddNode(dependency);
+		}
+	}
+
+	Node& root_node = nodes[uuid];
+	Complete(root_node);
+
+	stats.time_ms = elapsed_ms();
+	return root_node.resource;
+}
+
+const ResourceLoadGraph::Stats& ResourceLoadGraph::GetStats() const
+{
+	return stats;
+}
+
+// Resources decoded without the main thread start decoding as soon as they are found
+void ResourceLoadGraph::AddNode(uint32_t uuid)
+{
+	Node& node = nodes[uuid];
+	node.uuid = uuid;
+	node.type = App->resources->GetResourceType(uuid);
+	found_nodes.push_back(uuid);
+	++stats.resources;
+
+	// Cached resources are complete along with their dependencies
+	std::shared_ptr<Resource> cached_resource = App->resources->resource_cache.Find(uuid);
+	if (cached_resource != nullptr)
+	{
+		node.resource = cached_resource;
+		node.state = NodeState::COMPLETED;
+		return;
+	}
+
+	ModuleResourceManager::DecodeFunction decode;
+	switch (node.type)
+	{
+	case ResourceType::ANIMATION:
+		decode = [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource> { return ResourceManagement::Load<Animation>(uuid, file_data, true); };
+		break;
+
+	case ResourceType::MATERIAL:
+		// Its textures are nodes of the graph, they are linked once complete
+		decode = [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource> { return MaterialManager::Load(uuid, file_data, false); };
+		break;
+
+	case ResourceType::MESH:
+		decode = [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource> { return ResourceManagement::Load<Mesh>(uuid, file_data, true); };
+		break;
+
+	case ResourceType::SKELETON:
+		decode = [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource> { return ResourceManagement::Load<Skeleton>(uuid, file_data, true); };
+		break;
+
+	case ResourceType::TEXTURE:
+		decode = [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource> { return ResourceManagement::Load<Texture>(uuid, file_data, true); };
+		break;
+
+	case ResourceType::VIDEO:
+		decode = [](uint32_t uuid, const FileData& file_data) -> std::shared_ptr<Resource> { return ResourceManagement::Load<Video>(uuid, file_data, true); };
+		break;
+
+	default:
+		// Built on the main thread once its dependencies are complete, or left to whoever requests it
+		return;
+	}
+
+	node.handle = ResourceHandle<Resource>(App->resources->StartAsyncLoad(uuid, BLOCKING_PRIORITY, decode));
+	++stats.decoded_in_parallel;
+}
+
+// Prefabs are built on the main thread, only their file is parsed to find what their components load
+void ResourceLoadGraph::Resolve(Node& node) const
+{
+	if (node.state == NodeState::COMPLETED)
+	{
+		return;
+	}
+
+	if (node.handle.IsValid())
+	{
+		std::shared_ptr<Resource> decoded_resource = node.handle.GetFuture().get();
+		if (decoded_resource != nullptr)
+		{
+			decoded_resource->GetDependencies(node.dependencies);
+		}
+		return;
+	}
+
+	if (node.type != ResourceType::PREFAB && node.type != ResourceType::MODEL)
+	{
+		return;
+	}
+
+	BROFILER_CATEGORY("Resolve Prefab Dependencies", Profiler::Color::Brown);
+	FileData file_data;
+	if (!App->resources->RetrieveFileDataByUUID(node.uuid, file_data))
+	{
+		return;
+	}
+
+	Config prefab_config(static_cast<const char*>(file_data.buffer), file_data.size);
+	std::vector<Config> game_objects_config;
+	prefab_config.GetChildrenConfig("GameObjects", game_objects_config);
+	for (const auto& game_object_config : game_objects_config)
+	{
+		std::vector<Config> components_config;
+		game_object_config.GetChildrenConfig("Components", components_config);
+		for (const auto& component_config : components_config)
+		{
+			GameObjectDescriptor::GatherResources(component_config.GetValue(), node.dependencies);
+		}
+	}
+
+	// Building the prefab takes the file from here instead of reading it again
+	App->resources->StorePrefetchedFileData(node.uuid, file_data);
+}
+
+// Depth first, a dependency that is still completing its own dependencies closes a cycle
+void ResourceLoadGraph::Complete(Node& node)
+{
+	if (node.state != NodeState::PENDING)
+	{
+		return;
+	}
+
+	node.state = NodeState::COMPLETING;
+	for (const auto& dependency : node.dependencies)
+	{
+		Node& dependency_node = nodes[dependency];
+		if (dependency_node.state == NodeState::COMPLETING)
+		{
+			++stats.cycles;
+			RESOURCES_LOG_ERROR("Resource %u depends on Resource %u, which depends on it. The dependency is ignored.", node.uuid, dependency);
+			continue;
+		}
+		Complete(dependency_node);
+	}
+
+	if (node.handle.IsValid())
+	{
+		App->resources->FinishAsyncLoad(*node.handle.load);
+		node.resource = node.handle.load->resource;
+		if (node.resource != nullptr)
+		{
+			node.resource->LinkDependencies();
+		}
+	}
+	else if (node.type == ResourceType::PREFAB || node.type == ResourceType::MODEL)
+	{
+		node.resource = App->resources->LoadFile<Prefab>(node.uuid);
+	}
+	node.state = NodeState::COMPLETED;
+}
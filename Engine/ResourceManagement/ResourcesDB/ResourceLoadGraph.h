@@ -0,0 +1,68 @@
+#ifndef _RESOURCELOADGRAPH_H_
+#define _RESOURCELOADGRAPH_H_
+
+#include "ResourceManagement/Resources/Resource.h"
+#include "ResourceManagement/ResourcesDB/ResourceLoader.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/*
+	Loads a resource along with everything it depends on as a graph of jobs. Each resource is decoded on the loader workers
+	as soon as it is found, its dependencies are resolved from what was decoded and fanned out the same way, so resources
+	that do not depend on each other decode at the same time. Once its dependencies are complete, a resource is completed
+	on the main thread. Resources shared by several others are loaded once and dependency cycles are reported and cut.
+*/
+class ResourceLoadGraph
+{
+public:
+	struct Stats
+	{
+		size_t resources = 0;
+		size_t dependencies = 0;
+		size_t shared_dependencies = 0; // Dependencies found again from another resource
+		size_t decoded_in_parallel = 0; // Resources decoded on the loader workers
+		size_t cycles = 0;
+		float time_ms = 0.f;
+	};
+
+	ResourceLoadGraph() = default;
+	~ResourceLoadGraph() = default;
+
+	ResourceLoadGraph(const ResourceLoadGraph& resource_load_graph_to_copy) = delete;
+	ResourceLoadGraph& operator=(const ResourceLoadGraph& resource_load_graph_to_copy) = delete;
+
+	// Main thread only, blocks until the resource and its dependencies are loaded
+	std::shared_ptr<Resource> Load(uint32_t uuid);
+	const Stats& GetStats() const;
+
+private:
+	enum class NodeState
+	{
+		PENDING,
+		COMPLETING,
+		COMPLETED
+	};
+
+	struct Node
+	{
+		uint32_t uuid = 0;
+		ResourceType type = ResourceType::UNKNOWN;
+		ResourceHandle<Resource> handle; // Invalid for resources built on the main thread, keeps the load from being cancelled
+		std::vector<uint32_t> dependencies;
+		std::shared_ptr<Resource> resource;
+		NodeState state = NodeState::PENDING;
+	};
+
+	void AddNode(uint32_t uuid);
+	void Resolve(Node& node) const;
+	void Complete(Node& node);
+
+private:
+	std::unordered_map<uint32_t, Node> nodes;
+	std::vector<uint32_t> found_nodes; // In the order they were found, which is the order they are resolved
+	Stats stats;
+};
+
+#endif // _RESOURCELOADGRAPH_H_
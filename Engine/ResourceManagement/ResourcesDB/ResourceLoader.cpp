@@ -0,0 +1,242 @@
+#include "ResourceLoader.h"
+
+#include "Main/Application.h"
+#include "Module/ModuleResourceManager.h"
+
+#include <Brofiler/Brofiler.h>
+#include <algorithm>
+#include <limits>
+
+std::shared_ptr<Resource> AsyncLoad::Wait()
+{
+	// The caller blocks on it, a queued load jumps ahead of every other one
+	App->resources->resource_loader.RaisePriority(shared_from_this(), std::numeric_limits<float>::max());
+	decoded.wait();
+	App->resources->FinishAsyncLoad(*this);
+	return resource;
+}
+
+void AsyncLoad::SetPriority(float priority)
+{
+	App->resources->resource_loader.SetPriority(shared_from_this(), priority);
+}
+
+ResourceLoader::~ResourceLoader()
+{
+	CleanUp();
+}
+
+void ResourceLoader::Init(size_t num_threads)
+{
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex);
+		running = true;
+	}
+
+	for (size_t i = 0; i < num_threads; ++i)
+	{
+		workers.emplace_back(&ResourceLoader::WorkerLoop, this);
+	}
+}
+
+void ResourceLoader::CleanUp()
+{
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex);
+		running = false;
+	}
+	queue_condition.notify_all();
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	workers.clear();
+}
+
+void ResourceLoader::SetNumThreads(size_t num_threads)
+{
+	CleanUp();
+	Init(num_threads);
+}
+
+size_t ResourceLoader::GetNumThreads() const
+{
+	return workers.size();
+}
+
+void ResourceLoader::Push(const std::shared_ptr<AsyncLoad>& load)
+{
+	{
+		std::lock_guard<std::mutex> lock(queue_mutex);
+		load->queued = true;
+		load->queued_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - creation_time).count();
+		load->queued_order = next_order++;
+		++num_queued;
+		QueueEntry(load);
+	}
+	queue_condition.notify_one();
+}
+
+bool ResourceLoader::TryPopDecoded(std::shared_ptr<AsyncLoad>& load)
+{
+	return decoded_loads.TryPop(load);
+}
+
+// The previous entry of the load is left in the heap and skipped once popped
+void ResourceLoader::SetPriority(const std::shared_ptr<AsyncLoad>& load, float priority)
+{
+	std::lock_guard<std::mutex> lock(queue_mutex);
+	if (load->priority == priority)
+	{
+		return;
+	}
+
+	load->priority = priority;
+	if (load->queued)
+	{
+		QueueEntry(load);
+	}
+}
+
+void ResourceLoader::RaisePriority(const std::shared_ptr<AsyncLoad>& load, float priority)
+{
+	std::lock_guard<std::mutex> lock(queue_mutex);
+	if (load->priority >= priority)
+	{
+		return;
+	}
+
+	load->priority = priority;
+	if (load->queued)
+	{
+		QueueEntry(load);
+	}
+}
+
+bool ResourceLoader::Cancel(const std::shared_ptr<AsyncLoad>& load)
+{
+	std::lock_guard<std::mutex> lock(queue_mutex);
+	if (!load->queued)
+	{
+		return false;
+	}
+
+	load->queued = false;
+	--num_queued;
+	return true;
+}
+
+// Every key depends on the aging, the heap is built again with the new one
+void ResourceLoader::SetAging(float aging_per_second)
+{
+	std::lock_guard<std::mutex> lock(queue_mutex);
+	this->aging_per_second = aging_per_second;
+	queued_loads.erase(std::remove_if(queued_loads.begin(), queued_loads.end(), &ResourceLoader::IsStale), queued_loads.end());
+	for (auto& queued_load : queued_loads)
+	{
+		queued_load.key = queued_load.priority - aging_per_second * queued_load.load->queued_time;
+	}
+	std::make_heap(queued_loads.begin(), queued_loads.end(), &ResourceLoader::CompareEntries);
+}
+
+float ResourceLoader::GetAging() const
+{
+	std::lock_guard<std::mutex> lock(queue_mutex);
+	return aging_per_second;
+}
+
+size_t ResourceLoader::GetNumQueued() const
+{
+	std::lock_guard<std::mutex> lock(queue_mutex);
+	return num_queued;
+}
+
+size_t ResourceLoader::GetNumDecoded() const
+{
+	return decoded_loads.Size();
+}
+
+void ResourceLoader::WorkerLoop()
+{
+	BROFILER_THREAD("Resource Loader");
+
+	while (true)
+	{
+		std::shared_ptr<AsyncLoad> load;
+		{
+			std::unique_lock<std::mutex> lock(queue_mutex);
+			queue_condition.wait(lock, [this]() { return num_queued > 0 || !running; });
+			if (!running)
+			{
+				return;
+			}
+
+			load = PopEntry();
+		}
+		if (load == nullptr)
+		{
+			continue;
+		}
+
+		{
+			BROFILER_CATEGORY("Decode Resource", Profiler::Color::Brown);
+			size_t file_size = 0;
+			std::shared_ptr<Resource> resource = load->load_function(file_size);
+			load->load_function = nullptr;
+			load->file_size = file_size;
+			load->promise.set_value(resource);
+		}
+		decoded_loads.Push(load);
+	}
+}
+
+// Comparing the priority each load has at the same time does not depend on when, so the keys never change while queued
+void ResourceLoader::QueueEntry(const std::shared_ptr<AsyncLoad>& load)
+{
+	QueuedLoad queued_load;
+	queued_load.key = load->priority - aging_per_second * load->queued_time;
+	queued_load.order = load->queued_order;
+	queued_load.priority = load->priority;
+	queued_load.load = load;
+	queued_loads.push_back(std::move(queued_load));
+	std::push_heap(queued_loads.begin(), queued_loads.end(), &ResourceLoader::CompareEntries);
+
+	// Loads whose priority changes every frame would fill the heap with stale entries otherwise
+	if (queued_loads.size() > 2 * num_queued + 64)
+	{
+		queued_loads.erase(std::remove_if(queued_loads.begin(), queued_loads.end(), &ResourceLoader::IsStale), queued_loads.end());
+		std::make_heap(queued_loads.begin(), queued_loads.end(), &ResourceLoader::CompareEntries);
+	}
+}
+
+std::shared_ptr<AsyncLoad> ResourceLoader::PopEntry()
+{
+	while (!queued_loads.empty())
+	{
+		std::pop_heap(queued_loads.begin(), queued_loads.end(), &ResourceLoader::CompareEntries);
+		QueuedLoad queued_load = std::move(queued_loads.back());
+		queued_loads.pop_back();
+		if (IsStale(queued_load))
+		{
+			continue;
+		}
+
+		queued_load.load->queued = false;
+		queued_load.load->started_order = next_order++;
+		--num_queued;
+		return queued_load.load;
+	}
+	return nullptr;
+}
+
+bool ResourceLoader::IsStale(const QueuedLoad& queued_load)
+{
+	return !queued_load.load->queued || queued_load.priority != queued_load.load->priority;
+}
+
+// Equal keys are decoded in the order they were queued
+bool ResourceLoader::CompareEntries(const QueuedLoad& first, const QueuedLoad& second)
+{
+	return first.key < second.key || (first.key == second.key && first.order > second.order);
+}
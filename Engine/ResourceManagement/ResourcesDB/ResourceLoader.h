@@ -0,0 +1,237 @@
+#ifndef _RESOURCELOADER_H_
+#define _RESOURCELOADER_H_
+
+#include "Helper/ThreadSafeQueue.h"
+#include "ResourceManagement/Resources/Resource.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+	State shared by everything waiting for one resource loaded asynchronously. A loader worker decodes the resource,
+	then the main thread finishes it: uploads it, adds it to the cache and runs the callbacks of the requesters.
+*/
+struct AsyncLoad : public std::enable_shared_from_this<AsyncLoad>
+{
+	using Callback = std::function<void(const std::shared_ptr<Resource>&)>;
+
+	// Main thread only, blocks until decoded and finishes the load right away, whatever is left of its upload included
+	std::shared_ptr<Resource> Wait();
+	// Higher priorities are decoded first. Safe to call from any thread, does nothing once the load is being decoded
+	void SetPriority(float priority);
+
+	uint32_t uuid = 0;
+	ResourceType type = ResourceType::UNKNOWN; // What its main thread finalization is estimated with
+	std::function<std::shared_ptr<Resource>(size_t& file_size)> load_function; // Runs on a loader worker
+	size_t file_size = 0;
+
+	std::promise<std::shared_ptr<Resource>> promise;
+	std::shared_future<std::shared_ptr<Resource>> decoded = promise.get_future().share();
+
+	std::mutex callbacks_mutex;
+	std::vector<std::pair<const void*, Callback>> callbacks;
+	std::shared_ptr<Resource> resource; // Cached resource while it is uploaded, nullptr when the resource failed to load. Read it once finished is set
+	std::atomic<bool> finished = false;
+	std::atomic<size_t> num_requesters = 0; // Handles and pending callbacks, a load is only cancelled once it has none
+
+	// Written by the loader under its lock
+	float priority = 0.f;
+	double queued_time = 0.0; // Seconds since the loader was created
+	bool queued = false;
+	size_t queued_order = 0; // Order the load was queued and started in, among every load of the loader
+	size_t started_order = 0;
+};
+
+/*
+	What LoadAsync returns. Copies refer to the same load, so any number of requesters can poll or wait for it.
+	Every handle counts as a requester of the load while it lives, so the load is not cancelled under it.
+*/
+template<typename T>
+class ResourceHandle
+{
+public:
+	ResourceHandle() = default;
+	ResourceHandle(const std::shared_ptr<AsyncLoad>& load) : load(load)
+	{
+		AddRequester();
+	}
+
+	ResourceHandle(const ResourceHandle& handle_to_copy) : load(handle_to_copy.load)
+	{
+		AddRequester();
+	}
+
+	ResourceHandle(ResourceHandle&& handle_to_move) noexcept : load(std::move(handle_to_move.load)) {}
+
+	ResourceHandle& operator=(ResourceHandle handle_to_assign) noexcept
+	{
+		std::swap(load, handle_to_assign.load);
+		return *this;
+	}
+
+	~ResourceHandle()
+	{
+		if (load != nullptr)
+		{
+			--load->num_requesters;
+		}
+	}
+
+	bool IsValid() const
+	{
+		return load != nullptr;
+	}
+
+	bool IsReady() const
+	{
+		return load != nullptr && load->finished;
+	}
+
+	// Nullptr until the load is finished
+	std::shared_ptr<T> Get() const
+	{
+		return IsReady() ? std::static_pointer_cast<T>(load->resource) : nullptr;
+	}
+
+	// Main thread only
+	std::shared_ptr<T> Wait() const
+	{
+		return load != nullptr ? std::static_pointer_cast<T>(load->Wait()) : nullptr;
+	}
+
+	void SetPriority(float priority) const
+	{
+		if (load != nullptr)
+		{
+			load->SetPriority(priority);
+		}
+	}
+
+	// Ready once the resource is decoded, before its upload. Any thread can wait for it
+	std::shared_future<std::shared_ptr<Resource>> GetFuture() const
+	{
+		return load != nullptr ? load->decoded : std::shared_future<std::shared_ptr<Resource>>();
+	}
+
+	// Runs on the main thread once the resource is ready, right away if it already is. Never runs for resources that fail to load
+	void Then(const void* requester, std::function<void(const std::shared_ptr<T>&)> callback) const
+	{
+		if (load == nullptr)
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(load->callbacks_mutex);
+			if (!load->finished)
+			{
+				load->callbacks.emplace_back(requester, [callback](const std::shared_ptr<Resource>& resource)
+				{
+					callback(std::static_pointer_cast<T>(resource));
+				});
+				++load->num_requesters;
+				return;
+			}
+		}
+
+		if (load->resource != nullptr)
+		{
+			callback(std::static_pointer_cast<T>(load->resource));
+		}
+	}
+
+private:
+	void AddRequester() const
+	{
+		if (load != nullptr)
+		{
+			++load->num_requesters;
+		}
+	}
+
+private:
+	std::shared_ptr<AsyncLoad> load;
+
+	friend class ResourceLoadGraph;
+};
+
+/*
+	Workers that decode resources off the main thread. They sleep on a condition variable while there is nothing to load.
+	Queued loads are decoded by priority, a load gains aging_per_second priority for every second it waits, so a load only
+	waits behind a lower priority one queued (priority difference / aging_per_second) seconds earlier at most.
+	Decoded loads wait in a queue until the main thread finishes them.
+*/
+class ResourceLoader
+{
+public:
+	ResourceLoader() = default;
+	~ResourceLoader();
+
+	ResourceLoader(const ResourceLoader& resource_loader_to_copy) = delete;
+	ResourceLoader& operator=(const ResourceLoader& resource_loader_to_copy) = delete;
+
+	void Init(size_t num_threads);
+	// Loads that are still queued stay queued until the loader is initialized again
+	void CleanUp();
+
+	void SetNumThreads(size_t num_threads);
+	size_t GetNumThreads() const;
+
+	// Queued with the priority the load already has
+	void Push(const std::shared_ptr<AsyncLoad>& load);
+	bool TryPopDecoded(std::shared_ptr<AsyncLoad>& load);
+
+	void SetPriority(const std::shared_ptr<AsyncLoad>& load, float priority);
+	// Same, unless the load already has a higher priority
+	void RaisePriority(const std::shared_ptr<AsyncLoad>& load, float priority);
+	// Returns whether the load was still queued, it is never decoded then
+	bool Cancel(const std::shared_ptr<AsyncLoad>& load);
+
+	void SetAging(float aging_per_second);
+	float GetAging() const;
+
+	size_t GetNumQueued() const;
+	size_t GetNumDecoded() const;
+
+private:
+	struct QueuedLoad
+	{
+		double key = 0.0; // Priority the load will have at any time, less the same aging for every load
+		size_t order = 0;
+		float priority = 0.f;
+		std::shared_ptr<AsyncLoad> load;
+	};
+
+	void WorkerLoop();
+
+	// Both need the queue lock
+	void QueueEntry(const std::shared_ptr<AsyncLoad>& load);
+	std::shared_ptr<AsyncLoad> PopEntry();
+
+	static bool IsStale(const QueuedLoad& queued_load);
+	static bool CompareEntries(const QueuedLoad& first, const QueuedLoad& second);
+
+private:
+	std::vector<std::thread> workers;
+	bool running = false;
+
+	mutable std::mutex queue_mutex;
+	std::condition_variable queue_condition;
+	std::vector<QueuedLoad> queued_loads; // Max heap, entries left behind by priority changes and cancellations are skipped
+	size_t num_queued = 0;
+	size_t next_order = 0;
+	float aging_per_second = 1.f;
+	const std::chrono::steady_clock::time_point creation_time = std::chrono::steady_clock::now();
+
+	mutable ThreadSafeQueue<std::shared_ptr<AsyncLoad>> decoded_loads;
+};
+
+#endif // _RESOURCELOADER_H_
@@ -69,6 +69,22 @@ void OLOctTree::Insert(GameObject &game_object)
 	}
 }
 
+void OLOctTree::Remove(const std::unordered_set<const GameObject*>& game_objects)
+{
+	for (const auto& node : flattened_tree)
+	{
+		node->objects.erase(std::remove_if(node->objects.begin(), node->objects.end(), [&game_objects](const GameObject* game_object)
+		{
+			return game_objects.find(game_object) != game_objects.end();
+		}), node->objects.end());
+	}
+}
+
+bool OLOctTree::Contains(const AABB& box) const
+{
+	return root != nullptr && root->box.Contains(box);
+}
+
 void OLOctTree::CollectIntersect(std::vector<GameObject*> &game_objects, const Frustum& camera_frustum)
 {
 	root->CollectIntersect(game_objects, camera_frustum);
@@ -4,6 +4,7 @@
 #include "OLOctTreeNode.h"
 
 #include <MathGeoLib.h>
+#include <unordered_set>
 
 class GameObject;
 
@@ -16,6 +17,9 @@ public:
 	void Create(AABB limits);
 	void Clear();
 	void Insert(GameObject &game_object);
+	// Emptied nodes are kept until the tree is created again
+	void Remove(const std::unordered_set<const GameObject*>& game_objects);
+	bool Contains(const AABB& box) const;
 	void CollectIntersect(std::vector<GameObject*> &game_objects, const Frustum& camera_frustum);
 
 